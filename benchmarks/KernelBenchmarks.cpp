@@ -0,0 +1,112 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2017 German Aerospace Center (DLR) and others.
+/****************************************************************************/
+//
+//   This program and the accompanying materials
+//   are made available under the terms of the Eclipse Public License v2.0
+//   which accompanies this distribution, and is available at
+//   http://www.eclipse.org/legal/epl-v20.html
+//
+/****************************************************************************/
+/// @file    KernelBenchmarks.cpp
+/// @date    2017-11-20
+/// @version $Id$
+///
+// Micro benchmarks for performance critical kernels (requires google-benchmark)
+/****************************************************************************/
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <benchmark/benchmark.h>
+#include <utils/geom/PositionVector.h>
+#include <utils/iodevices/OutputDevice_String.h>
+#include <utils/vehicle/SUMOVTypeParameter.h>
+#include <microsim/MSGlobals.h>
+#include <microsim/MSVehicleType.h>
+#include <microsim/cfmodels/MSCFModel_Krauss.h>
+
+
+/* Times the Krauss car-following kernel over a spread of gaps. The vehicle
+ * pointer may be 0 here since the euler update does not inspect it. */
+static void
+benchKraussFollowSpeed(benchmark::State& state) {
+    MSVehicleType type(SUMOVTypeParameter("t0"));
+    MSCFModel_Krauss model(&type, 2., 4., 4., 4., 0., 1.);
+    MSGlobals::gSemiImplicitEulerUpdate = true;
+    while (state.KeepRunning()) {
+        double v = 0.;
+        for (int i = 0; i < 100; i++) {
+            v = model.followSpeed(0, v, 2. + i, 10., 4.);
+        }
+        benchmark::DoNotOptimize(v);
+    }
+}
+BENCHMARK(benchKraussFollowSpeed);
+
+
+/* Times offset lookups along a long lane shape as performed for every
+ * position query. */
+static void
+benchPositionVectorNearestOffset(benchmark::State& state) {
+    PositionVector shape;
+    for (int i = 0; i < 100; i++) {
+        shape.push_back(Position(i * 10., (i % 2) * 5.));
+    }
+    while (state.KeepRunning()) {
+        double result = 0.;
+        for (int i = 0; i < 100; i++) {
+            result += shape.nearest_offset_to_point2D(Position(i * 9.9, 2.5));
+        }
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(benchPositionVectorNearestOffset);
+
+
+/* Times the geometry interpolation used whenever a vehicle position is
+ * computed from its lane offset. */
+static void
+benchPositionVectorPositionAtOffset(benchmark::State& state) {
+    PositionVector shape;
+    for (int i = 0; i < 100; i++) {
+        shape.push_back(Position(i * 10., (i % 2) * 5.));
+    }
+    const double length = shape.length();
+    while (state.KeepRunning()) {
+        double result = 0.;
+        for (int i = 0; i < 100; i++) {
+            result += shape.positionAtOffset(length * i / 100.).x();
+        }
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(benchPositionVectorPositionAtOffset);
+
+
+/* Times XML attribute formatting as done by all plain-output writers. */
+static void
+benchOutputDeviceFormatting(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        OutputDevice_String od(false);
+        for (int i = 0; i < 100; i++) {
+            od.openTag("vehicle");
+            od.writeAttr("id", i).writeAttr("speed", i * 0.5).writeAttr("pos", i * 7.5);
+            od.closeTag();
+        }
+        benchmark::DoNotOptimize(od.getString());
+    }
+}
+BENCHMARK(benchOutputDeviceFormatting);
+
+
+BENCHMARK_MAIN();
+
+/****************************************************************************/
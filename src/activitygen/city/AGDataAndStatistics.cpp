@@ -111,6 +111,13 @@ AGDataAndStatistics::consolidateStat() {
     normalizeMapProb(&outgoing);
     limitEndAge = population.rbegin()->first;
 
+    // build the age lookup table; every person drawn from the population
+    //  distribution queries these proportions several times
+    myPropYoungerThan.clear();
+    for (int age = 0; age <= limitEndAge + 1; ++age) {
+        myPropYoungerThan.push_back(computePropYoungerThan(age));
+    }
+
     oldAgeHhProb = (double)getPeopleOlderThan(limitAgeRetirement) / (double)getPeopleOlderThan(limitAgeChildren);
     secondPersProb = (double)(getPeopleOlderThan(limitAgeChildren) - households) / (double)households;
     meanNbrChildren = (double)getPeopleYoungerThan(limitAgeChildren) / ((1 - oldAgeHhProb) * (double)households);
@@ -121,7 +128,15 @@ AGDataAndStatistics::consolidateStat() {
 
 double
 AGDataAndStatistics::getPropYoungerThan(int age) {
-    std::map<int, double>::iterator it;
+    if (age >= 0 && age < (int)myPropYoungerThan.size()) {
+        return myPropYoungerThan[age];
+    }
+    return computePropYoungerThan(age);
+}
+
+double
+AGDataAndStatistics::computePropYoungerThan(int age) const {
+    std::map<int, double>::const_iterator it;
     double sum = 0;
     int previousAge = 0;
     double prop = 0;
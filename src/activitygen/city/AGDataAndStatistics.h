@@ -37,6 +37,7 @@
 
 #include <iostream>
 #include <map>
+#include <vector>
 #include "AGSchool.h"
 #include "AGPosition.h"
 
@@ -184,6 +185,15 @@ private:
 
     //function normalizing the map's probabilities: Sum(floats) = 1
     void normalizeMapProb(std::map<int, double>* myMap);
+    /**
+     * computes the proportion of the population younger than the given age
+     * by interpolating in the population distribution map; used to fill the
+     * lookup table below which serves all queries during generation
+     */
+    double computePropYoungerThan(int age) const;
+
+    //cumulative population proportion per age, built in consolidateStat
+    std::vector<double> myPropYoungerThan;
 };
 
 #endif
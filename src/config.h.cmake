@@ -22,6 +22,9 @@
 /* defined if python is available */
 #cmakedefine HAVE_PYTHON
 
+/* defined if zlib is available */
+#cmakedefine HAVE_ZLIB
+
 /* Define if auto-generated version.h should be used. */
 #define HAVE_VERSION_H
 #ifndef HAVE_VERSION_H
@@ -181,40 +181,54 @@ RODFDetector::buildDestinationDistribution(const RODFDetectorCon& detectors,
         return;
     }
     std::vector<RODFRouteDesc>& descs = myRoutes->get();
+    // The walk along a route passes the same detectors and split edges in
+    //  every interval because the split maps share one key set over time;
+    //  collect the probability factors once per route and only look up the
+    //  current values in the interval loop below.
+    typedef std::pair<const RODFDetector*, RODFEdge*> SplitFactor;
+    std::vector<std::vector<SplitFactor> > routeFactors(descs.size());
+    std::vector<bool> routeKnown(descs.size(), true);
+    int index = 0;
+    for (std::vector<RODFRouteDesc>::iterator ri = descs.begin(); ri != descs.end(); ++ri, index++) {
+        for (ROEdgeVector::iterator j = (*ri).edges2Pass.begin(); j != (*ri).edges2Pass.end();) {
+            if (!net.hasDetector(*j)) {
+                ++j;
+                continue;
+            }
+            const RODFDetector& det = detectors.getAnyDetectorForEdge(static_cast<RODFEdge*>(*j));
+            const std::vector<std::map<RODFEdge*, double> >& probs = det.getSplitProbabilities();
+            if (probs.size() == 0) {
+                // no split information at all; the route probability is zero
+                routeKnown[index] = false;
+                break;
+            }
+            RODFEdge* splitEdge = 0;
+            for (std::map<RODFEdge*, double>::const_iterator k = probs.front().begin(); k != probs.front().end(); ++k) {
+                if (find(j, (*ri).edges2Pass.end(), (*k).first) != (*ri).edges2Pass.end()) {
+                    splitEdge = (*k).first;
+                    break;
+                }
+            }
+            if (splitEdge != 0) {
+                routeFactors[index].push_back(std::make_pair(&det, splitEdge));
+                j = find(j, (*ri).edges2Pass.end(), splitEdge);
+            } else {
+                ++j;
+            }
+        }
+    }
     // iterate through time (in output interval steps)
     for (SUMOTime time = startTime; time < endTime; time += stepOffset) {
         into[time] = new RandomDistributor<int>();
-        std::map<ROEdge*, double> flowMap;
+        const int intervalIndex = (int)((time - startTime) / stepOffset);
         // iterate through the routes
-        int index = 0;
+        index = 0;
         for (std::vector<RODFRouteDesc>::iterator ri = descs.begin(); ri != descs.end(); ++ri, index++) {
-            double prob = 1.;
-            for (ROEdgeVector::iterator j = (*ri).edges2Pass.begin(); j != (*ri).edges2Pass.end() && prob > 0;) {
-                if (!net.hasDetector(*j)) {
-                    ++j;
-                    continue;
-                }
-                const RODFDetector& det = detectors.getAnyDetectorForEdge(static_cast<RODFEdge*>(*j));
-                const std::vector<std::map<RODFEdge*, double> >& probs = det.getSplitProbabilities();
-                if (probs.size() == 0) {
-                    prob = 0;
-                    ++j;
-                    continue;
-                }
-                const std::map<RODFEdge*, double>& tprobs = probs[(int)((time - startTime) / stepOffset)];
-                RODFEdge* splitEdge = 0;
-                for (std::map<RODFEdge*, double>::const_iterator k = tprobs.begin(); k != tprobs.end(); ++k) {
-                    if (find(j, (*ri).edges2Pass.end(), (*k).first) != (*ri).edges2Pass.end()) {
-                        prob *= (*k).second;
-                        splitEdge = (*k).first;
-                        break;
-                    }
-                }
-                if (splitEdge != 0) {
-                    j = find(j, (*ri).edges2Pass.end(), splitEdge);
-                } else {
-                    ++j;
-                }
+            double prob = routeKnown[index] ? 1. : 0.;
+            const std::vector<SplitFactor>& factors = routeFactors[index];
+            for (std::vector<SplitFactor>::const_iterator f = factors.begin(); f != factors.end() && prob > 0; ++f) {
+                const std::map<RODFEdge*, double>& tprobs = f->first->getSplitProbabilities()[intervalIndex];
+                prob *= tprobs.find(f->second)->second;
             }
             into[time]->add(index, prob);
             (*ri).overallProb = prob;
@@ -107,7 +107,7 @@ RODUAFrame::addImportOptions() {
     oc.addDescription("weights.expand", "Processing", "Expand weights behind the simulation's end");
 
     oc.doRegister("routing-algorithm", new Option_String("dijkstra"));
-    oc.addDescription("routing-algorithm", "Processing", "Select among routing algorithms ['dijkstra', 'astar', 'CH', 'CHWrapper']");
+    oc.addDescription("routing-algorithm", "Processing", "Select among routing algorithms ['dijkstra', 'bidijkstra', 'astar', 'CH', 'CHWrapper']");
 
     oc.doRegister("weight-period", new Option_String("3600", "TIME"));
     oc.addDescription("weight-period", "Processing", "Aggregation period for the given weight files; triggers rebuilding of Contraction Hierarchy");
@@ -120,6 +120,15 @@ RODUAFrame::addImportOptions() {
 
     oc.doRegister("astar.save-landmark-distances", new Option_FileName());
     oc.addDescription("astar.save-landmark-distances", "Processing", "Save lookup table for astar ALT-variant to the given file");
+
+    oc.doRegister("astar.landmark-count", new Option_Integer(0));
+    oc.addDescription("astar.landmark-count", "Processing", "Select the given number of landmarks automatically (farthest-point heuristic) and save the lookup table for the astar ALT-variant");
+
+    oc.doRegister("ch.hierarchy-input", new Option_FileName());
+    oc.addDescription("ch.hierarchy-input", "Processing", "Initialize the contraction hierarchy from the given file (generated by --ch.save-hierarchy on the same network)");
+
+    oc.doRegister("ch.save-hierarchy", new Option_FileName());
+    oc.addDescription("ch.save-hierarchy", "Processing", "Save the contraction hierarchy to the given file for reuse");
 }
 
 
@@ -144,6 +153,12 @@ RODUAFrame::addDUAOptions() {
     oc.doRegister("skip-new-routes", new Option_Bool(false));
     oc.addDescription("skip-new-routes", "Processing", "Only reuse routes from input, do not calculate new ones");
 
+    oc.doRegister("skip-new-routes.threshold", new Option_Float(0.));
+    oc.addDescription("skip-new-routes.threshold", "Processing", "Only calculate a new route for vehicles whose relative cost change on the current route exceeds FLOAT");
+
+    oc.doRegister("alternatives.prefill", new Option_Integer(0));
+    oc.addDescription("alternatives.prefill", "Processing", "Fill the alternatives set of each vehicle up to INT routes by repeatedly excluding the most expensive edge of the last found route (one extra routing query per alternative, may need --ignore-errors on networks with bridge edges)");
+
     oc.doRegister("ptline-routing", new Option_Bool(false));
     oc.addDescription("ptline-routing", "Processing", "Route all public transport input");
 
@@ -217,6 +232,17 @@ RODUAFrame::checkOptions() {
     if (oc.isDefault("routing-algorithm") && (oc.isSet("astar.all-distances") || oc.isSet("astar.landmark-distances") || oc.isSet("astar.save-landmark-distances"))) {
         oc.set("routing-algorithm", "astar");
     }
+    if (oc.getInt("astar.landmark-count") > 0 && !oc.isSet("astar.save-landmark-distances")) {
+        WRITE_ERROR("Option --astar.landmark-count requires --astar.save-landmark-distances for writing the table.");
+        return false;
+    }
+    if (oc.isDefault("routing-algorithm") && (oc.isSet("ch.hierarchy-input") || oc.isSet("ch.save-hierarchy"))) {
+        oc.set("routing-algorithm", "CH");
+    }
+    if (oc.isSet("ch.hierarchy-input") && oc.isSet("ch.save-hierarchy")) {
+        WRITE_ERROR("Options --ch.hierarchy-input and --ch.save-hierarchy are mutually exclusive.");
+        return false;
+    }
 
     if (oc.getString("route-choice-method") != "gawron" && oc.getString("route-choice-method") != "logit") {
         WRITE_ERROR("Invalid route choice method '" + oc.getString("route-choice-method") + "'.");
@@ -44,7 +44,7 @@
 #include <router/RONet.h>
 #include <router/ROEdge.h>
 #include <utils/vehicle/DijkstraRouter.h>
-#include <utils/vehicle/DijkstraRouter.h>
+#include <utils/vehicle/BidiDijkstraRouter.h>
 #include <utils/vehicle/AStarRouter.h>
 #include <utils/vehicle/CHRouter.h>
 #include <utils/vehicle/CHRouterWrapper.h>
@@ -113,19 +113,29 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
                 router = new DijkstraRouter<ROEdge, ROVehicle, noProhibitions<ROEdge, ROVehicle> >(
                     ROEdge::getAllEdges(), oc.getBool("ignore-errors"), &ROEdge::getTravelTimeStatic);
             }
+        } else if (routingAlgorithm == "bidijkstra") {
+            if (net.hasPermissions()) {
+                router = new BidiDijkstraRouter<ROEdge, ROVehicle, prohibited_withPermissions<ROEdge, ROVehicle> >(
+                    ROEdge::getAllEdges(), oc.getBool("ignore-errors"), &ROEdge::getTravelTimeStatic);
+            } else {
+                router = new BidiDijkstraRouter<ROEdge, ROVehicle, noProhibitions<ROEdge, ROVehicle> >(
+                    ROEdge::getAllEdges(), oc.getBool("ignore-errors"), &ROEdge::getTravelTimeStatic);
+            }
         } else if (routingAlgorithm == "astar") {
             if (net.hasPermissions()) {
                 typedef AStarRouter<ROEdge, ROVehicle, prohibited_withPermissions<ROEdge, ROVehicle> > AStar;
                 const AStar::LookupTable* lookup = 0;
                 if (oc.isSet("astar.all-distances")) {
                     lookup = new AStar::FLT(oc.getString("astar.all-distances"), (int)ROEdge::getAllEdges().size());
-                } else if (oc.isSet("astar.landmark-distances")) {
+                } else if (oc.isSet("astar.landmark-distances") || oc.getInt("astar.landmark-count") > 0) {
                     CHRouterWrapper<ROEdge, ROVehicle, prohibited_withPermissions<ROEdge, ROVehicle> > router(
                         ROEdge::getAllEdges(), true, &ROEdge::getTravelTimeStatic,
                         begin, end, std::numeric_limits<int>::max(), 1);
                     ROVehicle defaultVehicle(SUMOVehicleParameter(), 0, net.getVehicleTypeSecure(DEFAULT_VTYPE_ID), &net);
-                    lookup = new AStar::LMLT(oc.getString("astar.landmark-distances"), ROEdge::getAllEdges(), &router, &defaultVehicle,
-                                             oc.isSet("astar.save-landmark-distances") ? oc.getString("astar.save-landmark-distances") : "", oc.getInt("routing-threads"));
+                    lookup = new AStar::LMLT(oc.isSet("astar.landmark-distances") ? oc.getString("astar.landmark-distances") : "",
+                                             ROEdge::getAllEdges(), &router, &defaultVehicle,
+                                             oc.isSet("astar.save-landmark-distances") ? oc.getString("astar.save-landmark-distances") : "", oc.getInt("routing-threads"),
+                                             AStar::LMLT::selectLandmarks(ROEdge::getAllEdges(), oc.getInt("astar.landmark-count")));
                 }
                 router = new AStar(ROEdge::getAllEdges(), oc.getBool("ignore-errors"), &ROEdge::getTravelTimeStatic, lookup);
             } else {
@@ -133,13 +143,15 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
                 const AStar::LookupTable* lookup = 0;
                 if (oc.isSet("astar.all-distances")) {
                     lookup = new AStar::FLT(oc.getString("astar.all-distances"), (int)ROEdge::getAllEdges().size());
-                } else if (oc.isSet("astar.landmark-distances")) {
+                } else if (oc.isSet("astar.landmark-distances") || oc.getInt("astar.landmark-count") > 0) {
                     CHRouterWrapper<ROEdge, ROVehicle, noProhibitions<ROEdge, ROVehicle> > router(
                         ROEdge::getAllEdges(), true, &ROEdge::getTravelTimeStatic,
                         begin, end, std::numeric_limits<int>::max(), 1);
                     ROVehicle defaultVehicle(SUMOVehicleParameter(), 0, net.getVehicleTypeSecure(DEFAULT_VTYPE_ID), &net);
-                    lookup = new AStar::LMLT(oc.getString("astar.landmark-distances"), ROEdge::getAllEdges(), &router, &defaultVehicle,
-                                             oc.isSet("astar.save-landmark-distances") ? oc.getString("astar.save-landmark-distances") : "", oc.getInt("routing-threads"));
+                    lookup = new AStar::LMLT(oc.isSet("astar.landmark-distances") ? oc.getString("astar.landmark-distances") : "",
+                                             ROEdge::getAllEdges(), &router, &defaultVehicle,
+                                             oc.isSet("astar.save-landmark-distances") ? oc.getString("astar.save-landmark-distances") : "", oc.getInt("routing-threads"),
+                                             AStar::LMLT::selectLandmarks(ROEdge::getAllEdges(), oc.getInt("astar.landmark-count")));
                 }
                 router = new AStar(ROEdge::getAllEdges(), oc.getBool("ignore-errors"), &ROEdge::getTravelTimeStatic, lookup);
             }
@@ -148,11 +160,31 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
                                            string2time(oc.getString("weight-period")) :
                                            std::numeric_limits<int>::max());
             if (net.hasPermissions()) {
-                router = new CHRouter<ROEdge, ROVehicle, prohibited_withPermissions<ROEdge, ROVehicle> >(
-                    ROEdge::getAllEdges(), oc.getBool("ignore-errors"), &ROEdge::getTravelTimeStatic, SVC_IGNORING, weightPeriod, true);
+                typedef CHRouter<ROEdge, ROVehicle, prohibited_withPermissions<ROEdge, ROVehicle> > CH;
+                CH* chrouter;
+                if (oc.isSet("ch.hierarchy-input")) {
+                    chrouter = new CH(ROEdge::getAllEdges(), oc.getBool("ignore-errors"), &ROEdge::getTravelTimeStatic, SVC_IGNORING, weightPeriod,
+                                      CH::loadHierarchy(oc.getString("ch.hierarchy-input"), ROEdge::getAllEdges(), SVC_IGNORING));
+                } else {
+                    chrouter = new CH(ROEdge::getAllEdges(), oc.getBool("ignore-errors"), &ROEdge::getTravelTimeStatic, SVC_IGNORING, weightPeriod, true);
+                    if (oc.isSet("ch.save-hierarchy")) {
+                        chrouter->setHierarchyOutput(oc.getString("ch.save-hierarchy"));
+                    }
+                }
+                router = chrouter;
             } else {
-                router = new CHRouter<ROEdge, ROVehicle, noProhibitions<ROEdge, ROVehicle> >(
-                    ROEdge::getAllEdges(), oc.getBool("ignore-errors"), &ROEdge::getTravelTimeStatic, SVC_IGNORING, weightPeriod, false);
+                typedef CHRouter<ROEdge, ROVehicle, noProhibitions<ROEdge, ROVehicle> > CH;
+                CH* chrouter;
+                if (oc.isSet("ch.hierarchy-input")) {
+                    chrouter = new CH(ROEdge::getAllEdges(), oc.getBool("ignore-errors"), &ROEdge::getTravelTimeStatic, SVC_IGNORING, weightPeriod,
+                                      CH::loadHierarchy(oc.getString("ch.hierarchy-input"), ROEdge::getAllEdges(), SVC_IGNORING));
+                } else {
+                    chrouter = new CH(ROEdge::getAllEdges(), oc.getBool("ignore-errors"), &ROEdge::getTravelTimeStatic, SVC_IGNORING, weightPeriod, false);
+                    if (oc.isSet("ch.save-hierarchy")) {
+                        chrouter->setHierarchyOutput(oc.getString("ch.save-hierarchy"));
+                    }
+                }
+                router = chrouter;
             }
         } else if (routingAlgorithm == "CHWrapper") {
             const SUMOTime weightPeriod = (oc.isSet("weight-files") ?
@@ -126,6 +126,7 @@ FXDEFMAP(GUIApplicationWindow) GUIApplicationWindowMap[] = {
     FXMAPFUNC(SEL_COMMAND,  MID_START,              GUIApplicationWindow::onCmdStart),
     FXMAPFUNC(SEL_COMMAND,  MID_STOP,               GUIApplicationWindow::onCmdStop),
     FXMAPFUNC(SEL_COMMAND,  MID_STEP,               GUIApplicationWindow::onCmdStep),
+    FXMAPFUNC(SEL_COMMAND,  MID_SKIPTO,             GUIApplicationWindow::onCmdSkipTo),
     FXMAPFUNC(SEL_COMMAND,  MID_TIME_TOOGLE,        GUIApplicationWindow::onCmdTimeToggle),
     FXMAPFUNC(SEL_COMMAND,  MID_DELAY_TOOGLE,       GUIApplicationWindow::onCmdDelayToggle),
     FXMAPFUNC(SEL_COMMAND,  MID_CLEARMESSAGEWINDOW, GUIApplicationWindow::onCmdClearMsgWindow),
@@ -147,6 +148,7 @@ FXDEFMAP(GUIApplicationWindow) GUIApplicationWindowMap[] = {
     FXMAPFUNC(SEL_UPDATE,   MID_START,             GUIApplicationWindow::onUpdStart),
     FXMAPFUNC(SEL_UPDATE,   MID_STOP,              GUIApplicationWindow::onUpdStop),
     FXMAPFUNC(SEL_UPDATE,   MID_STEP,              GUIApplicationWindow::onUpdStep),
+    FXMAPFUNC(SEL_UPDATE,   MID_SKIPTO,            GUIApplicationWindow::onUpdStart),
     FXMAPFUNC(SEL_UPDATE,   MID_EDITCHOSEN,        GUIApplicationWindow::onUpdNeedsSimulation),
     FXMAPFUNC(SEL_UPDATE,   MID_EDIT_BREAKPOINTS,  GUIApplicationWindow::onUpdNeedsSimulation),
     FXMAPFUNC(SEL_UPDATE,   MID_NETEDIT,           GUIApplicationWindow::onUpdNeedsSimulation),
@@ -498,6 +500,9 @@ GUIApplicationWindow::fillMenuBar() {
     new FXMenuCommand(myControlMenu,
                       "Step\tCtrl+D\tPerform one simulation step.",
                       GUIIconSubSys::getIcon(ICON_STEP), this, MID_STEP);
+    new FXMenuCommand(myControlMenu,
+                      "Run to Time...\t\tRun the simulation at full speed up to a given time, suspending the view updates on the way.",
+                      NULL, this, MID_SKIPTO);
 
     // build windows menu
     myWindowsMenu = new FXMenuPane(this);
@@ -909,6 +914,39 @@ GUIApplicationWindow::onCmdStart(FXObject*, FXSelector, void*) {
 }
 
 
+long
+GUIApplicationWindow::onCmdSkipTo(FXObject*, FXSelector, void*) {
+    // check whether a net was loaded successfully
+    if (!myRunThread->simulationAvailable()) {
+        myStatusbar->getStatusLine()->setText("No simulation loaded!");
+        return 1;
+    }
+    FXString timeStr(time2string(myRunThread->getNet().getCurrentTimeStep()).c_str());
+    if (!FXInputDialog::getString(timeStr, this, "Run to Time", "Run without view updates until time:")) {
+        return 1;
+    }
+    SUMOTime skipTo;
+    try {
+        skipTo = string2time(timeStr.text());
+    } catch (ProcessError& e) {
+        myStatusbar->getStatusLine()->setText(e.what());
+        return 1;
+    }
+    if (skipTo <= myRunThread->getNet().getCurrentTimeStep()) {
+        myStatusbar->getStatusLine()->setText("The given time lies in the past!");
+        return 1;
+    }
+    // check whether it was started before and paused;
+    if (!myWasStarted) {
+        myRunThread->begin();
+        myWasStarted = true;
+    }
+    myRunThread->skipTo(skipTo);
+    getApp()->forceRefresh(); // only callking myToolBar2->forceRefresh somehow loses keyboard focus
+    return 1;
+}
+
+
 long
 GUIApplicationWindow::onCmdStop(FXObject*, FXSelector, void*) {
     myRunThread->stop();
@@ -1185,6 +1223,7 @@ GUIApplicationWindow::onRunThreadEvent(FXObject*, FXSelector, void*) {
 
 void
 GUIApplicationWindow::eventOccured() {
+    bool simStepPending = false;
     while (!myEvents.empty()) {
         // get the next event
         GUIEvent* e = myEvents.top();
@@ -1195,9 +1234,9 @@ GUIApplicationWindow::eventOccured() {
                 handleEvent_SimulationLoaded(e);
                 break;
             case EVENT_SIMULATION_STEP:
-                if (myRunThread->simulationAvailable()) { // avoid race-condition related crash if reload was pressed
-                    handleEvent_SimulationStep(e);
-                }
+                // only the current state can be visualised anyway so when the
+                //  simulation thread has outpaced the gui, update only once
+                simStepPending = true;
                 break;
             case EVENT_MESSAGE_OCCURED:
             case EVENT_WARNING_OCCURED:
@@ -1216,6 +1255,9 @@ GUIApplicationWindow::eventOccured() {
         }
         delete e;
     }
+    if (simStepPending && myRunThread->simulationAvailable()) { // avoid race-condition related crash if reload was pressed
+        handleEvent_SimulationStep(0);
+    }
     myToolBar2->forceRefresh();
     myToolBar3->forceRefresh();
 }
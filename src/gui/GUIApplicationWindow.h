@@ -195,6 +195,9 @@ public:
     /// @brief Called on "step"
     long onCmdStep(FXObject*, FXSelector, void*);
 
+    /// @brief Called on "run to time"
+    long onCmdSkipTo(FXObject*, FXSelector, void*);
+
     /// @brief Called on "time toggle"
     long onCmdTimeToggle(FXObject*, FXSelector, void*);
 
@@ -64,7 +64,7 @@ GUIRunThread::GUIRunThread(FXApp* app, MFXInterThreadEventClient* parent,
                            FXEX::FXThreadEvent& ev)
     : FXSingleEventThread(app, parent),
       myNet(0), myHalting(true), myQuit(false), mySimulationInProgress(false), myOk(true), myHaveSignaledEnd(false),
-      mySimDelay(simDelay), myEventQue(eq), myEventThrow(ev) {
+      mySkipUntil(-1), mySimDelay(simDelay), myEventQue(eq), myEventThrow(ev) {
     myErrorRetriever = new MsgRetrievingFunction<GUIRunThread>(this, &GUIRunThread::retrieveMessage, MsgHandler::MT_ERROR);
     myMessageRetriever = new MsgRetrievingFunction<GUIRunThread>(this, &GUIRunThread::retrieveMessage, MsgHandler::MT_MESSAGE);
     myWarningRetriever = new MsgRetrievingFunction<GUIRunThread>(this, &GUIRunThread::retrieveMessage, MsgHandler::MT_WARNING);
@@ -147,8 +147,8 @@ GUIRunThread::run() {
             if (haltAfter) {
                 stop();
             }
-            // wait if wanted
-            long wait = (long)mySimDelay;
+            // wait if wanted (but not during a fast-forward)
+            long wait = mySkipUntil >= 0 ? 0 : (long)mySimDelay;
             if (getNet().logSimulationDuration()) {
                 end = SysUtils::getCurrentMillis();
                 getNet().setSimDuration((int)(end - beg));
@@ -177,13 +177,21 @@ GUIRunThread::makeStep() {
     try {
         mySimulationLock.lock();
         myNet->simulationStep();
-        myNet->guiSimulationStep();
+        const bool skipping = mySkipUntil >= 0 && myNet->getCurrentTimeStep() < mySkipUntil;
+        if (!skipping) {
+            // while fast-forwarding the value passing to trackers is suspended as well
+            myNet->guiSimulationStep();
+            mySkipUntil = -1;
+        }
         mySimulationLock.unlock();
 
         // inform parent that a step has been performed
-        e = new GUIEvent_SimulationStep();
-        myEventQue.add(e);
-        myEventThrow.signal();
+        //  during a fast-forward only once per simulated minute so the clock still advances
+        if (!skipping || myNet->getCurrentTimeStep() % TIME2STEPS(60) < DELTA_T) {
+            e = new GUIEvent_SimulationStep();
+            myEventQue.add(e);
+            myEventThrow.signal();
+        }
 
         e = 0;
         MSNet::SimulationState state = myNet->simulationState(mySimEndTime);
@@ -265,6 +273,14 @@ GUIRunThread::singleStep() {
 }
 
 
+void
+GUIRunThread::skipTo(SUMOTime time) {
+    mySkipUntil = time;
+    mySingle = false;
+    myHalting = false;
+}
+
+
 void
 GUIRunThread::begin() {
     // report the begin when wished
@@ -276,6 +292,7 @@ GUIRunThread::begin() {
 void
 GUIRunThread::stop() {
     mySingle = false;
+    mySkipUntil = -1;
     myHalting = true;
 }
 
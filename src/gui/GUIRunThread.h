@@ -81,6 +81,10 @@ public:
     this method allows the thread to perform a single simulation step */
     void singleStep();
 
+    /** runs the simulation at full speed up to the given time, suspending
+        gui updates and the simulation delay on the way */
+    void skipTo(SUMOTime time);
+
     /** starts the simulation (execution of one step after another) */
     virtual void begin();
 
@@ -158,6 +162,10 @@ protected:
     /// @brief whether the simulation already ended
     bool myHaveSignaledEnd;
 
+    /** the time up to which the simulation shall run without gui updates
+        (-1 if no fast-forward is in progress) */
+    SUMOTime mySkipUntil;
+
     /** @brief The instances of message retriever encapsulations
         Needed to be deleted from the handler later on */
     OutputDevice* myErrorRetriever, *myMessageRetriever, *myWarningRetriever;
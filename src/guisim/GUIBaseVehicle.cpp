@@ -869,6 +869,19 @@ GUIBaseVehicle::drawOnPos(const GUIVisualizationSettings& s, const Position& pos
     glPushMatrix();
     Position p1 = pos;
     const double degAngle = RAD2DEG(angle + M_PI / 2.);
+    const double upscale = s.vehicleSize.getExaggeration(s);
+    if (s.scale * upscale < 5. && !s.drawForSelecting) {
+        // a few pixels per meter leave no discernible detail; a colored box
+        //  keeps metro-scale networks with many visible vehicles responsive
+        glTranslated(p1.x(), p1.y(), getType());
+        glRotated(degAngle, 0, 0, 1);
+        setColor(s);
+        glScaled(upscale, upscale, 1);
+        drawAction_drawVehicleAsBoxPlus();
+        glPopMatrix();
+        glPopName();
+        return;
+    }
     // one seat in the center of the vehicle by default
     if (myVehicle.getLane() != 0) {
         mySeatPositions[0] = myVehicle.getPosition(- getVType().getLength() / 2);
@@ -880,7 +893,6 @@ GUIBaseVehicle::drawOnPos(const GUIVisualizationSettings& s, const Position& pos
     // set lane color
     setColor(s);
     // scale
-    const double upscale = s.vehicleSize.getExaggeration(s);
     glScaled(upscale, upscale, 1);
     /*
         MSLCM_DK2004 &m2 = static_cast<MSLCM_DK2004&>(veh->getLaneChangeModel());
@@ -216,6 +216,14 @@ GUIEdge::drawGL(const GUIVisualizationSettings& s) const {
     }
     glPushName(getGlID());
     // draw the lanes
+    // below one pixel of lane width all lanes of this edge overlap on screen,
+    //  so a single representative lane suffices; this keeps the frame rate
+    //  usable on metro-scale networks when fully zoomed out
+    const bool drawAsOneLane = !MSGlobals::gUseMesoSim && !s.drawForSelecting
+                               && myLanes->size() > 1
+                               && s.laneScaler.getActive() == 0
+                               && s.scale * s.laneWidthExaggeration < 1.
+                               && s.scale * s.vehicleSize.getExaggeration(s) <= s.vehicleSize.minSize;
     for (std::vector<MSLane*>::const_iterator i = myLanes->begin(); i != myLanes->end(); ++i) {
         if (MSGlobals::gUseMesoSim) {
             setColor(s);
@@ -223,6 +231,9 @@ GUIEdge::drawGL(const GUIVisualizationSettings& s) const {
         GUILane* l = dynamic_cast<GUILane*>(*i);
         if (l != 0) {
             l->drawGL(s);
+            if (drawAsOneLane) {
+                break;
+            }
         }
     }
     if (MSGlobals::gUseMesoSim) {
@@ -60,7 +60,10 @@
 // ===========================================================================
 GUIJunctionWrapper::GUIJunctionWrapper(MSJunction& junction)
     : GUIGlObject(GLO_JUNCTION, junction.getID()),
-      myJunction(junction) {
+      myJunction(junction),
+      myDisplayList(0),
+      myDisplayListExaggeration(-1.),
+      myDisplayListTesselated(false) {
     if (myJunction.getShape().size() == 0) {
         Position pos = myJunction.getPosition();
         myBoundary = Boundary(pos.x() - 1., pos.y() - 1., pos.x() + 1., pos.y() + 1.);
@@ -85,7 +88,11 @@ GUIJunctionWrapper::GUIJunctionWrapper(MSJunction& junction)
 }
 
 
-GUIJunctionWrapper::~GUIJunctionWrapper() {}
+GUIJunctionWrapper::~GUIJunctionWrapper() {
+    if (myDisplayList != 0) {
+        glDeleteLists(myDisplayList, 1);
+    }
+}
 
 
 GUIGLObjectPopupMenu*
@@ -139,19 +146,48 @@ GUIJunctionWrapper::drawGL(const GUIVisualizationSettings& s) const {
         glGetFloatv(GL_CURRENT_COLOR, color);
         const double exaggeration = s.junctionSize.getExaggeration(s);
         if (color[3] != 0 && s.scale * exaggeration > s.junctionSize.minSize) {
-            PositionVector shape = myJunction.getShape();
-            shape.closePolygon();
-            if (exaggeration > 1) {
-                shape.scaleRelative(exaggeration);
-            }
             glTranslated(0, 0, getType());
-            if (s.scale * myMaxSize < 40.) {
-                GLHelper::drawFilledPoly(shape, true);
+            // the (possibly tesselated) shape is static so it is compiled once
+            //  into a display list and replayed with a single call until the
+            //  drawing parameters change; the color is set outside
+            const bool tesselated = s.scale * myMaxSize >= 40.;
+            if (myDisplayList == 0 || exaggeration != myDisplayListExaggeration || tesselated != myDisplayListTesselated) {
+                if (myDisplayList == 0) {
+                    myDisplayList = glGenLists(1);
+                }
+                if (myDisplayList != 0) {
+                    PositionVector shape = myJunction.getShape();
+                    shape.closePolygon();
+                    if (exaggeration > 1) {
+                        shape.scaleRelative(exaggeration);
+                    }
+                    glNewList(myDisplayList, GL_COMPILE);
+                    if (tesselated) {
+                        GLHelper::drawFilledPolyTesselated(shape, true);
+                    } else {
+                        GLHelper::drawFilledPoly(shape, true);
+                    }
+                    glEndList();
+                    myDisplayListExaggeration = exaggeration;
+                    myDisplayListTesselated = tesselated;
+                }
+            }
+            if (myDisplayList != 0) {
+                glCallList(myDisplayList);
             } else {
-                GLHelper::drawFilledPolyTesselated(shape, true);
+                PositionVector shape = myJunction.getShape();
+                shape.closePolygon();
+                if (exaggeration > 1) {
+                    shape.scaleRelative(exaggeration);
+                }
+                if (tesselated) {
+                    GLHelper::drawFilledPolyTesselated(shape, true);
+                } else {
+                    GLHelper::drawFilledPoly(shape, true);
+                }
             }
 #ifdef GUIJunctionWrapper_DEBUG_DRAW_NODE_SHAPE_VERTICES
-            GLHelper::debugVertices(shape, 80 / s.scale);
+            GLHelper::debugVertices(myJunction.getShape(), 80 / s.scale);
 #endif
         }
         glPopName();
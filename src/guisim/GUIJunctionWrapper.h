@@ -164,6 +164,15 @@ private:
     /// @brief whether this junction has only waterways as incoming and outgoing edges
     bool myAmWaterway;
 
+    /// @brief Display list holding the compiled junction shape (0 if none was built yet)
+    mutable unsigned int myDisplayList;
+
+    /// @name The drawing parameters the display list was compiled for
+    /// @{
+    mutable double myDisplayListExaggeration;
+    mutable bool myDisplayListTesselated;
+    /// @}
+
 #ifdef HAVE_OSG
     osg::Geometry* myGeom;
 #endif
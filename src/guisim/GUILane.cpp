@@ -77,7 +77,14 @@ GUILane::GUILane(const std::string& id, double maxSpeed, double length,
                  SVCPermissions permissions, int index, bool isRampAccel) :
     MSLane(id, maxSpeed, length, edge, numericalID, shape, width, permissions, index, isRampAccel),
     GUIGlObject(GLO_LANE, id),
-    myAmClosed(false) {
+    myAmClosed(false),
+    myDisplayList(0),
+    myDisplayListWidth(-1.),
+    myDisplayListDetail(-1),
+    myDisplayListOffset(0.),
+    myCachedColorValue(0.),
+    myCachedColorScheme(-1),
+    myCachedColorTime(-1) {
     if (MSGlobals::gUseMesoSim) {
         myShape = splitAtSegments(shape);
         assert(fabs(myShape.length() - shape.length()) < POSITION_EPS);
@@ -104,6 +111,9 @@ GUILane::~GUILane() {
     if (myLock.locked()) {
         myLock.unlock();
     }
+    if (myDisplayList != 0) {
+        glDeleteLists(myDisplayList, 1);
+    }
 }
 
 
@@ -524,7 +534,28 @@ GUILane::drawGL(const GUIVisualizationSettings& s) const {
                 if (myShapeColors.size() > 0) {
                     GLHelper::drawBoxLines(myShape, myShapeRotations, myShapeLengths, myShapeColors, halfWidth * exaggeration, cornerDetail, offset);
                 } else {
-                    GLHelper::drawBoxLines(myShape, myShapeRotations, myShapeLengths, halfWidth * exaggeration, cornerDetail, offset);
+                    // the geometry is static so it is compiled once into a
+                    //  display list and replayed with a single call until the
+                    //  drawing parameters change; the color is set outside
+                    const double width = halfWidth * exaggeration;
+                    if (myDisplayList == 0 || width != myDisplayListWidth || cornerDetail != myDisplayListDetail || offset != myDisplayListOffset) {
+                        if (myDisplayList == 0) {
+                            myDisplayList = glGenLists(1);
+                        }
+                        if (myDisplayList != 0) {
+                            glNewList(myDisplayList, GL_COMPILE);
+                            GLHelper::drawBoxLines(myShape, myShapeRotations, myShapeLengths, width, cornerDetail, offset);
+                            glEndList();
+                            myDisplayListWidth = width;
+                            myDisplayListDetail = cornerDetail;
+                            myDisplayListOffset = offset;
+                        }
+                    }
+                    if (myDisplayList != 0) {
+                        glCallList(myDisplayList);
+                    } else {
+                        GLHelper::drawBoxLines(myShape, myShapeRotations, myShapeLengths, width, cornerDetail, offset);
+                    }
                 }
             }
 #ifdef GUILane_DEBUG_DRAW_VERTICES
@@ -940,6 +971,34 @@ GUILane::setMultiColor(const GUIColorer& c) const {
 
 double
 GUILane::getColorValue(int activeScheme) const {
+    switch (activeScheme) {
+        case 4:
+        case 5:
+        case 6:
+        case 8:
+        case 9:
+        case 10:
+        case 11:
+        case 12:
+        case 13:
+        case 14:
+        case 25:
+        case 26:
+        case 28: {
+            // these sweep over the vehicle container but only change when the
+            //  simulation advances; reuse the value for repeated redraws
+            //  (multiple views, paused simulation) within the same step
+            const SUMOTime now = MSNet::getInstance()->getCurrentTimeStep();
+            if (myCachedColorScheme != activeScheme || myCachedColorTime != now) {
+                myCachedColorValue = computeVehicleColorValue(activeScheme);
+                myCachedColorScheme = activeScheme;
+                myCachedColorTime = now;
+            }
+            return myCachedColorValue;
+        }
+        default:
+            break;
+    }
     switch (activeScheme) {
         case 0:
             switch (myPermissions) {
@@ -969,28 +1028,8 @@ GUILane::getColorValue(int activeScheme) const {
             return (double)myPermissions;
         case 3:
             return getSpeedLimit();
-        case 4:
-            return getBruttoOccupancy();
-        case 5:
-            return getNettoOccupancy();
-        case 6:
-            return firstWaitingTime();
         case 7:
             return getEdgeLaneNumber();
-        case 8:
-            return getCO2Emissions() / myLength;
-        case 9:
-            return getCOEmissions() / myLength;
-        case 10:
-            return getPMxEmissions() / myLength;
-        case 11:
-            return getNOxEmissions() / myLength;
-        case 12:
-            return getHCEmissions() / myLength;
-        case 13:
-            return getFuelConsumption() / myLength;
-        case 14:
-            return getHarmonoise_NoiseEmissions();
         case 15: {
             return getStoredEdgeTravelTime();
         }
@@ -1022,6 +1061,40 @@ GUILane::getColorValue(int activeScheme) const {
             // color by incline
             return (getShape()[-1].z() - getShape()[0].z()) / getLength();
         }
+        case 27: {
+            // color by routing device assumed speed
+            return myEdge->getRoutingSpeed();
+        }
+        case 29:
+            return MSNet::getInstance()->getInsertionControl().getPendingEmits(this);
+    }
+    return 0;
+}
+
+
+double
+GUILane::computeVehicleColorValue(int activeScheme) const {
+    switch (activeScheme) {
+        case 4:
+            return getBruttoOccupancy();
+        case 5:
+            return getNettoOccupancy();
+        case 6:
+            return firstWaitingTime();
+        case 8:
+            return getCO2Emissions() / myLength;
+        case 9:
+            return getCOEmissions() / myLength;
+        case 10:
+            return getPMxEmissions() / myLength;
+        case 11:
+            return getNOxEmissions() / myLength;
+        case 12:
+            return getHCEmissions() / myLength;
+        case 13:
+            return getFuelConsumption() / myLength;
+        case 14:
+            return getHarmonoise_NoiseEmissions();
         case 25: {
             // color by average speed
             return getMeanSpeed();
@@ -1030,14 +1103,8 @@ GUILane::getColorValue(int activeScheme) const {
             // color by average relative speed
             return getMeanSpeed() / myMaxSpeed;
         }
-        case 27: {
-            // color by routing device assumed speed
-            return myEdge->getRoutingSpeed();
-        }
         case 28:
             return getElectricityConsumption() / myLength;
-        case 29:
-            return MSNet::getInstance()->getInsertionControl().getPendingEmits(this);
     }
     return 0;
 }
@@ -301,6 +301,9 @@ private:
     /// @brief gets the scaling value according to the current scheme index
     double getScaleValue(int activeScheme) const;
 
+    /// @brief computes the color value for schemes which sweep over the vehicle container
+    double computeVehicleColorValue(int activeScheme) const;
+
     /// @brief sets the color according to the current scheme index and some lane function
     bool setFunctionalColor(int activeScheme) const;
 
@@ -344,6 +347,24 @@ private:
     /// @brief state for dynamic lane closings
     bool myAmClosed;
 
+    /// @brief Display list holding the compiled lane geometry (0 if none was built yet)
+    mutable unsigned int myDisplayList;
+
+    /// @name The drawing parameters the display list was compiled for
+    /// @{
+    mutable double myDisplayListWidth;
+    mutable int myDisplayListDetail;
+    mutable double myDisplayListOffset;
+    /// @}
+
+    /// @name Cache for color values which sweep over the vehicle container
+    ///  (they only change when the simulation advances but are queried on every redraw)
+    /// @{
+    mutable double myCachedColorValue;
+    mutable int myCachedColorScheme;
+    mutable SUMOTime myCachedColorTime;
+    /// @}
+
 private:
     /// The mutex used to avoid concurrent updates of the vehicle buffer
     mutable MFXMutex myLock;
@@ -56,8 +56,9 @@ void
 ROJTREdge::addSuccessor(ROEdge* s, std::string) {
     ROEdge::addSuccessor(s);
     ROJTREdge* js = static_cast<ROJTREdge*>(s);
-    if (myFollowingDefs.find(js) == myFollowingDefs.end()) {
-        myFollowingDefs[js] = new ValueTimeLine<double>();
+    FollowerUsageCont::iterator i = std::lower_bound(myFollowingDefs.begin(), myFollowingDefs.end(), js, &followerBefore);
+    if (i == myFollowingDefs.end() || i->first != js) {
+        myFollowingDefs.insert(i, std::make_pair(js, new ValueTimeLine<double>()));
     }
 }
 
@@ -65,8 +66,8 @@ ROJTREdge::addSuccessor(ROEdge* s, std::string) {
 void
 ROJTREdge::addFollowerProbability(ROJTREdge* follower, double begTime,
                                   double endTime, double probability) {
-    FollowerUsageCont::iterator i = myFollowingDefs.find(follower);
-    if (i == myFollowingDefs.end()) {
+    FollowerUsageCont::iterator i = std::lower_bound(myFollowingDefs.begin(), myFollowingDefs.end(), follower, &followerBefore);
+    if (i == myFollowingDefs.end() || i->first != follower) {
         WRITE_ERROR("The edges '" + getID() + "' and '" + follower->getID() + "' are not connected.");
         return;
     }
@@ -75,19 +76,21 @@ ROJTREdge::addFollowerProbability(ROJTREdge* follower, double begTime,
 
 
 ROJTREdge*
-ROJTREdge::chooseNext(const ROVehicle* const veh, double time, const std::set<const ROEdge*>& avoid) const {
+ROJTREdge::chooseNext(const ROVehicle* const veh, double time, const std::set<const ROEdge*>& avoid,
+                      RandomDistributor<ROJTREdge*>& dist) const {
     // if no usable follower exist, return 0
     //  their probabilities are not yet regarded
     if (myFollowingEdges.size() == 0 || (veh != 0 && allFollowersProhibit(veh))) {
         return 0;
     }
     // gather information about the probabilities at this time
-    RandomDistributor<ROJTREdge*> dist;
+    dist.clear();
     // use the loaded definitions, first
     for (FollowerUsageCont::const_iterator i = myFollowingDefs.begin(); i != myFollowingDefs.end(); ++i) {
         if (avoid.count(i->first) == 0) {
             if ((veh == 0 || !(*i).first->prohibits(veh)) && (*i).second->describesTime(time)) {
-                dist.add((*i).first, (*i).second->getValue(time));
+                // the followers are pairwise distinct by construction
+                dist.add((*i).first, (*i).second->getValue(time), false);
             }
         }
     }
@@ -96,7 +99,7 @@ ROJTREdge::chooseNext(const ROVehicle* const veh, double time, const std::set<co
         for (int i = 0; i < (int)myParsedTurnings.size(); ++i) {
             if (avoid.count(myFollowingEdges[i]) == 0) {
                 if (veh == 0 || !myFollowingEdges[i]->prohibits(veh)) {
-                    dist.add(static_cast<ROJTREdge*>(myFollowingEdges[i]), myParsedTurnings[i]);
+                    dist.add(static_cast<ROJTREdge*>(myFollowingEdges[i]), myParsedTurnings[i], false);
                 }
             }
         }
@@ -110,6 +113,12 @@ ROJTREdge::chooseNext(const ROVehicle* const veh, double time, const std::set<co
 }
 
 
+bool
+ROJTREdge::followerBefore(const std::pair<ROJTREdge*, ValueTimeLine<double>*>& item, const ROJTREdge* follower) {
+    return item.first->getID() < follower->getID();
+}
+
+
 void
 ROJTREdge::setTurnDefaults(const std::vector<double>& defs) {
     // I hope, we'll find a less ridiculous solution for this
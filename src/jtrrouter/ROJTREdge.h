@@ -32,9 +32,10 @@
 #endif
 
 #include <string>
-#include <map>
 #include <vector>
+#include <utility>
 #include <utils/common/ValueTimeLine.h>
+#include <utils/distribution/RandomDistributor.h>
 #include <router/ROEdge.h>
 
 
@@ -98,9 +99,11 @@ public:
      * @param[in] veh The vehicle to choose the next edge for
      * @param[in] time The time at which the next edge shall be entered (in seconds)
      * @param[in] avoid The set of edges to avoid
+     * @param[in] dist The caller's distribution to reuse as work buffer (avoids an allocation per choice)
      * @return The chosen edge
      */
-    ROJTREdge* chooseNext(const ROVehicle* const veh, double time, const std::set<const ROEdge*>& avoid) const;
+    ROJTREdge* chooseNext(const ROVehicle* const veh, double time, const std::set<const ROEdge*>& avoid,
+                          RandomDistributor<ROJTREdge*>& dist) const;
 
 
     /** @brief Sets the turning definition defaults
@@ -110,12 +113,15 @@ public:
 
 
 private:
-    /// @brief Definition of a map that stores the probabilities of using a certain follower over time
-    typedef std::map<ROJTREdge*, ValueTimeLine<double>*, Named::ComparatorIdLess> FollowerUsageCont;
+    /// @brief Definition of a flat container that stores the probabilities of using a certain follower over time, sorted by follower id
+    typedef std::vector<std::pair<ROJTREdge*, ValueTimeLine<double>*> > FollowerUsageCont;
 
     /// @brief Storage for the probabilities of using a certain follower over time
     FollowerUsageCont myFollowingDefs;
 
+    /// @brief Comparator for keeping myFollowingDefs sorted by follower id
+    static bool followerBefore(const std::pair<ROJTREdge*, ValueTimeLine<double>*>& item, const ROJTREdge* follower);
+
     /// @brief The defaults for turnings
     std::vector<double> myParsedTurnings;
 
@@ -66,7 +66,7 @@ ROJTRRouter::compute(const ROEdge* from, const ROEdge* to,
             avoidEdges.insert(current);
         }
         timeS += current->getTravelTime(vehicle, timeS);
-        current = current->chooseNext(myIgnoreClasses ? 0 : vehicle, timeS, avoidEdges);
+        current = current->chooseNext(myIgnoreClasses ? 0 : vehicle, timeS, avoidEdges, myDistribution);
         assert(myIgnoreClasses || current == 0 || !current->prohibits(vehicle));
     }
     // check whether no valid ending edge was found
@@ -31,6 +31,7 @@
 #endif
 
 #include <utils/vehicle/SUMOAbstractRouter.h>
+#include <utils/distribution/RandomDistributor.h>
 #include <router/RORoutable.h>
 
 
@@ -112,6 +113,9 @@ private:
     /// @brief Whether a vehicle may reuse a road
     const bool myAllowLoops;
 
+    /// @brief Reused work buffer for sampling the next edge (each thread routes with its own clone)
+    RandomDistributor<ROJTREdge*> myDistribution;
+
 };
 
 
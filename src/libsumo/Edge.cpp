@@ -29,6 +29,10 @@
 
 
 namespace libsumo {
+std::vector<double> Edge::myLastMeanSpeeds;
+std::vector<double> Edge::myLastOccupancies;
+
+
 std::vector<std::string>
 Edge::getIDList() {
     std::vector<std::string> ids;
@@ -218,6 +222,50 @@ Edge::getOccupancy(const std::string& id) {
     return sum / (double)lanes.size();
 }
 
+void
+Edge::getAllAggregates(std::vector<double>& meanSpeeds, std::vector<double>& occupancies) {
+    const MSEdgeVector& edges = MSEdge::getAllEdges();
+    meanSpeeds.assign(edges.size(), 0.);
+    occupancies.assign(edges.size(), 0.);
+    for (auto edge : edges) {
+        const int index = edge->getNumericalID();
+        meanSpeeds[index] = edge->getMeanSpeed();
+        double sum = 0;
+        const std::vector<MSLane*>& lanes = edge->getLanes();
+        for (auto lane : lanes) {
+            sum += lane->getNettoOccupancy();
+        }
+        occupancies[index] = sum / (double)lanes.size();
+    }
+}
+
+void
+Edge::getChangedAggregates(std::vector<int>& indices, std::vector<double>& meanSpeeds, std::vector<double>& occupancies) {
+    std::vector<double> currMeanSpeeds;
+    std::vector<double> currOccupancies;
+    getAllAggregates(currMeanSpeeds, currOccupancies);
+    indices.clear();
+    meanSpeeds.clear();
+    occupancies.clear();
+    const bool first = myLastMeanSpeeds.size() != currMeanSpeeds.size();
+    for (int i = 0; i < (int)currMeanSpeeds.size(); ++i) {
+        if (first || currMeanSpeeds[i] != myLastMeanSpeeds[i] || currOccupancies[i] != myLastOccupancies[i]) {
+            indices.push_back(i);
+            meanSpeeds.push_back(currMeanSpeeds[i]);
+            occupancies.push_back(currOccupancies[i]);
+        }
+    }
+    myLastMeanSpeeds.swap(currMeanSpeeds);
+    myLastOccupancies.swap(currOccupancies);
+}
+
+
+void
+Edge::cleanup() {
+    myLastMeanSpeeds.clear();
+    myLastOccupancies.clear();
+}
+
 int
 Edge::getVehicleHaltingNumber(const std::string& id) {
     int halting = 0;
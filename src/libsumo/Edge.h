@@ -47,6 +47,23 @@ public:
     static int getVehicleNumber(const std::string& id);
     static double getMeanSpeed(const std::string& id);
     static double getOccupancy(const std::string& id);
+
+    /** @brief Fills numerical-id indexed arrays with mean speed and occupancy of all edges
+     *
+     * One call replaces a per-edge polling loop; the index of an entry is
+     * MSEdge::getNumericalID() of the edge.
+     */
+    static void getAllAggregates(std::vector<double>& meanSpeeds, std::vector<double>& occupancies);
+
+    /** @brief Like getAllAggregates but only delivers entries which changed since the previous call
+     *
+     * The numerical ids of the changed edges are returned in indices with
+     * their new values at the same position in the value arrays.
+     */
+    static void getChangedAggregates(std::vector<int>& indices, std::vector<double>& meanSpeeds, std::vector<double>& occupancies);
+
+    /// @brief Discards the previous values kept by getChangedAggregates (called when the net is destroyed, e.g. on load)
+    static void cleanup();
     static int getVehicleHaltingNumber(const std::string& id);
     static double getVehicleAverageLength(const std::string& id);
     static std::string getParameter(const std::string& id, const std::string& paramName);
@@ -58,6 +75,11 @@ public:
     static void setMaxSpeed(const std::string& id, double value);
     static void setParameter(const std::string& id, const std::string& name, const std::string& value);
     static void getShape(const std::string& id, PositionVector& shape);
+
+private:
+    /// @brief The aggregate values delivered by the previous call to getChangedAggregates
+    static std::vector<double> myLastMeanSpeeds;
+    static std::vector<double> myLastOccupancies;
 };
 }
 
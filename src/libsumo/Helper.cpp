@@ -27,7 +27,10 @@
 #include <config.h>
 #endif
 
+#include <cmath>
+#include <utils/common/StdDefs.h>
 #include <utils/geom/GeomHelper.h>
+#include <utils/geom/GeoConvHelper.h>
 #include <microsim/MSNet.h>
 #include <microsim/MSVehicleControl.h>
 #include <microsim/MSTransportableControl.h>
@@ -39,6 +42,7 @@
 #include <microsim/MSTransportable.h>
 #include <microsim/pedestrians/MSPerson.h>
 #include <libsumo/TraCIDefs.h>
+#include <libsumo/Edge.h>
 #include <libsumo/InductionLoop.h>
 #include <libsumo/Junction.h>
 #include <libsumo/POI.h>
@@ -100,6 +104,13 @@ namespace libsumo {
 // ===========================================================================
 std::map<int, NamedRTree*> Helper::myObjects;
 LANE_RTREE_QUAL* Helper::myLaneTree;
+const double Helper::GRID_CELL_SIZE = 100.;
+std::vector<std::vector<const MSVehicle*> > Helper::myVehicleGrid;
+int Helper::myGridCellsX = 0;
+int Helper::myGridCellsY = 0;
+double Helper::myGridXmin = 0.;
+double Helper::myGridYmin = 0.;
+SUMOTime Helper::myVehicleGridTime = -1;
 std::map<std::string, MSVehicle*> Helper::myRemoteControlledVehicles;
 std::map<std::string, MSPerson*> Helper::myRemoteControlledPersons;
 
@@ -190,24 +201,35 @@ Helper::getLaneChecking(const std::string& edgeID, int laneIndex, double pos) {
 
 std::pair<MSLane*, double>
 Helper::convertCartesianToRoadMap(Position pos) {
-    /// XXX use rtree instead
-    std::pair<MSLane*, double> result;
-    std::vector<std::string> allEdgeIds;
-    double minDistance = std::numeric_limits<double>::max();
-
-    allEdgeIds = MSNet::getInstance()->getEdgeControl().getEdgeNames();
-    for (std::vector<std::string>::iterator itId = allEdgeIds.begin(); itId != allEdgeIds.end(); itId++) {
-        const std::vector<MSLane*>& allLanes = MSEdge::dictionary((*itId))->getLanes();
-        for (std::vector<MSLane*>::const_iterator itLane = allLanes.begin(); itLane != allLanes.end(); itLane++) {
-            const double newDistance = (*itLane)->getShape().distance2D(pos);
+    // find the nearest lane via the static lane tree, widening the search
+    //  radius until a hit is found (correct because any lane closer than the
+    //  one found would intersect the grown query box as well)
+    std::pair<MSLane*, double> result(static_cast<MSLane*>(0), GeomHelper::INVALID_OFFSET);
+    PositionVector shape;
+    shape.push_back(pos);
+    const Boundary& netBounds = GeoConvHelper::getFinal().getConvBoundary();
+    const double maxRange = 1000. + netBounds.getWidth() + netBounds.getHeight() + pos.distanceTo2D(netBounds.getCenter());
+    double range = 1000.;
+    while (result.first == 0 && range < 2. * maxRange) {
+        // the final query is clamped to maxRange which covers the whole
+        //  network from the query position, so some lane is always found
+        std::set<std::string> laneIds;
+        collectObjectsInRange(CMD_GET_LANE_VARIABLE, shape, MIN2(range, maxRange), laneIds);
+        double minDistance = std::numeric_limits<double>::max();
+        for (std::set<std::string>::const_iterator it = laneIds.begin(); it != laneIds.end(); ++it) {
+            MSLane* const lane = MSLane::dictionary(*it);
+            const double newDistance = lane->getShape().distance2D(pos);
             if (newDistance < minDistance) {
                 minDistance = newDistance;
-                result.first = (*itLane);
+                result.first = lane;
             }
         }
+        range *= 2.;
+    }
+    if (result.first != 0) {
+        // @todo this may be a place where 3D is required but 2D is delivered
+        result.second = result.first->getShape().nearest_offset_to_point2D(pos, false);
     }
-    // @todo this may be a place where 3D is required but 2D is delivered
-    result.second = result.first->getShape().nearest_offset_to_point2D(pos, false);
     return result;
 }
 
@@ -219,11 +241,74 @@ Helper::cleanup() {
     myObjects.clear();
     delete myLaneTree;
     myLaneTree = 0;
+    myVehicleGrid.clear();
+    myVehicleGridTime = -1;
+    Edge::cleanup();
+}
+
+
+void
+Helper::updateVehicleGrid() {
+    const SUMOTime now = MSNet::getInstance()->getCurrentTimeStep();
+    if (myVehicleGridTime == now) {
+        return;
+    }
+    myVehicleGridTime = now;
+    if (myVehicleGrid.empty()) {
+        const Boundary& b = GeoConvHelper::getFinal().getConvBoundary();
+        myGridXmin = b.xmin();
+        myGridYmin = b.ymin();
+        myGridCellsX = MAX2(1, (int)ceil((b.xmax() - b.xmin()) / GRID_CELL_SIZE));
+        myGridCellsY = MAX2(1, (int)ceil((b.ymax() - b.ymin()) / GRID_CELL_SIZE));
+        myVehicleGrid.resize(myGridCellsX * myGridCellsY);
+    } else {
+        for (std::vector<std::vector<const MSVehicle*> >::iterator i = myVehicleGrid.begin(); i != myVehicleGrid.end(); ++i) {
+            (*i).clear();
+        }
+    }
+    MSVehicleControl& c = MSNet::getInstance()->getVehicleControl();
+    for (MSVehicleControl::constVehIt i = c.loadedVehBegin(); i != c.loadedVehEnd(); ++i) {
+        const MSVehicle* veh = dynamic_cast<const MSVehicle*>((*i).second);
+        if (veh != 0 && veh->isOnRoad()) {
+            // vehicles (slightly) outside the network are kept in the border cells
+            const Position& pos = veh->getPosition();
+            const int x = MAX2(0, MIN2(myGridCellsX - 1, (int)((pos.x() - myGridXmin) / GRID_CELL_SIZE)));
+            const int y = MAX2(0, MIN2(myGridCellsY - 1, (int)((pos.y() - myGridYmin) / GRID_CELL_SIZE)));
+            myVehicleGrid[y * myGridCellsX + x].push_back(veh);
+        }
+    }
+}
+
+
+void
+Helper::collectVehiclesInRange(const PositionVector& shape, const double range, std::set<std::string>& into) {
+    updateVehicleGrid();
+    const Boundary b = shape.getBoxBoundary().grow(range);
+    const int xmin = MAX2(0, MIN2(myGridCellsX - 1, (int)((b.xmin() - myGridXmin) / GRID_CELL_SIZE)));
+    const int xmax = MAX2(0, MIN2(myGridCellsX - 1, (int)((b.xmax() - myGridXmin) / GRID_CELL_SIZE)));
+    const int ymin = MAX2(0, MIN2(myGridCellsY - 1, (int)((b.ymin() - myGridYmin) / GRID_CELL_SIZE)));
+    const int ymax = MAX2(0, MIN2(myGridCellsY - 1, (int)((b.ymax() - myGridYmin) / GRID_CELL_SIZE)));
+    for (int y = ymin; y <= ymax; y++) {
+        for (int x = xmin; x <= xmax; x++) {
+            const std::vector<const MSVehicle*>& cell = myVehicleGrid[y * myGridCellsX + x];
+            for (std::vector<const MSVehicle*>::const_iterator j = cell.begin(); j != cell.end(); ++j) {
+                if (shape.distance2D((*j)->getPosition()) <= range) {
+                    into.insert((*j)->getID());
+                }
+            }
+        }
+    }
 }
 
 
 void
 Helper::collectObjectsInRange(int domain, const PositionVector& shape, double range, std::set<std::string>& into) {
+    if (domain == CMD_GET_VEHICLE_VARIABLE) {
+        // vehicles move every step; they are found via a uniform grid over
+        //  their current positions instead of the static lane tree
+        collectVehiclesInRange(shape, range, into);
+        return;
+    }
     // build the look-up tree if not yet existing
     if (myObjects.find(domain) == myObjects.end()) {
         switch (domain) {
@@ -268,8 +353,7 @@ Helper::collectObjectsInRange(int domain, const PositionVector& shape, double ra
         break;
         case CMD_GET_EDGE_VARIABLE:
         case CMD_GET_LANE_VARIABLE:
-        case CMD_GET_PERSON_VARIABLE:
-        case CMD_GET_VEHICLE_VARIABLE: {
+        case CMD_GET_PERSON_VARIABLE: {
             LaneStoringVisitor sv(into, shape, range, domain);
             myLaneTree->Search(cmin, cmax, sv);
         }
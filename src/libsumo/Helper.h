@@ -42,6 +42,7 @@ class RGBColor;
 class MSEdge;
 class MSLane;
 class MSPerson;
+class MSVehicle;
 
 
 // ===========================================================================
@@ -214,6 +215,24 @@ public:
     };
     /// @}
 
+private:
+    /** @brief Rebuilds the uniform grid over vehicle positions if outdated
+     *
+     * The grid is rebuilt (at most) once per simulation step, on the first
+     *  vehicle-domain context query of the step.
+     */
+    static void updateVehicleGrid();
+
+    /** @brief Adds the ids of all vehicles within range of the shape
+     *
+     * Queries the uniform grid instead of the static lane tree.
+     *
+     * @param[in] shape The shape to find vehicles around
+     * @param[in] range The maximum distance to the shape
+     * @param[out] into The container to add the ids to
+     */
+    static void collectVehiclesInRange(const PositionVector& shape, const double range, std::set<std::string>& into);
+
 private:
 
     SubscribedValues mySubscribedValues;
@@ -222,6 +241,23 @@ private:
     /// @brief A storage of objects
     static std::map<int, NamedRTree*> myObjects;
 
+    /// @brief The side length of a vehicle grid cell
+    static const double GRID_CELL_SIZE;
+
+    /// @brief Uniform grid over the positions of all driving vehicles
+    static std::vector<std::vector<const MSVehicle*> > myVehicleGrid;
+
+    /// @brief The number of vehicle grid cells in x- and y-direction
+    static int myGridCellsX;
+    static int myGridCellsY;
+
+    /// @brief The network coordinates of the vehicle grid origin
+    static double myGridXmin;
+    static double myGridYmin;
+
+    /// @brief The time the vehicle grid was built for
+    static SUMOTime myVehicleGridTime;
+
     /// @brief A storage of lanes
     static LANE_RTREE_QUAL* myLaneTree;
 
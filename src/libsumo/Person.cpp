@@ -55,7 +55,7 @@ Person::getIDList() {
             ids.push_back(i->first);
         }
     }
-    return std::move(ids);
+    return ids;
 }
 
 
@@ -65,6 +65,21 @@ Person::getIDCount() {
 }
 
 
+std::vector<std::string>
+Person::getWaitingByEdge(const std::string& edgeID) {
+    const MSEdge* const edge = MSEdge::dictionary(edgeID);
+    if (edge == 0) {
+        throw TraCIException("Unknown edge '" + edgeID + "'.");
+    }
+    const MSTransportableControl::TransportableVector& waiting = MSNet::getInstance()->getPersonControl().getWaiting(edge);
+    std::vector<std::string> ids;
+    for (MSTransportableControl::TransportableVector::const_iterator i = waiting.begin(); i != waiting.end(); ++i) {
+        ids.push_back((*i)->getID());
+    }
+    return ids;
+}
+
+
 TraCIPosition
 Person::getPosition(const std::string& personID) {
     MSTransportable* p = getPerson(personID);
@@ -54,6 +54,14 @@ class Person {
 public:
     static std::vector<std::string> getIDList();
     static int getIDCount();
+
+    /** @brief Returns the ids of all persons waiting for a ride on the given edge
+     *
+     * Backed by the per-edge waiting registry, so a dispatcher polling
+     * candidate edges pays for the waiting persons only instead of
+     * filtering the full person list.
+     */
+    static std::vector<std::string> getWaitingByEdge(const std::string& edgeID);
     static double getSpeed(const std::string& personID);
     static TraCIPosition getPosition(const std::string& personID);
     static std::string getRoadID(const std::string& personID);
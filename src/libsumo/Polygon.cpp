@@ -22,6 +22,7 @@
 // included modules
 // ===========================================================================
 #include <microsim/MSNet.h>
+#include <microsim/output/MSFCDExport.h>
 #include <utils/shapes/SUMOPolygon.h>
 #include <utils/shapes/ShapeContainer.h>
 
@@ -79,6 +80,8 @@ void Polygon::setShape(const std::string& polygonID, const TraCIPositionVector&
     getPolygon(polygonID); // just to check whether it exists
     ShapeContainer& shapeCont = MSNet::getInstance()->getShapeContainer();
     shapeCont.reshapePolygon(polygonID, positionVector);
+    // the fcd output may filter against this polygon
+    MSFCDExport::cleanup();
 }
 
 
@@ -95,6 +98,8 @@ Polygon::add(const std::string& polygonID, const TraCIPositionVector& shape, con
     if (!shapeCont.addPolygon(polygonID, type, col, (double)layer, Shape::DEFAULT_ANGLE, Shape::DEFAULT_IMG_FILE, pShape, false, fill)) {
         throw TraCIException("Could not add polygon '" + polygonID + "'");
     }
+    // the fcd output may filter against this polygon
+    MSFCDExport::cleanup();
 }
 
 
@@ -104,6 +109,8 @@ void Polygon::remove(const std::string& polygonID, int /* layer */) {
     if (!shapeCont.removePolygon(polygonID)) {
         throw TraCIException("Could not remove polygon '" + polygonID + "'");
     }
+    // the fcd output may filter against this polygon
+    MSFCDExport::cleanup();
 }
 
 
@@ -30,7 +30,9 @@
 #include <utils/common/StdDefs.h>
 #include <utils/common/StringTokenizer.h>
 #include <utils/common/StringUtils.h>
+#include <utils/common/RandHelper.h>
 #include <utils/geom/GeoConvHelper.h>
+#include <utils/options/OptionsCont.h>
 #include <utils/options/OptionsIO.h>
 #include <utils/xml/XMLSubSys.h>
 #include <microsim/MSNet.h>
@@ -40,6 +42,13 @@
 #include <microsim/MSLane.h>
 #include <microsim/MSVehicle.h>
 #include <microsim/MSVehicleControl.h>
+#include <microsim/MSVehicleTransfer.h>
+#include <microsim/MSRouteHandler.h>
+#include <microsim/MSEventControl.h>
+#include <microsim/devices/MSDevice.h>
+#include <microsim/output/MSDetectorControl.h>
+#include <microsim/traffic_lights/MSTLLogicControl.h>
+#include <microsim/traffic_lights/MSTrafficLightLogic.h>
 #include <microsim/MSStateHandler.h>
 #include <microsim/MSStoppingPlace.h>
 #include <netload/NLBuilder.h>
@@ -75,6 +84,58 @@ Simulation::simulationStep(const SUMOTime time) {
 }
 
 
+void
+Simulation::reset() {
+    MSNet* const net = MSNet::getInstance();
+    MSVehicleControl& c = net->getVehicleControl();
+    // remove all vehicles along the regular removal path
+    std::vector<std::string> ids;
+    for (MSVehicleControl::constVehIt i = c.loadedVehBegin(); i != c.loadedVehEnd(); ++i) {
+        ids.push_back(i->first);
+    }
+    for (std::vector<std::string>::const_iterator i = ids.begin(); i != ids.end(); ++i) {
+        MSVehicle* veh = dynamic_cast<MSVehicle*>(c.getVehicle(*i));
+        if (veh == 0) {
+            continue;
+        }
+        if (veh->hasDeparted()) {
+            MSVehicleTransfer::getInstance()->remove(veh);
+            veh->onRemovalFromNet(MSMoveReminder::NOTIFICATION_VAPORIZED);
+            if (veh->getLane() != 0) {
+                veh->getLane()->removeVehicle(veh, MSMoveReminder::NOTIFICATION_VAPORIZED);
+            }
+            c.scheduleVehicleRemoval(veh);
+        } else {
+            net->getInsertionControl().alreadyDeparted(veh);
+            c.deleteVehicle(veh, true);
+        }
+    }
+    std::string allRoutes = "";
+    net->getInsertionControl().clearPendingVehicles(allRoutes);
+    // discard collected detector values
+    net->getDetectorControl().reset();
+    // reinitialize the random number generators
+    RandHelper::initRandGlobal();
+    RandHelper::initRandGlobal(MSRouteHandler::getParsingRNG());
+    RandHelper::initRandGlobal(MSDevice::getEquipmentRNG());
+    const SUMOTime begin = string2time(OptionsCont::getOptions().getString("begin"));
+    // rewind the event calendars; pending events keep their absolute
+    //  execution times and fire again when the clock reaches them
+    net->getBeginOfTimestepEvents()->rewind(begin);
+    net->getEndOfTimestepEvents()->rewind(begin);
+    net->getInsertionEvents()->rewind(begin);
+    // restart the traffic light programs from their first phase
+    MSTLLogicControl& tlc = net->getTLSControl();
+    const std::vector<MSTrafficLightLogic*> logics = tlc.getAllLogics();
+    for (std::vector<MSTrafficLightLogic*>::const_iterator i = logics.begin(); i != logics.end(); ++i) {
+        (*i)->resetToBegin(tlc);
+    }
+    tlc.setTrafficLightSignals(begin);
+    // rewind the clock
+    net->setCurrentTimeStep(begin);
+}
+
+
 void
 Simulation::close() {
 }
@@ -154,6 +215,18 @@ Simulation::getMinExpectedNumber() {
 }
 
 
+bool
+Simulation::getGridlockAlarm() {
+    return MSNet::getInstance()->getGridlockAlarm();
+}
+
+
+std::vector<std::string>
+Simulation::getGridlockedJunctions() {
+    return MSNet::getInstance()->getGridlockedJunctions();
+}
+
+
 TraCIStage
 Simulation::findRoute(const std::string& from, const std::string& to, const std::string& typeID, const SUMOTime depart, const int routingMode) {
     UNUSED_PARAMETER(routingMode);
@@ -190,6 +263,54 @@ Simulation::findRoute(const std::string& from, const std::string& to, const std:
 }
 
 
+std::vector<TraCIStage>
+Simulation::findRouteBatch(const std::string& from, const std::vector<std::string>& toList, const std::string& typeID, const SUMOTime depart, const int routingMode) {
+    UNUSED_PARAMETER(routingMode);
+    std::vector<TraCIStage> result;
+    const MSEdge* const fromEdge = MSEdge::dictionary(from);
+    if (fromEdge == 0) {
+        throw TraCIException("Unknown from edge '" + from + "'.");
+    }
+    std::vector<const MSEdge*> toEdges;
+    for (const std::string& to : toList) {
+        const MSEdge* const toEdge = MSEdge::dictionary(to);
+        if (toEdge == 0) {
+            throw TraCIException("Unknown to edge '" + to + "'.");
+        }
+        toEdges.push_back(toEdge);
+    }
+    SUMOVehicle* vehicle = 0;
+    if (typeID != "") {
+        SUMOVehicleParameter* pars = new SUMOVehicleParameter();
+        MSVehicleType* type = MSNet::getInstance()->getVehicleControl().getVType(typeID);
+        if (type == 0) {
+            throw TraCIException("The vehicle type '" + typeID + "' is not known.");
+        }
+        const MSRoute* const routeDummy = new MSRoute("", ConstMSEdgeVector({ fromEdge }), false, 0, std::vector<SUMOVehicleParameter::Stop>());
+        vehicle = MSNet::getInstance()->getVehicleControl().buildVehicle(pars, routeDummy, type, false);
+    }
+    SUMOAbstractRouter<MSEdge, SUMOVehicle>& router = MSNet::getInstance()->getRouterTT();
+    const SUMOTime dep = depart < 0 ? MSNet::getInstance()->getCurrentTimeStep() : depart;
+    for (const MSEdge* const toEdge : toEdges) {
+        TraCIStage stage(MSTransportable::DRIVING);
+        ConstMSEdgeVector edges;
+        router.compute(fromEdge, toEdge, vehicle, dep, edges);
+        for (const MSEdge* e : edges) {
+            stage.edges.push_back(e->getID());
+        }
+        stage.travelTime = stage.cost = router.recomputeCosts(edges, vehicle, dep);
+        result.push_back(stage);
+        // reuse the shortest path tree rooted at the origin for the remaining destinations
+        router.setBulkMode(true);
+    }
+    router.setBulkMode(false);
+    if (vehicle != 0) {
+        MSNet::getInstance()->getVehicleControl().deleteVehicle(vehicle, true);
+    }
+    return result;
+}
+
+
 std::vector<TraCIStage>
 Simulation::findIntermodalRoute(const std::string& from, const std::string& to,
                                 const std::string& modes, const SUMOTime depart, const int routingMode, const double speed, const double walkFactor,
@@ -61,6 +61,17 @@ public:
     /// @brief Advances by one step (or up to the given time)
     static void simulationStep(const SUMOTime time = 0);
 
+    /** @brief Resets the dynamic simulation state while keeping the loaded network resident
+     *
+     * All vehicles are removed, pending insertions are discarded, collected
+     * detector values are dropped, the traffic light programs restart at
+     * their first phase, the event calendars are rewound and the random
+     * number generators and the clock are reinitialized, so consecutive
+     * sweep runs skip the network loading phase. Demand has to be added
+     * again afterwards (e.g. via Vehicle::add or by loading a saved state).
+     */
+    static void reset();
+
     /// @brief {object->{variable->value}}
     typedef std::map<int, TraCIValue> TraCIValues;
     typedef std::map<std::string, TraCIValues> SubscribedValues;
@@ -83,8 +94,22 @@ public:
 
     static int getMinExpectedNumber();
 
+    /// @brief whether the last gridlock check raised the alarm (see option gridlock-check)
+    static bool getGridlockAlarm();
+
+    /// @brief the junctions with the most blocked approaching vehicles at the last gridlock alarm
+    static std::vector<std::string> getGridlockedJunctions();
+
     static TraCIStage findRoute(const std::string& from, const std::string& to, const std::string& typeID, const SUMOTime depart, const int routingMode);
 
+    /** @brief Computes routes from a common origin to several destinations
+     *
+     * The shortest path tree built for the first destination is reused for
+     * all further destinations (router bulk mode) so querying many targets
+     * from the same origin costs little more than a single query.
+     */
+    static std::vector<TraCIStage> findRouteBatch(const std::string& from, const std::vector<std::string>& toList, const std::string& typeID, const SUMOTime depart, const int routingMode);
+
     static std::vector<TraCIStage> findIntermodalRoute(const std::string& from, const std::string& to, const std::string& modes,
             const SUMOTime depart, const int routingMode, const double speed, const double walkFactor,
             const double departPos, const double arrivalPos, const double departPosLat,
@@ -176,6 +176,19 @@ struct TraCIVehicleData {
 };
 
 
+/// @brief a vehicle's motion state for bulk retrieval
+struct TraCIVehicleState {
+    /// @brief The id of the vehicle
+    std::string id;
+    /// @brief The current position of the vehicle
+    TraCIPosition position;
+    /// @brief The current speed of the vehicle in [m/s]
+    double speed;
+    /// @brief The current angle of the vehicle in navigational degrees
+    double angle;
+};
+
+
 struct TraCINextTLSData {
     /// @brief The id of the next tls
     std::string id;
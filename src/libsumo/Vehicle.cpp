@@ -97,6 +97,26 @@ Vehicle::getIDCount() {
     return (int)getIDList().size();
 }
 
+
+std::vector<TraCIVehicleState>
+Vehicle::getAllStates() {
+    std::vector<TraCIVehicleState> result;
+    MSVehicleControl& c = MSNet::getInstance()->getVehicleControl();
+    result.reserve(c.getRunningVehicleNo());
+    for (MSVehicleControl::constVehIt i = c.loadedVehBegin(); i != c.loadedVehEnd(); ++i) {
+        const SUMOVehicle* const veh = (*i).second;
+        if (veh->isOnRoad() || veh->isParking()) {
+            result.push_back(TraCIVehicleState());
+            TraCIVehicleState& state = result.back();
+            state.id = (*i).first;
+            state.position = Helper::makeTraCIPosition(veh->getPosition());
+            state.speed = veh->getSpeed();
+            state.angle = GeomHelper::naviDegree(veh->getAngle());
+        }
+    }
+    return result;
+}
+
 double
 Vehicle::getSpeed(const std::string& vehicleID) {
     MSVehicle* veh = getVehicle(vehicleID);
@@ -439,6 +459,9 @@ Vehicle::getDrivingDistance2D(const std::string& vehicleID, double x, double y)
     MSVehicle* veh = getVehicle(vehicleID);
     if (veh->isOnRoad()) {
         std::pair<MSLane*, double> roadPos = Helper::convertCartesianToRoadMap(Position(x, y));
+        if (roadPos.first == 0) {
+            return INVALID_DOUBLE_VALUE;
+        }
         double distance = veh->getRoute().getDistanceBetween(veh->getPositionOnLane(), roadPos.second,
                           veh->getEdge(), &roadPos.first->getEdge());
         if (distance == std::numeric_limits<double>::max()) {
@@ -1145,7 +1168,11 @@ Vehicle::moveTo(const std::string& vehicleID, const std::string& laneID, double
 
 void
 Vehicle::setMaxSpeed(const std::string& vehicleID, double speed) {
-    getVehicle(vehicleID)->getSingularType().setMaxSpeed(speed);
+    MSVehicle* veh = getVehicle(vehicleID);
+    // only materialize a vehicle-specific type when the value actually changes
+    if (veh->getVehicleType().getMaxSpeed() != speed) {
+        veh->getSingularType().setMaxSpeed(speed);
+    }
 }
 
 void
@@ -1161,7 +1188,10 @@ Vehicle::setActionStepLength(const std::string& vehicleID, double actionStepLeng
     }
     SUMOTime actionStepLengthMillisecs = SUMOVehicleParserHelper::processActionStepLength(actionStepLength);
     SUMOTime previousActionStepLength = veh->getActionStepLength();
-    veh->getSingularType().setActionStepLength(actionStepLengthMillisecs, resetActionOffset);
+    if (actionStepLengthMillisecs != previousActionStepLength) {
+        // only materialize a vehicle-specific type when the value actually changes
+        veh->getSingularType().setActionStepLength(actionStepLengthMillisecs, resetActionOffset);
+    }
     if (resetActionOffset) {
         veh->resetActionOffset();
     } else {
@@ -1241,12 +1271,20 @@ Vehicle::setVia(const std::string& vehicleID, const std::vector<std::string>& vi
 
 void
 Vehicle::setShapeClass(const std::string& vehicleID, const std::string& clazz) {
-    getVehicle(vehicleID)->getSingularType().setShape(getVehicleShapeID(clazz));
+    MSVehicle* veh = getVehicle(vehicleID);
+    const SUMOVehicleShape shape = getVehicleShapeID(clazz);
+    if (veh->getVehicleType().getGuiShape() != shape) {
+        veh->getSingularType().setShape(shape);
+    }
 }
 
 void
 Vehicle::setEmissionClass(const std::string& vehicleID, const std::string& clazz) {
-    getVehicle(vehicleID)->getSingularType().setEmissionClass(PollutantsInterface::getClassByName(clazz));
+    MSVehicle* veh = getVehicle(vehicleID);
+    const SUMOEmissionClass emissionClass = PollutantsInterface::getClassByName(clazz);
+    if (veh->getVehicleType().getEmissionClass() != emissionClass) {
+        veh->getSingularType().setEmissionClass(emissionClass);
+    }
 }
 
 
@@ -56,6 +56,7 @@ public:
     /// @{
     static std::vector<std::string> getIDList();
     static int getIDCount();
+    static std::vector<TraCIVehicleState> getAllStates();
     static double getSpeed(const std::string& vehicleID);
     static double getSpeedWithoutTraCI(const std::string& vehicleID);
     static TraCIPosition getPosition(const std::string& vehicleID);
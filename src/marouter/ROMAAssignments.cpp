@@ -392,12 +392,45 @@ ROMAAssignments::sue(const int maxOuterIteration, const int maxInnerIteration, c
         // check for a new route, if none available, break
         // several modifications about when a route is new and when to break are in the original script
         bool newRoute = false;
-        for (std::vector<ODCell*>::const_iterator i = myMatrix.getCells().begin(); i != myMatrix.getCells().end(); ++i) {
-            ODCell* c = *i;
-            ConstROEdgeVector edges;
-            myRouter.compute(myNet.getEdge(c->origin + "-source"), myNet.getEdge(c->destination + "-sink"), myDefaultVehicle, 0, edges);
-            newRoute |= addRoute(edges, c->pathsVector, c->origin + c->destination + toString(c->pathsVector.size()), 0);
+#ifdef HAVE_FOX
+        if (myNet.getThreadPool().size() > 0) {
+            // the path searches are independent at fixed edge costs, shard them
+            //  over the worker threads (detect new routes via the path counts)
+            std::vector<int> pathCounts;
+            pathCounts.reserve(myMatrix.getCells().size());
+            std::string lastOrigin = "";
+            int workerIndex = 0;
+            for (std::vector<ODCell*>::const_iterator i = myMatrix.getCells().begin(); i != myMatrix.getCells().end(); ++i) {
+                ODCell* const c = *i;
+                pathCounts.push_back((int)c->pathsVector.size());
+                if (lastOrigin != c->origin) {
+                    workerIndex++;
+                    if (workerIndex == myNet.getThreadPool().size()) {
+                        workerIndex = 0;
+                    }
+                    myNet.getThreadPool().add(new RONet::BulkmodeTask(false), workerIndex);
+                    lastOrigin = c->origin;
+                    myNet.getThreadPool().add(new RoutingTask(*this, c, 0, 0.), workerIndex);
+                    myNet.getThreadPool().add(new RONet::BulkmodeTask(true), workerIndex);
+                } else {
+                    myNet.getThreadPool().add(new RoutingTask(*this, c, 0, 0.), workerIndex);
+                }
+            }
+            myNet.getThreadPool().waitAll();
+            for (int i = 0; i < (int)myMatrix.getCells().size(); i++) {
+                newRoute |= (int)myMatrix.getCells()[i]->pathsVector.size() != pathCounts[i];
+            }
+        } else {
+#endif
+            for (std::vector<ODCell*>::const_iterator i = myMatrix.getCells().begin(); i != myMatrix.getCells().end(); ++i) {
+                ODCell* c = *i;
+                ConstROEdgeVector edges;
+                myRouter.compute(myNet.getEdge(c->origin + "-source"), myNet.getEdge(c->destination + "-sink"), myDefaultVehicle, 0, edges);
+                newRoute |= addRoute(edges, c->pathsVector, c->origin + c->destination + toString(c->pathsVector.size()), 0);
+            }
+#ifdef HAVE_FOX
         }
+#endif
         if (!newRoute) {
             break;
         }
@@ -73,7 +73,10 @@ MELoop::simulate(SUMOTime tMax) {
         if (time > tMax) {
             return;
         }
-        std::vector<MEVehicle*> vehs = myLeaderCars[time];
+        // swap the event list out of the calendar instead of copying it;
+        //  events registered for the same time during processing start a fresh list
+        std::vector<MEVehicle*> vehs;
+        vehs.swap(myLeaderCars[time]);
         myLeaderCars.erase(time);
         for (std::vector<MEVehicle*>::const_iterator i = vehs.begin(); i != vehs.end(); ++i) {
             checkCar(*i);
@@ -120,6 +123,8 @@ MELoop::checkCar(MEVehicle* veh) {
     MESegment* const onSegment = veh->getSegment();
     MESegment* const toSegment = nextSegment(onSegment, veh);
     const bool teleporting = (onSegment == 0); // is the vehicle currently teleporting?
+    // the vehicle is no longer waiting for a wake-up call
+    MESegment::unregisterBlockedEntry(veh);
     if (changeSegment(veh, leaveTime, toSegment, teleporting)) {
         return;
     }
@@ -137,7 +142,11 @@ MELoop::checkCar(MEVehicle* veh) {
         // either the junction is blocked or the traffic light is red
         veh->setEventTime(leaveTime + MAX2(SUMOTime(1), myLinkRecheckInterval));
     } else {
-        SUMOTime newEventTime = MAX3(toSegment->getEventTime() + 1, leaveTime + 1, leaveTime + myFullRecheckInterval);
+        // the receiving segment is full; it wakes this vehicle as soon as a
+        //  vehicle leaves. The timed recheck is only a safeguard since the
+        //  registration is not part of the saved simulation state
+        toSegment->registerBlockedEntry(veh);
+        SUMOTime newEventTime = leaveTime + MAX3(SUMOTime(1), myFullRecheckInterval, myLinkRecheckInterval);
         if (MSGlobals::gTimeToGridlock > 0) {
             // if teleporting is enabled, make sure we look at the vehicle when the the gridlock-time is up
             newEventTime = MIN2(newEventTime, veh->getBlockTime() + MSGlobals::gTimeToGridlock + 1);
@@ -222,8 +231,12 @@ MELoop::setApproaching(MEVehicle* veh, MSLink* link) {
 
 void
 MELoop::removeLeaderCar(MEVehicle* v) {
-    std::vector<MEVehicle*>& cands = myLeaderCars[v->getEventTime()];
-    cands.erase(find(cands.begin(), cands.end(), v));
+    std::map<SUMOTime, std::vector<MEVehicle*> >::iterator cands = myLeaderCars.find(v->getEventTime());
+    cands->second.erase(find(cands->second.begin(), cands->second.end(), v));
+    if (cands->second.empty()) {
+        // drop the bucket so the main loop does not visit stale event times
+        myLeaderCars.erase(cands);
+    }
 }
 
 
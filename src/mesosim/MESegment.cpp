@@ -347,6 +347,20 @@ MESegment::writeVehicles(OutputDevice& of) const {
 MEVehicle*
 MESegment::removeCar(MEVehicle* v, SUMOTime leaveTime, MESegment* next) {
     myOccupancy = MAX2(0., myOccupancy - v->getVehicleType().getLengthWithGap());
+    if (!myBlockedEntries.empty()) {
+        // space was freed: wake the vehicles waiting at the jam boundary
+        std::vector<MEVehicle*> blocked;
+        blocked.swap(myBlockedEntries);
+        for (std::vector<MEVehicle*>::const_iterator i = blocked.begin(); i != blocked.end(); ++i) {
+            MEVehicle* const waiting = *i;
+            waiting->setBlockedEntrySegment(0);
+            if (waiting->getEventTime() > leaveTime + 1) {
+                MSGlobals::gMesoNet->removeLeaderCar(waiting);
+                waiting->setEventTime(leaveTime + 1);
+                MSGlobals::gMesoNet->addLeaderCar(waiting, waiting->getSegment() == 0 ? 0 : waiting->getSegment()->getLink(waiting));
+            }
+        }
+    }
     std::vector<MEVehicle*>& cars = myCarQues[v->getQueIndex()];
     assert(std::find(cars.begin(), cars.end(), v) != cars.end());
     // One could be tempted to do  v->setSegment(next); here but position on lane will be invalid if next == 0
@@ -453,6 +467,8 @@ MESegment::limitedControlOverride(const MSLink* link) const {
 void
 MESegment::send(MEVehicle* veh, MESegment* next, SUMOTime time) {
     assert(isInvalid(next) || time >= myBlockTimes[veh->getQueIndex()]);
+    // the vehicle must not be woken up after leaving (i.e. on vaporization)
+    unregisterBlockedEntry(veh);
     MSLink* link = getLink(veh);
     if (link != 0) {
         link->removeApproaching(veh);
@@ -469,6 +485,26 @@ MESegment::send(MEVehicle* veh, MESegment* next, SUMOTime time) {
     }
 }
 
+void
+MESegment::registerBlockedEntry(MEVehicle* veh) {
+    assert(veh->getBlockedEntrySegment() == 0);
+    myBlockedEntries.push_back(veh);
+    veh->setBlockedEntrySegment(this);
+}
+
+
+void
+MESegment::unregisterBlockedEntry(MEVehicle* veh) {
+    MESegment* const seg = veh->getBlockedEntrySegment();
+    if (seg != 0) {
+        std::vector<MEVehicle*>::iterator it = std::find(seg->myBlockedEntries.begin(), seg->myBlockedEntries.end(), veh);
+        assert(it != seg->myBlockedEntries.end());
+        seg->myBlockedEntries.erase(it);
+        veh->setBlockedEntrySegment(0);
+    }
+}
+
+
 bool
 MESegment::overtake() {
     return MSGlobals::gMesoOvertaking && myCapacity > myLength && RandHelper::rand() > (myOccupancy / myCapacity);
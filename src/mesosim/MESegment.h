@@ -375,6 +375,21 @@ public:
         return myTau_ff;
     }
 
+    /** @brief Registers a vehicle which could not enter because the segment is full
+     *
+     * The vehicle remains the leader of its upstream queue and is rescheduled
+     *  to the current time as soon as a vehicle leaves this segment. This
+     *  avoids cascades of recheck events through deep jams.
+     *
+     * @param[in] veh The vehicle waiting at the jam boundary
+     */
+    void registerBlockedEntry(MEVehicle* veh);
+
+    /** @brief Removes the given vehicle from the blocked-entry list it registered at (if any)
+     * @param[in] veh The vehicle to remove
+     */
+    static void unregisterBlockedEntry(MEVehicle* veh);
+
     static const double DO_NOT_PATCH_JAM_THRESHOLD;
 
     /// @brief add this lanes MoveReminders to the given vehicle
@@ -501,6 +516,9 @@ private:
     /// @brief the last headway
     SUMOTime myLastHeadway;
 
+    /// @brief vehicles on upstream segments waiting for space on this (full) segment
+    std::vector<MEVehicle*> myBlockedEntries;
+
     /* @brief segment for signifying vaporization. This segment has invalid
      * data and should only be used as a unique pointer */
     static MSEdge myDummyParent;
@@ -117,7 +117,10 @@ METriggeredCalibrator::execute(SUMOTime currentTime) {
             // keep calibrator alive but do not call again
             return TIME2STEPS(86400);
         }
-        return myFrequency;
+        // sleep until one period before the next interval begins instead of
+        //  polling; the extra wakeup keeps the collection window of the first
+        //  active call at one period as before
+        return MAX2(myFrequency, myCurrentStateInterval->begin - currentTime - myFrequency);
     }
     // we are active
     if (!myDidSpeedAdaption && myCurrentStateInterval->v >= 0 && myCurrentStateInterval->v != mySegment->getEdge().getSpeedLimit()) {
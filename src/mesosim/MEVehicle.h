@@ -35,6 +35,7 @@
 #include <vector>
 #include <microsim/MSBaseVehicle.h>
 #include <microsim/MSEdge.h>
+#include <utils/common/ObjectPool.h>
 #include <utils/common/StdDefs.h>
 #include "MESegment.h"
 
@@ -61,6 +62,23 @@ public:
               MSVehicleType* type, const double speedFactor);
 
 
+    /// @name Pooled allocation
+    ///
+    /// Vehicle objects are allocated from a free list so that scenarios with
+    ///  high vehicle turnover do not churn the heap allocator. Subclasses
+    ///  (i.e. GUIMEVehicle) have a different size and fall through to the heap.
+    /// @{
+
+    static void* operator new(size_t size) {
+        return ObjectPool<MEVehicle>::allocate(size);
+    }
+
+    static void operator delete(void* ptr, size_t size) {
+        ObjectPool<MEVehicle>::deallocate(ptr, size);
+    }
+    /// @}
+
+
     /** @brief Get the vehicle's position along the lane
      * @return The position of the vehicle (in m from the lane's begin)
      */
@@ -239,6 +257,22 @@ public:
     }
 
 
+    /** @brief Sets the segment at which the vehicle waits for freed space
+     * @param[in] s The segment the vehicle registered at (0 for none)
+     */
+    inline void setBlockedEntrySegment(MESegment* s) {
+        myBlockedEntrySegment = s;
+    }
+
+
+    /** @brief Returns the segment at which the vehicle waits for freed space
+     * @return The segment the vehicle registered at (0 for none)
+     */
+    inline MESegment* getBlockedEntrySegment() const {
+        return myBlockedEntrySegment;
+    }
+
+
     /** @brief Sets the entry time for the current segment
      * @param[in] t The entry time
      */
@@ -358,6 +392,9 @@ protected:
     /// @brief The time at which the vehicle was blocked on its current segment
     SUMOTime myBlockTime;
 
+    /// @brief The full segment which shall wake this vehicle when space is freed (0 for none)
+    MESegment* myBlockedEntrySegment;
+
     /// @brief where to stop
     std::map<const MESegment* const, SUMOTime> myStops;
 
@@ -241,12 +241,19 @@ MSBaseVehicle::replaceRouteEdges(ConstMSEdgeVector& edges, bool onInit, bool che
     }
     int oldSize = (int)edges.size();
     if (!onInit) {
+        // splice the driven part of the current route before the new edges;
+        //  building the result front-to-back avoids shifting the tail once
+        //  per prepended edge
         const MSEdge* const origin = getRerouteOrigin();
+        ConstMSEdgeVector spliced;
+        spliced.reserve((myCurrEdge - myRoute->begin()) + 1 + edges.size());
+        spliced.insert(spliced.end(), myRoute->begin(), myCurrEdge);
         if (origin != *myCurrEdge && edges.front() == origin) {
-            edges.insert(edges.begin(), *myCurrEdge);
-            oldSize = (int)edges.size();
+            spliced.push_back(*myCurrEdge);
+            oldSize = (int)edges.size() + 1;
         }
-        edges.insert(edges.begin(), myRoute->begin(), myCurrEdge);
+        spliced.insert(spliced.end(), edges.begin(), edges.end());
+        edges.swap(spliced);
     }
     if (edges == myRoute->getEdges()) {
         return true;
@@ -325,10 +332,16 @@ MSBaseVehicle::hasValidRoute(std::string& msg, const MSRoute* route) const {
     } else {
         start = route->begin();
     }
+    const SUMOVehicleClass svc = myType->getVehicleClass();
+    const bool fullRoute = (start == route->begin());
+    if (fullRoute && route->isValidated(svc)) {
+        // the same route has already been validated for this vehicle class
+        return true;
+    }
     MSRouteIterator last = route->end() - 1;
     // check connectivity, first
     for (MSRouteIterator e = start; e != last; ++e) {
-        if ((*e)->allowedLanes(**(e + 1), myType->getVehicleClass()) == 0) {
+        if ((*e)->allowedLanes(**(e + 1), svc) == 0) {
             msg = "No connection between edge '" + (*e)->getID() + "' and edge '" + (*(e + 1))->getID() + "'.";
             return false;
         }
@@ -341,6 +354,9 @@ MSBaseVehicle::hasValidRoute(std::string& msg, const MSRoute* route) const {
             return false;
         }
     }
+    if (fullRoute) {
+        route->setValidated(svc);
+    }
     return true;
 }
 
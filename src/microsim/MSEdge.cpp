@@ -51,6 +51,7 @@
 #include "MSNet.h"
 #include "MSVehicle.h"
 #include "MSLeaderInfo.h"
+#include "MSRoute.h"
 #include "MSContainer.h"
 #include "MSEdgeWeightsStorage.h"
 #include "MSEdge.h"
@@ -62,6 +63,7 @@
 // ===========================================================================
 MSEdge::DictType MSEdge::myDict;
 MSEdgeVector MSEdge::myEdges;
+bool MSEdge::myHaveRoundabouts = false;
 
 
 // ===========================================================================
@@ -76,6 +78,8 @@ MSEdge::MSEdge(const std::string& id, int numericalID,
     myLaneChanger(0), myFunction(function), myVaporizationRequests(0),
     myLastFailedInsertionTime(-1),
     myFromJunction(0), myToJunction(0),
+    myClassedAllowed(vClassIndex((SUMOVehicleClass)SUMOVehicleClass_MAX) + 1),
+    myClassedResolved(0),
     myStreetName(streetName),
     myEdgeType(edgeType),
     myPriority(priority),
@@ -83,6 +87,7 @@ MSEdge::MSEdge(const std::string& id, int numericalID,
     myLength(-1.),
     myEmptyTraveltime(-1.),
     myAmDelayed(false),
+    myLastEntryTime(-1),
     myAmRoundabout(false),
     myAmFringe(true) {
 }
@@ -94,7 +99,7 @@ MSEdge::~MSEdge() {
         delete(*i1).second;
     }
     for (ClassedAllowedLanesCont::iterator i2 = myClassedAllowed.begin(); i2 != myClassedAllowed.end(); i2++) {
-        for (AllowedLanesCont::iterator i1 = (*i2).second.begin(); i1 != (*i2).second.end(); i1++) {
+        for (AllowedLanesCont::iterator i1 = (*i2).begin(); i1 != (*i2).end(); i1++) {
             delete(*i1).second;
         }
     }
@@ -247,11 +252,12 @@ MSEdge::rebuildAllowedLanes() {
     // clear myClassedAllowed.
     // it will be rebuilt on demand
     for (ClassedAllowedLanesCont::iterator i2 = myClassedAllowed.begin(); i2 != myClassedAllowed.end(); i2++) {
-        for (AllowedLanesCont::iterator i1 = (*i2).second.begin(); i1 != (*i2).second.end(); i1++) {
+        for (AllowedLanesCont::iterator i1 = (*i2).begin(); i1 != (*i2).end(); i1++) {
             delete(*i1).second;
         }
+        (*i2).clear();
     }
-    myClassedAllowed.clear();
+    myClassedResolved = 0;
     myClassesSuccessorMap.clear();
     // rebuild myMinimumPermissions and myCombinedPermissions
     myMinimumPermissions = SVCAll;
@@ -260,6 +266,8 @@ MSEdge::rebuildAllowedLanes() {
         myMinimumPermissions &= (*i)->getPermissions();
         myCombinedPermissions |= (*i)->getPermissions();
     }
+    // routes validated against the old permissions may have become invalid
+    MSRoute::invalidateValidatedClasses();
 }
 
 
@@ -315,16 +323,15 @@ MSEdge::getAllowedLanesWithDefault(const AllowedLanesCont& c, const MSEdge* dest
 
 const std::vector<MSLane*>*
 MSEdge::allowedLanes(const MSEdge* destination, SUMOVehicleClass vclass) const {
-    if (destination == 0 && (myMinimumPermissions & vclass) == vclass) {
+    if (vclass == SVC_IGNORING || (destination == 0 && (myMinimumPermissions & vclass) == vclass)) {
         // all lanes allow vclass
         return getAllowedLanesWithDefault(myAllowed, destination);
     }
     // look up cached result in myClassedAllowed
-    ClassedAllowedLanesCont::const_iterator i = myClassedAllowed.find(vclass);
-    if (i != myClassedAllowed.end()) {
+    const int index = vClassIndex(vclass);
+    if ((myClassedResolved & vclass) == vclass) {
         // can use cached value
-        const AllowedLanesCont& c = (*i).second;
-        return getAllowedLanesWithDefault(c, destination);
+        return getAllowedLanesWithDefault(myClassedAllowed[index], destination);
     } else {
         // this vclass is requested for the first time. rebuild all destinations
         // go through connected edges
@@ -333,16 +340,17 @@ MSEdge::allowedLanes(const MSEdge* destination, SUMOVehicleClass vclass) const {
             MSDevice_Routing::lock();
         }
 #endif
+        AllowedLanesCont& classedAllowed = myClassedAllowed[index];
         for (AllowedLanesCont::const_iterator i1 = myAllowed.begin(); i1 != myAllowed.end(); ++i1) {
             const MSEdge* edge = i1->first;
             const std::vector<MSLane*>* lanes = i1->second;
-            myClassedAllowed[vclass][edge] = new std::vector<MSLane*>();
+            classedAllowed[edge] = new std::vector<MSLane*>();
             // go through lanes approaching current edge
             for (std::vector<MSLane*>::const_iterator i2 = lanes->begin(); i2 != lanes->end(); ++i2) {
                 // origin lane allows the current vehicle class?
                 if ((*i2)->allowsVehicleClass(vclass)) {
                     if (edge == 0) {
-                        myClassedAllowed[vclass][edge]->push_back(*i2);
+                        classedAllowed[edge]->push_back(*i2);
                     } else {
                         // target lane allows the current vehicle class?
                         const MSLinkCont& lc = (*i2)->getLinkCont();
@@ -350,7 +358,7 @@ MSEdge::allowedLanes(const MSEdge* destination, SUMOVehicleClass vclass) const {
                             const MSLane* targetLane = (*it_link)->getLane();
                             if ((&(targetLane->getEdge()) == edge) && targetLane->allowsVehicleClass(vclass)) {
                                 // -> may be used
-                                myClassedAllowed[vclass][edge]->push_back(*i2);
+                                classedAllowed[edge]->push_back(*i2);
                                 break;
                             }
                         }
@@ -358,17 +366,18 @@ MSEdge::allowedLanes(const MSEdge* destination, SUMOVehicleClass vclass) const {
                 }
             }
             // assert that 0 is returned if no connection is allowed for a class
-            if (myClassedAllowed[vclass][edge]->size() == 0) {
-                delete myClassedAllowed[vclass][edge];
-                myClassedAllowed[vclass][edge] = 0;
+            if (classedAllowed[edge]->size() == 0) {
+                delete classedAllowed[edge];
+                classedAllowed[edge] = 0;
             }
         }
+        myClassedResolved |= vclass;
 #ifdef HAVE_FOX
         if (MSDevice_Routing::isParallel()) {
             MSDevice_Routing::unlock();
         }
 #endif
-        return myClassedAllowed[vclass][destination];
+        return classedAllowed[destination];
     }
 }
 
@@ -786,14 +795,18 @@ MSEdge::clear() {
     }
     myDict.clear();
     myEdges.clear();
+    myHaveRoundabouts = false;
 }
 
 
 void
 MSEdge::insertIDs(std::vector<std::string>& into) {
+    // keep the former (sorted) order although the dictionary is now hashed
+    const int offset = (int)into.size();
     for (DictType::iterator i = myDict.begin(); i != myDict.end(); ++i) {
         into.push_back((*i).first);
     }
+    std::sort(into.begin() + offset, into.end());
 }
 
 
@@ -33,8 +33,10 @@
 #include <config.h>
 #endif
 
+#include <cassert>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <string>
 #include <iostream>
 #include <utils/common/Named.h>
@@ -82,8 +84,8 @@ public:
     /** @brief Suceeding edges (keys) and allowed lanes to reach these edges (values). */
     typedef std::map< const MSEdge*, std::vector<MSLane*>* > AllowedLanesCont;
 
-    /** @brief Map from vehicle types to lanes that may be used to reach one of the next edges */
-    typedef std::map< SUMOVehicleClass, AllowedLanesCont > ClassedAllowedLanesCont;
+    /** @brief Allowed lanes for each vehicle class, indexed by the bit position of the class */
+    typedef std::vector< AllowedLanesCont > ClassedAllowedLanesCont;
 
 
 public:
@@ -622,12 +624,29 @@ public:
 
     void markAsRoundabout() {
         myAmRoundabout = true;
+        myHaveRoundabouts = true;
+    }
+
+    /// @brief whether the loaded network contains any roundabout edge
+    static bool haveRoundabouts() {
+        return myHaveRoundabouts;
     }
 
     void markDelayed() const {
         myAmDelayed = true;
     }
 
+    /// @brief records that a vehicle entered this edge at the given time
+    void markVehicleEntered(const SUMOTime time) const {
+        myAmDelayed = true;
+        myLastEntryTime = time;
+    }
+
+    /// @brief returns the last time a vehicle entered this edge (-1 if it was never entered)
+    SUMOTime getLastEntryTime() const {
+        return myLastEntryTime;
+    }
+
     bool hasLaneChanger() const {
         return myLaneChanger != 0;
     }
@@ -746,6 +765,17 @@ protected:
     /// @brief lookup in map and return 0 if not found
     const std::vector<MSLane*>* getAllowedLanesWithDefault(const AllowedLanesCont& c, const MSEdge* dest) const;
 
+    /// @brief the index within myClassedAllowed for the given (single bit) vehicle class
+    static int vClassIndex(SUMOVehicleClass vclass) {
+        assert(vclass == SVC_IGNORING || (vclass & (vclass - 1)) == 0);
+        int index = 0;
+        while (vclass != 0) {
+            vclass = (SUMOVehicleClass)((int)vclass >> 1);
+            index++;
+        }
+        return index;
+    }
+
 
     /// @brief return upper bound for the depart position on this edge
     double getDepartPosBound(const MSVehicle& veh, bool upper = true) const;
@@ -799,10 +829,13 @@ protected:
     /// @brief Associative container from destination-edge to allowed-lanes.
     AllowedLanesCont myAllowed;
 
-    /// @brief From vehicle class to lanes allowed to be used by it
-    // @note: this map is filled on demand
+    /// @brief From vehicle class (indexed by bit position) to lanes allowed to be used by it
+    // @note: the entries are filled on demand
     mutable ClassedAllowedLanesCont myClassedAllowed;
 
+    /// @brief The classes for which myClassedAllowed was already resolved
+    mutable SVCPermissions myClassedResolved;
+
     /// @brief The intersection of lane permissions for this edge
     SVCPermissions myMinimumPermissions;
     /// @brief The union of lane permissions for this edge
@@ -830,6 +863,9 @@ protected:
     /// @brief whether this edge had a vehicle with less than max speed on it
     mutable bool myAmDelayed;
 
+    /// @brief the last time a vehicle entered one of this edge's lanes
+    mutable SUMOTime myLastEntryTime;
+
     /// @brief whether this edge belongs to a roundabout
     bool myAmRoundabout;
 
@@ -842,8 +878,8 @@ protected:
     /// @name Static edge container
     /// @{
 
-    /// @brief definition of the static dictionary type
-    typedef std::map< std::string, MSEdge* > DictType;
+    /// @brief definition of the static dictionary type (hashed, the id lookup is on the hot TraCI path)
+    typedef std::unordered_map< std::string, MSEdge* > DictType;
 
     /** @brief Static dictionary to associate string-ids with objects.
      * @deprecated Move to MSEdgeControl, make non-static
@@ -854,6 +890,9 @@ protected:
      * @deprecated Move to MSEdgeControl, make non-static
      */
     static MSEdgeVector myEdges;
+
+    /// @brief Whether any edge of the loaded network is part of a roundabout
+    static bool myHaveRoundabouts;
     /// @}
 
 
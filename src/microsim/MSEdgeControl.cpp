@@ -32,20 +32,53 @@
 
 #include "MSEdgeControl.h"
 #include "MSGlobals.h"
+#include "MSNet.h"
 #include "MSEdge.h"
 #include "MSLane.h"
 #include "MSVehicle.h"
+#include <utils/common/RandHelper.h>
+#include <utils/common/ToString.h>
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
 
+// ===========================================================================
+// static helper functions
+// ===========================================================================
+/// @brief interleaves the bits of the given non-negative coordinates (z-order)
+static long long int
+interleaveBits(int x, int y) {
+    long long int key = 0;
+    for (int b = 0; b < 31; b++) {
+        key |= ((long long int)((x >> b) & 1)) << (2 * b);
+        key |= ((long long int)((y >> b) & 1)) << (2 * b + 1);
+    }
+    return key;
+}
+
+
 // ===========================================================================
 // member method definitions
 // ===========================================================================
 MSEdgeControl::MSEdgeControl(const std::vector< MSEdge* >& edges)
     : myEdges(edges),
       myLanes(MSLane::dictSize()),
-      myLastLaneChange(MSEdge::dictSize()) {
+      myLastLaneChange(MSEdge::dictSize()),
+      myStepsSinceReorder(0) {
+#ifdef HAVE_FOX
+    if (MSGlobals::gNumSimThreads > 1) {
+        while (myThreadPool.size() < MSGlobals::gNumSimThreads) {
+            // every worker draws from its own stream so parallel runs are
+            //  reproducible (streams must be created before going parallel)
+            myRNGs.push_back(RandHelper::getNamedRNG("planMove#" + toString(myThreadPool.size())));
+            // with affinity requested, worker i runs on logical processor i;
+            //  since the lane batches are assigned by edge index the same
+            //  edges end up on the same processor in every step
+            new FXWorkerThread(myThreadPool, MSGlobals::gThreadAffinity ? myThreadPool.size() : -1);
+        }
+    }
+#endif
     // build the usage definitions for lanes
     for (std::vector< MSEdge* >::const_iterator i = myEdges.begin(); i != myEdges.end(); ++i) {
         const std::vector<MSLane*>& lanes = (*i)->getLanes();
@@ -56,6 +89,7 @@ MSEdgeControl::MSEdgeControl(const std::vector< MSEdge* >& edges)
             myLanes[pos].lastNeigh = lanes.end();
             myLanes[pos].amActive = false;
             myLanes[pos].haveNeighbors = false;
+            myLanes[pos].amChanged = false;
         } else {
             for (std::vector<MSLane*>::const_iterator j = lanes.begin(); j != lanes.end(); ++j) {
                 int pos = (*j)->getNumericalID();
@@ -64,10 +98,54 @@ MSEdgeControl::MSEdgeControl(const std::vector< MSEdge* >& edges)
                 myLanes[pos].lastNeigh = lanes.end();
                 myLanes[pos].amActive = false;
                 myLanes[pos].haveNeighbors = true;
+                myLanes[pos].amChanged = false;
             }
             myLastLaneChange[(*i)->getNumericalID()] = -1;
         }
     }
+    // assign each lane its position along a space-filling curve (z-order over
+    //  the lane centers); physically adjacent lanes - which exchange vehicles
+    //  via lane-changing and junction links - obtain similar keys so the
+    //  periodic reordering in patchActiveLanes keeps them adjacent in
+    //  iteration order as well
+    double minX = 0.;
+    double minY = 0.;
+    bool haveMin = false;
+    for (LaneUsageVector::const_iterator i = myLanes.begin(); i != myLanes.end(); ++i) {
+        if ((*i).lane == 0) {
+            continue;
+        }
+        const Position center = (*i).lane->getShape().getCentroid();
+        if (!haveMin || center.x() < minX) {
+            minX = center.x();
+        }
+        if (!haveMin || center.y() < minY) {
+            minY = center.y();
+        }
+        haveMin = true;
+    }
+    for (LaneUsageVector::iterator i = myLanes.begin(); i != myLanes.end(); ++i) {
+        if ((*i).lane == 0) {
+            continue;
+        }
+        const Position center = (*i).lane->getShape().getCentroid();
+        (*i).spatialKey = interleaveBits((int)(center.x() - minX), (int)(center.y() - minY));
+    }
+}
+
+
+bool
+MSEdgeControl::ComparatorSpatialKey::operator()(const MSLane* a, const MSLane* b) const {
+    const LaneUsage& ua = myLanes[a->getNumericalID()];
+    const LaneUsage& ub = myLanes[b->getNumericalID()];
+    if (ua.haveNeighbors != ub.haveNeighbors) {
+        // changeLanes stops at the first lane without neighbors
+        return ua.haveNeighbors;
+    }
+    if (ua.spatialKey != ub.spatialKey) {
+        return ua.spatialKey < ub.spatialKey;
+    }
+    return a->getNumericalID() < b->getNumericalID();
 }
 
 
@@ -77,8 +155,11 @@ MSEdgeControl::~MSEdgeControl() {
 
 void
 MSEdgeControl::patchActiveLanes() {
-    for (std::set<MSLane*, Named::ComparatorIdLess>::iterator i = myChangedStateLanes.begin(); i != myChangedStateLanes.end(); ++i) {
+    // sort by id to keep the processing order of the former set-based container
+    std::sort(myChangedStateLanes.begin(), myChangedStateLanes.end(), Named::ComparatorIdLess());
+    for (std::vector<MSLane*>::iterator i = myChangedStateLanes.begin(); i != myChangedStateLanes.end(); ++i) {
         LaneUsage& lu = myLanes[(*i)->getNumericalID()];
+        lu.amChanged = false;
         // if the lane was inactive but is now...
         if (!lu.amActive && (*i)->getVehicleNumber() > 0) {
             // ... add to active lanes and mark as such
@@ -91,20 +172,75 @@ MSEdgeControl::patchActiveLanes() {
         }
     }
     myChangedStateLanes.clear();
+    // periodically reorder the active lanes along the space-filling curve so
+    //  that physically adjacent lanes are also adjacent in iteration order
+    if (++myStepsSinceReorder >= REORDER_PERIOD) {
+        myStepsSinceReorder = 0;
+        myActiveLanes.sort(ComparatorSpatialKey(myLanes));
+    }
 }
 
 void
 MSEdgeControl::planMovements(SUMOTime t) {
-    for (std::list<MSLane*>::iterator i = myActiveLanes.begin(); i != myActiveLanes.end();) {
-        if ((*i)->getVehicleNumber() == 0) {
-            myLanes[(*i)->getNumericalID()].amActive = false;
-            i = myActiveLanes.erase(i);
-        } else {
-            (*i)->planMovements(t);
-            ++i;
+#ifdef HAVE_FOX
+    if (myThreadPool.size() > 1) {
+        // sort the active lanes into one batch per worker; all lanes of an
+        // edge end up in the same batch so neighboring lanes are never
+        // planned concurrently; the batches are rebuilt every step and thus
+        // drawn from the per-step arena
+        const ArenaAllocator<MSLane*> arenaAlloc(MSNet::getInstance()->getStepArena());
+        std::vector<ArenaLaneVector, ArenaAllocator<ArenaLaneVector> > batches(
+            myThreadPool.size(), ArenaLaneVector(arenaAlloc), ArenaAllocator<ArenaLaneVector>(arenaAlloc));
+        for (std::list<MSLane*>::iterator i = myActiveLanes.begin(); i != myActiveLanes.end();) {
+            if ((*i)->getVehicleNumber() == 0) {
+                myLanes[(*i)->getNumericalID()].amActive = false;
+                i = myActiveLanes.erase(i);
+            } else {
+                batches[(*i)->getEdge().getNumericalID() % myThreadPool.size()].push_back(*i);
+                ++i;
+            }
         }
+        for (int b = 0; b < (int)batches.size(); b++) {
+            if (!batches[b].empty()) {
+                myThreadPool.add(new PlanMoveTask(batches[b], t, myRNGs[b]), b);
+            }
+        }
+        myThreadPool.waitAll();
+    } else {
+#endif
+        for (std::list<MSLane*>::iterator i = myActiveLanes.begin(); i != myActiveLanes.end();) {
+            if ((*i)->getVehicleNumber() == 0) {
+                myLanes[(*i)->getNumericalID()].amActive = false;
+                i = myActiveLanes.erase(i);
+            } else {
+                (*i)->planMovements(t);
+                ++i;
+            }
+        }
+#ifdef HAVE_FOX
+    }
+#endif
+    // the approaching information of a link is shared between vehicles from
+    //  different edges (the drive items span downstream edges), so the links
+    //  are registered in a serial sweep after the plan phase
+    for (std::list<MSLane*>::const_iterator i = myActiveLanes.begin(); i != myActiveLanes.end(); ++i) {
+        (*i)->setJunctionApproaches();
+    }
+}
+
+
+#ifdef HAVE_FOX
+void
+MSEdgeControl::PlanMoveTask::run(FXWorkerThread*) {
+    // draw all random numbers of this batch (car-following dawdling etc.)
+    //  from the stream dedicated to this worker
+    RandHelper::setThreadRNG(myRNG);
+    for (ArenaLaneVector::const_iterator i = myLanes.begin(); i != myLanes.end(); ++i) {
+        (*i)->planMovements(myTime);
     }
+    RandHelper::setThreadRNG(0);
 }
+#endif
 
 
 void
@@ -144,6 +280,12 @@ MSEdgeControl::executeMovements(SUMOTime t) {
 
 void
 MSEdgeControl::changeLanes(SUMOTime t) {
+    // @note Unlike planMovements this phase must not be dispatched over the
+    //  worker threads: MSLaneChanger both mutates the lane containers while
+    //  it runs (updateChanger moves vehicles into MSLane::myTmpVehicles) and
+    //  reads other edges' containers over an unbounded lookahead distance
+    //  (getCriticalLeader / getFollowersOnConsecutive), so concurrently
+    //  processed edges would read each other mid-mutation.
     std::vector<MSLane*> toAdd;
     for (std::list<MSLane*>::iterator i = myActiveLanes.begin(); i != myActiveLanes.end();) {
         LaneUsage& lu = myLanes[(*i)->getNumericalID()];
@@ -197,7 +339,11 @@ MSEdgeControl::getEdgeNames() const {
 
 void
 MSEdgeControl::gotActive(MSLane* l) {
-    myChangedStateLanes.insert(l);
+    LaneUsage& lu = myLanes[l->getNumericalID()];
+    if (!lu.amChanged) {
+        lu.amChanged = true;
+        myChangedStateLanes.push_back(l);
+    }
 }
 
 void
@@ -40,8 +40,13 @@
 #include <iostream>
 #include <list>
 #include <set>
+#include <random>
+#include <utils/common/MemoryArena.h>
 #include <utils/common/SUMOTime.h>
 #include <utils/common/Named.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 
 // ===========================================================================
@@ -100,11 +105,13 @@ public:
     /// @{
 
     /** @brief Compute safe velocities for all vehicles based on positions and
-     * speeds from the last time step. Also registers
-     * ApproachingVehicleInformation for all links
+     * speeds from the last time step. Afterwards registers the
+     * ApproachingVehicleInformation for all links in a serial sweep
      *
-     * This method goes through all active lanes calling their "planMovements" method.
+     * This method goes through all active lanes calling their "planMovements"
+     * and "setJunctionApproaches" methods.
      * @see MSLane::planMovements
+     * @see MSLane::setJunctionApproaches
      */
     void planMovements(SUMOTime t);
 
@@ -159,6 +166,17 @@ public:
         return myEdges;
     }
 
+#ifdef HAVE_FOX
+    /** @brief Returns the thread pool for parallel simulation tasks
+     *
+     * The pool is empty unless "--threads" is larger than one.
+     * @return the worker thread pool
+     */
+    FXWorkerThread::Pool& getThreadPool() {
+        return myThreadPool;
+    }
+#endif
+
 
     /** @brief Returns the list of names of all known edges
      *
@@ -201,7 +219,43 @@ public:
         bool amActive;
         /// @brief Information whether this lane belongs to a multi-lane edge
         bool haveNeighbors;
+        /// @brief Information whether this lane is in myChangedStateLanes
+        bool amChanged;
+        /// @brief The position of the lane center on the space-filling curve
+        long long int spatialKey;
+    };
+
+private:
+#ifdef HAVE_FOX
+    /// @brief A batch of lanes drawn from the per-step arena
+    typedef std::vector<MSLane*, ArenaAllocator<MSLane*> > ArenaLaneVector;
+
+    /**
+     * @class PlanMoveTask
+     * @brief Computes the longitudinal movement plans for a batch of lanes
+     *
+     * The plan phase only reads the vehicle states of the previous step and
+     *  writes per-vehicle plans, so lanes may be processed concurrently as
+     *  long as all lanes of an edge stay within the same batch and the
+     *  (cross-edge) link registration is deferred to the serial sweep in
+     *  planMovements. The batch is only referenced; it must live until the
+     *  task has finished.
+     */
+    class PlanMoveTask : public FXWorkerThread::Task {
+    public:
+        PlanMoveTask(const ArenaLaneVector& lanes, const SUMOTime time, std::mt19937* rng)
+            : myLanes(lanes), myTime(time), myRNG(rng) {}
+        void run(FXWorkerThread* context);
+    private:
+        const ArenaLaneVector& myLanes;
+        const SUMOTime myTime;
+        /// @brief the random number stream of the worker executing this batch
+        std::mt19937* const myRNG;
+    private:
+        /// @brief Invalidated assignment operator.
+        PlanMoveTask& operator=(const PlanMoveTask&);
     };
+#endif
 
 private:
     /// @brief Loaded edges
@@ -210,6 +264,24 @@ private:
     /// @brief Definition of a container about a lane's number of vehicles and neighbors
     typedef std::vector<LaneUsage> LaneUsageVector;
 
+    /**
+     * @class ComparatorSpatialKey
+     * @brief Sorts lanes along the space-filling curve over the lane centers
+     *
+     * Lanes with neighbors keep preceding all single lanes since changeLanes
+     *  relies on meeting them first.
+     */
+    class ComparatorSpatialKey {
+    public:
+        ComparatorSpatialKey(const LaneUsageVector& lanes) : myLanes(lanes) {}
+        bool operator()(const MSLane* a, const MSLane* b) const;
+    private:
+        const LaneUsageVector& myLanes;
+    private:
+        /// @brief Invalidated assignment operator.
+        ComparatorSpatialKey& operator=(const ComparatorSpatialKey&);
+    };
+
     /// @brief Information about lanes' number of vehicles and neighbors
     LaneUsageVector myLanes;
 
@@ -220,11 +292,26 @@ private:
     std::vector<MSLane*> myWithVehicles2Integrate;
 
     /// @brief Lanes which changed the state without informing the control
-    std::set<MSLane*, Named::ComparatorIdLess> myChangedStateLanes;
+    /// (deduplicated via LaneUsage::amChanged, sorted by id before processing)
+    std::vector<MSLane*> myChangedStateLanes;
 
     /// @brief The list of active (not empty) lanes
     std::vector<SUMOTime> myLastLaneChange;
 
+    /// @brief The number of steps since the active lanes were last reordered
+    int myStepsSinceReorder;
+
+    /// @brief The number of steps between two reorderings of the active lanes
+    static const int REORDER_PERIOD = 256;
+
+#ifdef HAVE_FOX
+    /// @brief The thread pool used when "--threads" is larger than one
+    FXWorkerThread::Pool myThreadPool;
+
+    /// @brief The random number stream of each worker thread
+    std::vector<std::mt19937*> myRNGs;
+#endif
+
 private:
     /// @brief Copy constructor.
     MSEdgeControl(const MSEdgeControl&);
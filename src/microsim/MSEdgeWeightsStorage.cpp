@@ -31,6 +31,12 @@
 #include "MSEdgeWeightsStorage.h"
 
 
+// ===========================================================================
+// static member variables
+// ===========================================================================
+int MSEdgeWeightsStorage::myNonEmptyCount = 0;
+
+
 // ===========================================================================
 // method definitions
 // ===========================================================================
@@ -39,6 +45,9 @@ MSEdgeWeightsStorage::MSEdgeWeightsStorage() {
 
 
 MSEdgeWeightsStorage::~MSEdgeWeightsStorage() {
+    if (!myTravelTimes.empty() || !myEfforts.empty()) {
+        myNonEmptyCount--;
+    }
 }
 
 
@@ -76,6 +85,9 @@ void
 MSEdgeWeightsStorage::addTravelTime(const MSEdge* const e,
                                     double begin, double end,
                                     double value) {
+    if (myTravelTimes.empty() && myEfforts.empty()) {
+        myNonEmptyCount++;
+    }
     std::map<const MSEdge*, ValueTimeLine<double> >::iterator i = myTravelTimes.find(e);
     if (i == myTravelTimes.end()) {
         myTravelTimes[e] = ValueTimeLine<double>();
@@ -89,6 +101,9 @@ void
 MSEdgeWeightsStorage::addEffort(const MSEdge* const e,
                                 double begin, double end,
                                 double value) {
+    if (myTravelTimes.empty() && myEfforts.empty()) {
+        myNonEmptyCount++;
+    }
     std::map<const MSEdge*, ValueTimeLine<double> >::iterator i = myEfforts.find(e);
     if (i == myEfforts.end()) {
         myEfforts[e] = ValueTimeLine<double>();
@@ -103,6 +118,9 @@ MSEdgeWeightsStorage::removeTravelTime(const MSEdge* const e) {
     std::map<const MSEdge*, ValueTimeLine<double> >::iterator i = myTravelTimes.find(e);
     if (i != myTravelTimes.end()) {
         myTravelTimes.erase(i);
+        if (myTravelTimes.empty() && myEfforts.empty()) {
+            myNonEmptyCount--;
+        }
     }
 }
 
@@ -112,6 +130,9 @@ MSEdgeWeightsStorage::removeEffort(const MSEdge* const e) {
     std::map<const MSEdge*, ValueTimeLine<double> >::iterator i = myEfforts.find(e);
     if (i != myEfforts.end()) {
         myEfforts.erase(i);
+        if (myTravelTimes.empty() && myEfforts.empty()) {
+            myNonEmptyCount--;
+        }
     }
 }
 
@@ -119,6 +119,17 @@ public:
     bool knowsEffort(const MSEdge* const e) const;
 
 
+    /** @brief Returns whether any storage instance currently holds values
+     *
+     * Lets the routing callbacks skip the per-vehicle and the global lookup
+     *  entirely in the common case that no custom weights were set at all
+     * @return Whether at least one storage holds travel times or efforts
+     */
+    static bool hasWeights() {
+        return myNonEmptyCount > 0;
+    }
+
+
 private:
     /// @brief A map of edge->time->travel time
     std::map<const MSEdge*, ValueTimeLine<double> > myTravelTimes;
@@ -126,6 +137,9 @@ private:
     /// @brief A map of edge->time->effort
     std::map<const MSEdge*, ValueTimeLine<double> > myEfforts;
 
+    /// @brief The number of storage instances holding any values
+    static int myNonEmptyCount;
+
 
 private:
     /// @brief Invalidated copy constructor.
@@ -32,77 +32,152 @@
 #endif
 
 #include <cassert>
+#include <utils/common/StdDefs.h>
 #include "MSEventControl.h"
 #include <utils/common/MsgHandler.h>
 #include <utils/common/Command.h>
 #include "MSNet.h"
 
 
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+const int MSEventControl::WHEEL_SIZE = 512;
+
+
 // ===========================================================================
 // member definitions
 // ===========================================================================
 MSEventControl::MSEventControl()
-    : currentTimeStep(-1), myEvents() {}
+    : currentTimeStep(-1), myWheel(WHEEL_SIZE), myEventCount(0),
+      myLastExecuted(-SUMOTime_MAX), myFirstCall(true) {}
 
 
 MSEventControl::~MSEventControl() {
     // delete the events
-    while (!myEvents.empty()) {
-        Event e = myEvents.top();
-        delete e.first;
-        myEvents.pop();
+    for (std::vector<Event>::iterator i = myDue.begin(); i != myDue.end(); ++i) {
+        delete(*i).first;
+    }
+    for (std::vector<std::vector<Event> >::iterator b = myWheel.begin(); b != myWheel.end(); ++b) {
+        for (std::vector<Event>::iterator i = (*b).begin(); i != (*b).end(); ++i) {
+            delete(*i).first;
+        }
     }
 }
 
 
 void
 MSEventControl::addEvent(Command* operation, SUMOTime execTimeStep) {
-    myEvents.push(Event(operation, execTimeStep));
+    scheduleEvent(Event(operation, execTimeStep));
+}
+
+
+void
+MSEventControl::scheduleEvent(const Event& event) {
+    myEventCount++;
+    if (event.second < 0 || event.second < myLastExecuted + DELTA_T) {
+        // (over)due at the latest with the next call to execute
+        myDue.push_back(event);
+    } else {
+        myWheel[bucketIndex(event.second)].push_back(event);
+    }
+}
+
+
+void
+MSEventControl::rewind(SUMOTime begin) {
+    myLastExecuted = begin - DELTA_T;
+    // the buckets may hold events lying before the begin step again
+    myFirstCall = true;
+}
+
+
+void
+MSEventControl::collectDue(std::vector<Event>& bucket, const SUMOTime execTime) {
+    int keep = 0;
+    for (int i = 0; i < (int)bucket.size(); ++i) {
+        if (bucket[i].second < execTime + DELTA_T) {
+            myDue.push_back(bucket[i]);
+        } else {
+            // belongs to a later lap of the wheel
+            bucket[keep] = bucket[i];
+            keep++;
+        }
+    }
+    bucket.resize(keep);
 }
 
 
 void
 MSEventControl::execute(SUMOTime execTime) {
-    // Execute all events that are scheduled for execTime.
-    while (!myEvents.empty()) {
-        Event currEvent = myEvents.top();
+    myLastExecuted = execTime;
+    if (myFirstCall) {
+        // events scheduled before the simulation begin may sit anywhere
+        myFirstCall = false;
+        for (int b = 0; b < WHEEL_SIZE; ++b) {
+            if (b != bucketIndex(execTime)) {
+                collectDue(myWheel[b], execTime);
+            }
+        }
+    }
+    collectDue(myWheel[bucketIndex(execTime)], execTime);
+    // Execute all events that are scheduled for execTime; the due list may
+    //  grow during execution (re-entrant addEvent, recurring events)
+    for (int i = 0; i < (int)myDue.size(); ++i) {
+        Event currEvent = myDue[i];
         if (currEvent.second < 0) {
             currEvent.second = execTime;
         }
-        if (currEvent.second < execTime + DELTA_T) {
-            Command* command = currEvent.first;
-            myEvents.pop();
-            SUMOTime time = 0;
-            try {
-                time = command->execute(execTime);
-            } catch (...) {
-                delete command;
-                throw;
-            }
+        Command* command = currEvent.first;
+        myEventCount--;
+        SUMOTime time = 0;
+        try {
+            time = command->execute(execTime);
+        } catch (...) {
+            delete command;
+            // drop the executed events, keep the remaining due ones
+            myDue.erase(myDue.begin(), myDue.begin() + i + 1);
+            throw;
+        }
 
-            // Delete nonrecurring events, reinsert recurring ones
-            // with new execution time = execTime + returned offset.
-            if (time <= 0) {
-                if (time < 0) {
-                    WRITE_WARNING("Command returned negative repeat number; will be deleted.");
-                }
-                delete currEvent.first;
-            } else {
-                currEvent.second += time;
-                myEvents.push(currEvent);
+        // Delete nonrecurring events, reinsert recurring ones
+        // with new execution time = execTime + returned offset.
+        if (time <= 0) {
+            if (time < 0) {
+                WRITE_WARNING("Command returned negative repeat number; will be deleted.");
             }
+            delete currEvent.first;
         } else {
-            break;
+            currEvent.second += time;
+            scheduleEvent(currEvent);
         }
     }
+    myDue.clear();
 }
 
 
 bool
 MSEventControl::isEmpty() {
-    return myEvents.empty();
+    return myEventCount == 0;
 }
 
+
+SUMOTime
+MSEventControl::getNextEventTime() const {
+    SUMOTime result = SUMOTime_MAX;
+    for (std::vector<Event>::const_iterator i = myDue.begin(); i != myDue.end(); ++i) {
+        result = MIN2(result, (*i).second);
+    }
+    for (std::vector<std::vector<Event> >::const_iterator b = myWheel.begin(); b != myWheel.end(); ++b) {
+        for (std::vector<Event>::const_iterator i = (*b).begin(); i != (*b).end(); ++i) {
+            result = MIN2(result, (*i).second);
+        }
+    }
+    return result;
+}
+
+
+
 void
 MSEventControl::setCurrentTimeStep(SUMOTime time) {
     currentTimeStep = time;
@@ -104,6 +104,17 @@ public:
     bool isEmpty();
 
 
+    /** @brief Returns the time of the earliest stored event
+     *
+     * Both the due list and all wheel buckets are scanned, so this is not
+     *  meant to be called each step but only when considering to jump over
+     *  idle simulation time.
+     *
+     * @return The execution time of the earliest event (SUMOTime_MAX if empty)
+     */
+    SUMOTime getNextEventTime() const;
+
+
     /** @brief Set the current Time.
      *
      * This method is only for Unit Testing.
@@ -113,29 +124,66 @@ public:
     void setCurrentTimeStep(SUMOTime time);
 
 
-protected:
-    /** @brief Sort-criterion for events.
+    /** @brief Rewinds the control to a simulation restart at the given begin time
+     *
+     * Pending events keep their absolute execution times; the timing wheel
+     *  is indexed by absolute time, so they are picked up again when the
+     *  rewound clock reaches them. Only the baseline used for filing newly
+     *  added events is reset, so events scheduled after the rewind are not
+     *  treated as overdue.
+     * @param[in] begin The new simulation begin time
+     */
+    void rewind(SUMOTime begin);
+
+
+private:
+    /** @brief Files the given event into the due list or its wheel bucket
+     *
+     * Events which are (over)due with the next call to execute are appended
+     *  to the due list, all others to the bucket of their execution step.
+     *
+     * @param[in] event The event to schedule
+     */
+    void scheduleEvent(const Event& event);
+
+
+    /** @brief Moves all due events of the given bucket into the due list
+     *
+     * Events of later laps of the wheel stay in the bucket.
      *
-     * Sorts events by their execution time
+     * @param[in] bucket The bucket to inspect
+     * @param[in] execTime The current simulation time
      */
-    class EventSortCrit {
-    public:
-        /// @brief compares two events
-        bool operator()(const Event& e1, const Event& e2) const {
-            return e1.second > e2.second;
-        }
-    };
+    void collectDue(std::vector<Event>& bucket, const SUMOTime execTime);
+
+
+    /// @brief Returns the wheel bucket index for the given execution time
+    int bucketIndex(const SUMOTime time) const {
+        return (int)((time / DELTA_T) % WHEEL_SIZE);
+    }
 
 
 private:
-    /// @brief Container for time-dependant events, e.g. traffic-light-change.
-    typedef std::priority_queue< Event, std::vector< Event >, EventSortCrit > EventCont;
+    /// @brief The number of simulation steps covered by one lap of the wheel
+    static const int WHEEL_SIZE;
 
     /// The current TimeStep
     SUMOTime currentTimeStep;
 
-    /// @brief Event-container, holds executable events.
-    EventCont myEvents;
+    /// @brief The timing wheel; one bucket of events per simulation step
+    std::vector<std::vector<Event> > myWheel;
+
+    /// @brief Events due for execution with the next call to execute
+    std::vector<Event> myDue;
+
+    /// @brief The overall number of stored events
+    int myEventCount;
+
+    /// @brief The time of the last call to execute
+    SUMOTime myLastExecuted;
+
+    /// @brief Whether execute was never called (events may lie before begin)
+    bool myFirstCall;
 
     /// get the Current TimeStep used in addEvent.
     SUMOTime getCurrentTimeStep();
@@ -86,6 +86,9 @@ MSFrame::fillOptions() {
     oc.addDescription("net-file", "Input", "Load road network description from FILE");
     oc.addXMLDefault("net-file", "net");
 
+    oc.doRegister("network.cache", new Option_Bool(false));
+    oc.addDescription("network.cache", "Input", "Reuse (and build on first use) a binary cache next to the network file for faster loading");
+
     oc.doRegister("route-files", 'r', new Option_FileName());
     oc.addSynonyme("route-files", "routes");
     oc.addDescription("route-files", "Input", "Load routes descriptions from FILE(s)");
@@ -114,6 +117,8 @@ MSFrame::fillOptions() {
     oc.addSynonyme("netstate-dump", "netstate");
     oc.addSynonyme("netstate-dump", "netstate-output");
     oc.addDescription("netstate-dump", "Output", "Save complete network states into FILE");
+    oc.doRegister("netstate-dump.format", new Option_String("xml"));
+    oc.addDescription("netstate-dump.format", "Output", "Write netstate-dump in the given format ('xml' or 'binary')");
     oc.doRegister("netstate-dump.empty-edges", new Option_Bool(false));
     oc.addSynonyme("netstate-dump.empty-edges", "netstate.empty-edges");
     oc.addSynonyme("netstate-dump.empty-edges", "netstate-output.empty-edges");
@@ -124,6 +129,10 @@ MSFrame::fillOptions() {
     oc.addSynonyme("netstate-dump.precision", "netstate-output.precision");
     oc.addSynonyme("netstate-dump.precision", "dump-precision", true);
     oc.addDescription("netstate-dump.precision", "Output", "Write positions and speeds with the given precision (default 2)");
+    oc.doRegister("netstate-dump.delta", new Option_Bool(false));
+    oc.addDescription("netstate-dump.delta", "Output", "Write only vehicles which changed their lane or their quantized position or speed since the previous step");
+    oc.doRegister("netstate-dump.keyframe-period", new Option_String("60", "TIME"));
+    oc.addDescription("netstate-dump.keyframe-period", "Output", "Write a complete network state with the given period when using netstate-dump.delta");
 
 
     oc.doRegister("emission-output", new Option_FileName());
@@ -141,10 +150,19 @@ MSFrame::fillOptions() {
 
     oc.doRegister("fcd-output", new Option_FileName());
     oc.addDescription("fcd-output", "Output", "Save the Floating Car Data");
+    oc.doRegister("fcd-output.format", new Option_String("xml"));
+    oc.addDescription("fcd-output.format", "Output", "Write fcd-output in the given format ('xml' or 'binary')");
+
     oc.doRegister("fcd-output.geo", new Option_Bool(false));
     oc.addDescription("fcd-output.geo", "Output", "Save the Floating Car Data using geo-coordinates (lon/lat)");
     oc.doRegister("fcd-output.signals", new Option_Bool(false));
     oc.addDescription("fcd-output.signals", "Output", "Add the vehicle signal state to the FCD output (brake lights etc.)");
+    oc.doRegister("fcd-output.period", new Option_String("0", "TIME"));
+    oc.addDescription("fcd-output.period", "Output", "Save the Floating Car Data only every given period of simulation time; a vehicle type may override this with the 'fcd.period' parameter");
+    oc.doRegister("fcd-output.filter-shapes", new Option_String());
+    oc.addDescription("fcd-output.filter-shapes", "Output", "Only write the Floating Car Data for vehicles and persons within the given (additional file) polygons");
+    oc.doRegister("fcd-output.attributes", new Option_String());
+    oc.addDescription("fcd-output.attributes", "Output", "Restrict the written vehicle attributes to the given comma-separated list ('angle', 'type', 'speed', 'pos', 'lane', 'slope')");
     oc.doRegister("full-output", new Option_FileName());
     oc.addDescription("full-output", "Output", "Save a lot of information for each timestep (very redundant)");
     oc.doRegister("queue-output", new Option_FileName());
@@ -153,6 +171,12 @@ MSFrame::fillOptions() {
     oc.addDescription("vtk-output", "Output", "Save complete vehicle positions inclusive speed values in the VTK Format (usage: /path/out will produce /path/out_$TIMESTEP$.vtp files)");
     oc.doRegister("amitran-output", new Option_FileName());
     oc.addDescription("amitran-output", "Output", "Save the vehicle trajectories in the Amitran format");
+    oc.doRegister("heatmap-output", new Option_FileName());
+    oc.addDescription("heatmap-output", "Output", "Save aggregated traffic (time spent and mean speed) on a raster grid over the network");
+    oc.doRegister("heatmap-output.cell-size", new Option_Float(100.));
+    oc.addDescription("heatmap-output.cell-size", "Output", "The edge length of the quadratic heatmap raster cells in m");
+    oc.doRegister("heatmap-output.period", new Option_String("3600", "TIME"));
+    oc.addDescription("heatmap-output.period", "Output", "The aggregation period of the heatmap output");
 
 
     oc.doRegister("summary-output", new Option_FileName());
@@ -200,6 +224,12 @@ MSFrame::fillOptions() {
     oc.doRegister("vehroute-output.skip-ptlines", new Option_Bool(false));
     oc.addDescription("vehroute-output.skip-ptlines", "Output", "Skip vehroute output for public transport vehicles");
 
+    oc.doRegister("vehroute-output.dictionary", new Option_Bool(false));
+    oc.addDescription("vehroute-output.dictionary", "Output", "Write each distinct route only once and let vehicles reference it by id");
+
+    oc.doRegister("phase-timing-output", new Option_FileName());
+    oc.addDescription("phase-timing-output", "Output", "Save per-step wall clock timings of the simulation phases (in microseconds) into FILE");
+
     oc.doRegister("link-output", new Option_FileName());
     oc.addDescription("link-output", "Output", "Save links states into FILE");
 
@@ -229,6 +259,9 @@ MSFrame::fillOptions() {
     oc.addDescription("save-state.times", "Output", "Use INT[] as times at which a network state written");
     oc.doRegister("save-state.period", new Option_String("-1", "TIME"));
     oc.addDescription("save-state.period", "Output", "save state repeatedly after TIME period");
+
+    oc.doRegister("save-state.period.keep", new Option_Integer(0));
+    oc.addDescription("save-state.period.keep", "Output", "Keep only the last INT periodic state files (0 keeps all)");
     oc.doRegister("save-state.prefix", new Option_FileName("state"));
     oc.addDescription("save-state.prefix", "Output", "Prefix for network states");
     oc.doRegister("save-state.suffix", new Option_String(".sbx"));
@@ -236,6 +269,9 @@ MSFrame::fillOptions() {
     oc.doRegister("save-state.files", new Option_FileName());//
     oc.addDescription("save-state.files", "Output", "Files for network states");
 
+    oc.doRegister("save-state.parallel", new Option_Bool(false));
+    oc.addDescription("save-state.parallel", "Output", "Write state snapshots from a forked background process (not available on Windows)");
+
     // register the simulation settings
     oc.doRegister("begin", 'b', new Option_String("0", "TIME"));
     oc.addDescription("begin", "Time", "Defines the begin time in seconds; The simulation starts at this time");
@@ -260,6 +296,9 @@ MSFrame::fillOptions() {
     oc.doRegister("route-steps", 's', new Option_String("200", "TIME"));
     oc.addDescription("route-steps", "Processing", "Load routes for the next number of seconds ahead");
 
+    oc.doRegister("validate", new Option_Bool(false));
+    oc.addDescription("validate", "Processing", "Quit after loading the configuration, the network and all route input without running the simulation");
+
     oc.doRegister("no-internal-links", new Option_Bool(false));
     oc.addDescription("no-internal-links", "Processing", "Disable (junction) internal links");
 
@@ -284,12 +323,30 @@ MSFrame::fillOptions() {
     oc.doRegister("collision.mingap-factor", new Option_Float(1.0));
     oc.addDescription("collision.mingap-factor", "Processing", "Sets the fraction of minGap that must be maintained to avoid collision detection.");
 
+    oc.doRegister("threads", new Option_Integer(1));
+    oc.addDescription("threads", "Processing", "Defines how many threads are used for the longitudinal movement computation");
+
+    oc.doRegister("threads.affinity", new Option_Bool(false));
+    oc.addDescription("threads.affinity", "Processing", "Pin each simulation worker thread to its own logical processor");
+
     oc.doRegister("max-num-vehicles", new Option_Integer(-1));
     oc.addDescription("max-num-vehicles", "Processing", "Delay vehicle insertion to stay within the given maximum number");
 
     oc.doRegister("max-num-teleports", new Option_Integer(-1));
     oc.addDescription("max-num-teleports", "Processing", "Abort the simulation if the given maximum number of teleports is exceeded");
 
+    oc.doRegister("gridlock-check", new Option_String("0", "TIME"));
+    oc.addDescription("gridlock-check", "Processing", "Check every TIME whether the network is gridlocked and warn naming the most affected junctions (0 disables the check)");
+
+    oc.doRegister("gridlock-check.waiting-time", new Option_String("60", "TIME"));
+    oc.addDescription("gridlock-check.waiting-time", "Processing", "A vehicle counts as blocked in the gridlock check after waiting for the given time");
+
+    oc.doRegister("gridlock-check.threshold", new Option_Float(0.5));
+    oc.addDescription("gridlock-check.threshold", "Processing", "Raise the gridlock alarm when the given fraction of the running vehicles is blocked");
+
+    oc.doRegister("gridlock-check.abort", new Option_Bool(false));
+    oc.addDescription("gridlock-check.abort", "Processing", "Abort the simulation when the gridlock alarm is raised");
+
     oc.doRegister("scale", new Option_Float(1.));
     oc.addDescription("scale", "Processing", "Scale demand by the given factor (by discarding or duplicating vehicles)");
 
@@ -311,6 +368,12 @@ MSFrame::fillOptions() {
     oc.doRegister("eager-insert", new Option_Bool(false));
     oc.addDescription("eager-insert", "Processing", "Whether each vehicle is checked separately for insertion on an edge");
 
+    oc.doRegister("step-deadline", new Option_String("0", "TIME"));
+    oc.addDescription("step-deadline", "Processing", "Skip the optional per-step outputs (fcd, netstate, emission, ...) in steps whose computation already took the given wall-clock time (for soft real-time deployments)");
+
+    oc.doRegister("skip-idle-steps", new Option_Bool(false));
+    oc.addDescription("skip-idle-steps", "Processing", "Jump over time steps in which no vehicle is active and no departure, scheduled event or interval output is due (disabled while a step-bound output is active)");
+
     oc.doRegister("random-depart-offset", new Option_String("0", "TIME"));
     oc.addDescription("random-depart-offset", "Processing", "Each vehicle receives a random offset to its depart value drawn uniformly from [0, TIME]");
 
@@ -348,7 +411,7 @@ MSFrame::fillOptions() {
     // generic routing options
     oc.doRegister("routing-algorithm", new Option_String("dijkstra"));
     oc.addDescription("routing-algorithm", "Routing",
-                      "Select among routing algorithms ['dijkstra', 'astar', 'CH', 'CHWrapper']");
+                      "Select among routing algorithms ['dijkstra', 'bidijkstra', 'astar', 'CH', 'CHWrapper', 'auto']");
     oc.doRegister("weights.random-factor", new Option_Float(1.));
     oc.addDescription("weights.random-factor", "Routing", "Edge weights for routing are dynamically disturbed by a random factor drawn uniformly from [1,FLOAT)");
 
@@ -486,6 +549,7 @@ MSFrame::buildStreams() {
     OutputDevice::createDeviceByOption("netstate-dump", "netstate", "netstate_file.xsd");
     OutputDevice::createDeviceByOption("summary-output", "summary", "summary_file.xsd");
     OutputDevice::createDeviceByOption("tripinfo-output", "tripinfos", "tripinfo_file.xsd");
+    OutputDevice::createDeviceByOption("phase-timing-output", "phase-timings");
 
     //extended
     OutputDevice::createDeviceByOption("fcd-output", "fcd-export", "fcd_file.xsd");
@@ -495,6 +559,7 @@ MSFrame::buildStreams() {
     OutputDevice::createDeviceByOption("full-output", "full-export", "full_file.xsd");
     OutputDevice::createDeviceByOption("queue-output", "queue-export", "queue_file.xsd");
     OutputDevice::createDeviceByOption("amitran-output", "trajectories", "amitran/trajectories.xsd\" timeStepSize=\"" + toString(STEPS2MS(DELTA_T)));
+    OutputDevice::createDeviceByOption("heatmap-output", "heatmaps");
 
     //OutputDevice::createDeviceByOption("vtk-output", "vtk-export");
     OutputDevice::createDeviceByOption("link-output", "link-output");
@@ -527,6 +592,15 @@ MSFrame::checkOptions() {
         WRITE_ERROR("A vehroute-output file is needed for exit times.");
         ok = false;
     }
+    if (oc.getBool("netstate-dump.delta") && oc.getBool("mesosim")) {
+        WRITE_ERROR("Option --netstate-dump.delta is not supported in mesoscopic simulation.");
+        ok = false;
+    }
+#ifdef WIN32
+    if (oc.getBool("save-state.parallel")) {
+        WRITE_WARNING("Option --save-state.parallel is not available on Windows; state will be saved synchronously.");
+    }
+#endif
     if (oc.isSet("gui-settings-file") &&
             oc.getString("gui-settings-file") != "" &&
             !oc.isUsableFileList("gui-settings-file")) {
@@ -542,6 +616,11 @@ MSFrame::checkOptions() {
     if (oc.getBool("meso-junction-control.limited") && !oc.getBool("meso-junction-control")) {
         oc.set("meso-junction-control", "true");
     }
+    if (oc.getBool("validate")) {
+        // load the complete route input in one go so it is checked entirely
+        oc.resetWritable();
+        oc.set("route-steps", "0");
+    }
     const SUMOTime begin = string2time(oc.getString("begin"));
     const SUMOTime end = string2time(oc.getString("end"));
     if (begin < 0) {
@@ -638,10 +717,19 @@ MSFrame::setMSGlobals(OptionsCont& oc) {
         MSGlobals::gUsingInternalLanes = false;
     }
     MSGlobals::gWaitingTimeMemory = string2time(oc.getString("waiting-time-memory"));
+    MSGlobals::gNumSimThreads = oc.getInt("threads");
+    MSGlobals::gThreadAffinity = oc.getBool("threads.affinity");
+#ifndef HAVE_FOX
+    if (MSGlobals::gNumSimThreads > 1) {
+        WRITE_WARNING("Parallel simulation is only possible when compiled with Fox.");
+        MSGlobals::gNumSimThreads = 1;
+    }
+#endif
     MSAbstractLaneChangeModel::initGlobalOptions(oc);
     MSLane::initCollisionOptions(oc);
 
     DELTA_T = string2time(oc.getString("step-length"));
+    TS = STEPS2TIME(DELTA_T);
 
 
     bool integrationMethodSet = !oc.isDefault("step-method.ballistic");
@@ -65,5 +65,9 @@ bool MSGlobals::gSemiImplicitEulerUpdate;
 SUMOTime MSGlobals::gWaitingTimeMemory;
 
 SUMOTime MSGlobals::gActionStepLength;
+
+int MSGlobals::gNumSimThreads;
+
+bool MSGlobals::gThreadAffinity;
 /****************************************************************************/
 
@@ -117,6 +117,12 @@ public:
     /// default value for the interval between two action points for MSVehicle (defaults to DELTA_T)
     static SUMOTime gActionStepLength;
 
+    /// how many threads to use for simulation
+    static int gNumSimThreads;
+
+    /// whether the simulation worker threads shall be pinned to processors
+    static bool gThreadAffinity;
+
 };
 
 
@@ -35,6 +35,8 @@
 #include <algorithm>
 #include <cassert>
 #include <iterator>
+#include <map>
+#include <utils/common/MemoryArena.h>
 #include <microsim/devices/MSDevice_Routing.h>
 #include "MSGlobals.h"
 #include "MSVehicle.h"
@@ -102,13 +104,31 @@ MSInsertionControl::emitVehicles(SUMOTime time) {
     //  time step
     MSVehicleContainer::VehicleVector refusedEmits;
 
-    // go through the list of previously refused vehicles, first
+    // group the due candidates by departure edge so all candidates of an
+    //  edge are tried en bloc and the edge's per-lane insertion-failure
+    //  memory is hit while it is still cache-hot; iteration over the map is
+    //  ordered by the numerical edge id and hence deterministic
+    typedef std::vector<SUMOVehicle*, ArenaAllocator<SUMOVehicle*> > ArenaVehicleVector;
+    typedef std::map<int, ArenaVehicleVector, std::less<int>,
+            ArenaAllocator<std::pair<const int, ArenaVehicleVector> > > EmitsByEdge;
+    // the map is rebuilt every step, draw it from the per-step arena
+    ArenaAllocator<SUMOVehicle*> arenaAlloc(MSNet::getInstance()->getStepArena());
+    EmitsByEdge emitsByEdge((std::less<int>()), arenaAlloc);
     MSVehicleContainer::VehicleVector::const_iterator veh;
     for (veh = myPendingEmits.begin(); veh != myPendingEmits.end(); veh++) {
         if (havePreChecked && (myEmitCandidates.count(*veh) == 0)) {
             refusedEmits.push_back(*veh);
         } else {
-            numEmitted += tryInsert(time, *veh, refusedEmits);
+            EmitsByEdge::iterator it = emitsByEdge.find((*veh)->getEdge()->getNumericalID());
+            if (it == emitsByEdge.end()) {
+                it = emitsByEdge.insert(std::make_pair((*veh)->getEdge()->getNumericalID(), ArenaVehicleVector(arenaAlloc))).first;
+            }
+            it->second.push_back(*veh);
+        }
+    }
+    for (EmitsByEdge::const_iterator i = emitsByEdge.begin(); i != emitsByEdge.end(); ++i) {
+        for (ArenaVehicleVector::const_iterator v = i->second.begin(); v != i->second.end(); ++v) {
+            numEmitted += tryInsert(time, *v, refusedEmits);
         }
     }
     myEmitCandidates.clear();
@@ -249,6 +269,22 @@ MSInsertionControl::getPendingFlowCount() const {
 }
 
 
+SUMOTime
+MSInsertionControl::getNextDeparture() const {
+    SUMOTime result = myAllVeh.isEmpty() ? SUMOTime_MAX : myAllVeh.topTime();
+    for (std::vector<Flow>::const_iterator i = myFlows.begin(); i != myFlows.end(); ++i) {
+        const SUMOVehicleParameter* const pars = (*i).pars;
+        if (pars->repetitionProbability > 0) {
+            // may emit in any step of [depart, repetitionEnd)
+            result = MIN2(result, pars->depart);
+        } else {
+            result = MIN2(result, (SUMOTime)(pars->depart + pars->repetitionsDone * pars->repetitionOffset));
+        }
+    }
+    return result;
+}
+
+
 void
 MSInsertionControl::descheduleDeparture(const SUMOVehicle* veh) {
     myAbortedEmits.insert(veh);
@@ -133,6 +133,17 @@ public:
      */
     int getPendingFlowCount() const;
 
+
+    /** @brief Returns the depart time of the next vehicle or flow emission
+     *
+     * Vehicles which already failed to be inserted (and are retried every
+     *  step) are not considered; probabilistic flows whose interval has begun
+     *  report their begin time since they may emit in any step.
+     *
+     * @return The next known departure time (SUMOTime_MAX if none is known)
+     */
+    SUMOTime getNextDeparture() const;
+
     /// @brief stops trying to emit the given vehicle (because it already departed)
     void alreadyDeparted(SUMOVehicle* veh);
 
@@ -36,6 +36,7 @@
 #endif
 
 #include <cmath>
+#include <typeinfo>
 #include <bitset>
 #include <iostream>
 #include <cassert>
@@ -54,6 +55,9 @@
 #include <utils/geom/GeomHelper.h>
 #include <microsim/pedestrians/MSPModel.h>
 #include <microsim/lcmodels/MSAbstractLaneChangeModel.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 #include "MSNet.h"
 #include "MSVehicleType.h"
 #include "MSEdge.h"
@@ -177,7 +181,6 @@ MSLane::MSLane(const std::string& id, double maxSpeed, double length, MSEdge* co
     myBruttoVehicleLengthSum(0), myNettoVehicleLengthSum(0),
     myLeaderInfo(this, 0, 0),
     myFollowerInfo(this, 0, 0),
-    myLeaderInfoTmp(this, 0, 0),
     myLeaderInfoTime(SUMOTime_MIN),
     myFollowerInfoTime(SUMOTime_MIN),
     myLengthGeometryFactor(MAX2(POSITION_EPS, myShape.length()) / myLength), // factor should not be 0
@@ -217,7 +220,15 @@ MSLane::addNeigh(const std::string& id) {
 // ------ interaction with MSMoveReminder ------
 void
 MSLane::addMoveReminder(MSMoveReminder* rem) {
-    myMoveReminders.push_back(rem);
+    // keep reminders of the same concrete type adjacent so that the
+    // per-vehicle notification chain runs over monomorphic groups
+    std::vector<MSMoveReminder*>::iterator insertPos = myMoveReminders.end();
+    for (std::vector<MSMoveReminder*>::iterator i = myMoveReminders.begin(); i != myMoveReminders.end(); ++i) {
+        if (typeid(**i) == typeid(*rem)) {
+            insertPos = i + 1;
+        }
+    }
+    myMoveReminders.insert(insertPos, rem);
     for (VehCont::iterator veh = myVehicles.begin(); veh != myVehicles.end(); ++veh) {
         (*veh)->addReminder(rem);
     }
@@ -299,7 +310,7 @@ MSLane::incorporateVehicle(MSVehicle* veh, double pos, double speed, double posL
     }
     myBruttoVehicleLengthSum += veh->getVehicleType().getLengthWithGap();
     myNettoVehicleLengthSum += veh->getVehicleType().getLength();
-    myEdge->markDelayed();
+    myEdge->markVehicleEntered(MSNet::getInstance()->getCurrentTimeStep());
     if (wasInactive) {
         MSNet::getInstance()->getEdgeControl().gotActive(this);
     }
@@ -964,10 +975,13 @@ MSLane::safeInsertionSpeed(const MSVehicle* veh, double seen, const MSLeaderInfo
 
 
 // ------ Handling vehicles lapping into lanes ------
-const MSLeaderInfo&
+const MSLeaderInfo
 MSLane::getLastVehicleInformation(const MSVehicle* ego, double latOffset, double minPos, bool allowCached) const {
+#ifdef HAVE_FOX
+    FXConditionalLock lock(myLeaderInfoMutex, MSGlobals::gNumSimThreads > 1);
+#endif
     if (myLeaderInfoTime < MSNet::getInstance()->getCurrentTimeStep() || ego != 0 || minPos > 0 || !allowCached) {
-        myLeaderInfoTmp = MSLeaderInfo(this, ego, latOffset);
+        MSLeaderInfo leaderTmp(this, ego, latOffset);
         AnyVehicleIterator last = anyVehiclesBegin();
         int freeSublanes = 1; // number of sublanes for which no leader was found
         //if (ego->getID() == "disabled" && SIMTIME == 58) {
@@ -983,10 +997,10 @@ MSLane::getLastVehicleInformation(const MSVehicle* ego, double latOffset, double
 #endif
             if (veh != ego && veh->getPositionOnLane(this) >= minPos) {
                 const double latOffset = veh->getLatOffset(this);
-                freeSublanes = myLeaderInfoTmp.addLeader(veh, true, latOffset);
+                freeSublanes = leaderTmp.addLeader(veh, true, latOffset);
 #ifdef DEBUG_PLAN_MOVE
                 if (DEBUG_COND2(ego)) {
-                    std::cout << "         latOffset=" << latOffset << " newLeaders=" << myLeaderInfoTmp.toString() << "\n";
+                    std::cout << "         latOffset=" << latOffset << " newLeaders=" << leaderTmp.toString() << "\n";
                 }
 #endif
             }
@@ -995,7 +1009,7 @@ MSLane::getLastVehicleInformation(const MSVehicle* ego, double latOffset, double
         if (ego == 0 && minPos == 0) {
             // update cached value
             myLeaderInfoTime = MSNet::getInstance()->getCurrentTimeStep();
-            myLeaderInfo = myLeaderInfoTmp;
+            myLeaderInfo = leaderTmp;
         }
 #ifdef DEBUG_PLAN_MOVE
         //if (DEBUG_COND2(ego)) std::cout << SIMTIME
@@ -1005,23 +1019,26 @@ MSLane::getLastVehicleInformation(const MSVehicle* ego, double latOffset, double
         //        << "    vehicles=" << toString(myVehicles)
         //        << "    partials=" << toString(myPartialVehicles)
         //        << "\n"
-        //        << "    result=" << myLeaderInfoTmp.toString()
+        //        << "    result=" << leaderTmp.toString()
         //        << "    cached=" << myLeaderInfo.toString()
         //        << "    myLeaderInfoTime=" << myLeaderInfoTime
         //        << "\n";
         gDebugFlag1 = false;
 #endif
-        return myLeaderInfoTmp;
+        return leaderTmp;
     }
     return myLeaderInfo;
 }
 
 
-const MSLeaderInfo&
+const MSLeaderInfo
 MSLane::getFirstVehicleInformation(const MSVehicle* ego, double latOffset, bool onlyFrontOnLane, double maxPos, bool allowCached) const {
+#ifdef HAVE_FOX
+    FXConditionalLock lock(myFollowerInfoMutex, MSGlobals::gNumSimThreads > 1);
+#endif
     if (myFollowerInfoTime < MSNet::getInstance()->getCurrentTimeStep() || ego != 0 || maxPos < myLength || !allowCached || onlyFrontOnLane) {
         // XXX separate cache for onlyFrontOnLane = true
-        myLeaderInfoTmp = MSLeaderInfo(this, ego, latOffset);
+        MSLeaderInfo followerTmp(this, ego, latOffset);
         AnyVehicleIterator first = anyVehiclesUpstreamBegin();
         int freeSublanes = 1; // number of sublanes for which no leader was found
         const MSVehicle* veh = *first;
@@ -1040,14 +1057,14 @@ MSLane::getFirstVehicleInformation(const MSVehicle* ego, double latOffset, bool
                     std::cout << "          veh=" << veh->getID() << " latOffset=" << latOffset << "\n";
                 }
 #endif
-                freeSublanes = myLeaderInfoTmp.addLeader(veh, true, latOffset);
+                freeSublanes = followerTmp.addLeader(veh, true, latOffset);
             }
             veh = *(++first);
         }
         if (ego == 0 && maxPos == std::numeric_limits<double>::max()) {
             // update cached value
             myFollowerInfoTime = MSNet::getInstance()->getCurrentTimeStep();
-            myFollowerInfo = myLeaderInfoTmp;
+            myFollowerInfo = followerTmp;
         }
 #ifdef DEBUG_PLAN_MOVE
         //if (DEBUG_COND2(ego)) std::cout << SIMTIME
@@ -1057,12 +1074,12 @@ MSLane::getFirstVehicleInformation(const MSVehicle* ego, double latOffset, bool
         //        << "    vehicles=" << toString(myVehicles)
         //        << "    partials=" << toString(myPartialVehicles)
         //        << "\n"
-        //        << "    result=" << myLeaderInfoTmp.toString()
+        //        << "    result=" << followerTmp.toString()
         //        //<< "    cached=" << myLeaderInfo.toString()
         //        << "    myLeaderInfoTime=" << myLeaderInfoTime
         //        << "\n";
 #endif
-        return myLeaderInfoTmp;
+        return followerTmp;
     }
     return myFollowerInfo;
 }
@@ -1103,6 +1120,14 @@ MSLane::planMovements(SUMOTime t) {
 }
 
 
+void
+MSLane::setJunctionApproaches() const {
+    for (VehCont::const_iterator veh = myVehicles.begin(); veh != myVehicles.end(); ++veh) {
+        (*veh)->setApproachingForAllLinks();
+    }
+}
+
+
 void
 MSLane::updateLeaderInfo(const MSVehicle* veh, VehCont::reverse_iterator& vehPart, VehCont::reverse_iterator& vehRes, MSLeaderInfo& ahead) const {
     bool morePartialVehsAhead = vehPart != myPartialVehicles.rend();
@@ -1572,9 +1597,11 @@ MSLane::executeMovements(SUMOTime t, std::vector<MSLane*>& lanesWithVehiclesToIn
         if (MSGlobals::gTimeToGridlock > 0 || MSGlobals::gTimeToGridlockHighways > 0) {
             MSVehicle* veh = myVehicles.back(); // the vehice at the front of the queue
             if (!veh->isStopped() && veh->getLane() == this) {
-                const bool wrongLane = !veh->getLane()->appropriate(veh);
                 const bool r1 = MSGlobals::gTimeToGridlock > 0 && veh->getWaitingTime() > MSGlobals::gTimeToGridlock;
-                const bool r2 = MSGlobals::gTimeToGridlockHighways > 0 && veh->getWaitingTime() > MSGlobals::gTimeToGridlockHighways && veh->getLane()->getSpeedLimit() > 69. / 3.6 && wrongLane;
+                // only check the lane continuation when a deadline has passed (it searches the best lanes)
+                const bool r2Candidate = MSGlobals::gTimeToGridlockHighways > 0 && veh->getWaitingTime() > MSGlobals::gTimeToGridlockHighways && veh->getLane()->getSpeedLimit() > 69. / 3.6;
+                const bool wrongLane = (r1 || r2Candidate) && !veh->getLane()->appropriate(veh);
+                const bool r2 = r2Candidate && wrongLane;
                 if (r1 || r2) {
                     const MSLinkCont::const_iterator link = succLinkSec(*veh, 1, *this, veh->getBestLanesContinuation());
                     const bool minorLink = !wrongLane && (link != myLinks.end()) && !((*link)->havePriority());
@@ -1669,9 +1696,12 @@ MSLane::clear() {
 
 void
 MSLane::insertIDs(std::vector<std::string>& into) {
+    // keep the former (sorted) order although the dictionary is now hashed
+    const int offset = (int)into.size();
     for (DictType::iterator i = myDict.begin(); i != myDict.end(); ++i) {
         into.push_back((*i).first);
     }
+    std::sort(into.begin() + offset, into.end());
 }
 
 
@@ -1712,7 +1742,7 @@ MSLane::appropriate(const MSVehicle* veh) {
 
 
 bool
-MSLane::integrateNewVehicle(SUMOTime) {
+MSLane::integrateNewVehicle(SUMOTime t) {
     bool wasInactive = myVehicles.size() == 0;
     sort(myVehBuffer.begin(), myVehBuffer.end(), vehicle_position_sorter(this));
     for (std::vector<MSVehicle*>::const_iterator i = myVehBuffer.begin(); i != myVehBuffer.end(); ++i) {
@@ -1722,7 +1752,7 @@ MSLane::integrateNewVehicle(SUMOTime) {
         myBruttoVehicleLengthSum += veh->getVehicleType().getLengthWithGap();
         myNettoVehicleLengthSum += veh->getVehicleType().getLength();
         //if (true) std::cout << SIMTIME << " integrateNewVehicle lane=" << getID() << " veh=" << veh->getID() << " (on lane " << veh->getLane()->getID() << ") into lane=" << getID() << " myBrutto=" << myBruttoVehicleLengthSum << "\n";
-        myEdge->markDelayed();
+        myEdge->markVehicleEntered(t);
     }
     myVehBuffer.clear();
     //std::cout << SIMTIME << " integrateNewVehicle lane=" << getID() << " myVehicles1=" << toString(myVehicles);
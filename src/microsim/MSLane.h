@@ -38,6 +38,8 @@
 
 #include <vector>
 #include <deque>
+#include <map>
+#include <unordered_map>
 #include <cassert>
 #include <utils/common/Named.h>
 #include <utils/common/Parameterised.h>
@@ -49,6 +51,9 @@
 #include "MSLeaderInfo.h"
 #include "MSMoveReminder.h"
 #include <libsumo/Helper.h>
+#ifdef HAVE_FOX
+#include <fx.h>
+#endif
 
 
 // ===========================================================================
@@ -347,11 +352,13 @@ public:
      * @param[in] minPos The minimum position from which to start search for leaders
      * @param[in] allowCached Whether the cached value may be used
      * @return Information about the last vehicles
+     * @note Returns a copy since the internal cache may be refreshed by
+     *  another thread during the parallel plan phase
      */
-    const MSLeaderInfo& getLastVehicleInformation(const MSVehicle* ego, double latOffset, double minPos = 0, bool allowCached = true) const;
+    const MSLeaderInfo getLastVehicleInformation(const MSVehicle* ego, double latOffset, double minPos = 0, bool allowCached = true) const;
 
     /// @brief analogue to getLastVehicleInformation but in the upstream direction
-    const MSLeaderInfo& getFirstVehicleInformation(const MSVehicle* ego, double latOffset, bool onlyFrontOnLane, double maxPos = std::numeric_limits<double>::max(), bool allowCached = true) const;
+    const MSLeaderInfo getFirstVehicleInformation(const MSVehicle* ego, double latOffset, bool onlyFrontOnLane, double maxPos = std::numeric_limits<double>::max(), bool allowCached = true) const;
 
     /// @}
 
@@ -530,14 +537,21 @@ public:
     /// @{
 
     /** @brief Compute safe velocities for all vehicles based on positions and
-     * speeds from the last time step. Also registers
-     * ApproachingVehicleInformation for all links
+     * speeds from the last time step.
      *
      * This method goes through all vehicles calling their "planMove" method.
      * @see MSVehicle::planMove
      */
     virtual void planMovements(const SUMOTime t);
 
+    /** @brief Register junction approaches for all vehicles after planMovements
+     *
+     * The approaching information of a link is shared between vehicles from
+     *  different edges, so this must not run concurrently with other lanes.
+     * @see MSVehicle::setApproachingForAllLinks
+     */
+    void setJunctionApproaches() const;
+
     /** @brief This updates the MSLeaderInfo argument with respect to the given MSVehicle.
      *         All leader-vehicles on the same edge, which are relevant for the vehicle
      *         (i.e. with position > vehicle's position) and not already integrated into
@@ -1239,13 +1253,18 @@ protected:
     /// @brief followers on all sublanes as seen by vehicles on consecutive lanes (cached)
     mutable MSLeaderInfo myFollowerInfo;
 
-    mutable MSLeaderInfo myLeaderInfoTmp;
-
     /// @brief time step for which myLeaderInfo was last updated
     mutable SUMOTime myLeaderInfoTime;
     /// @brief time step for which myFollowerInfo was last updated
     mutable SUMOTime myFollowerInfoTime;
 
+#ifdef HAVE_FOX
+    /// @brief mutexes protecting the leader/follower info caches
+    /// (lanes downstream of an edge may be queried from several plan workers)
+    mutable FXMutex myLeaderInfoMutex;
+    mutable FXMutex myFollowerInfoMutex;
+#endif
+
     /// @brief precomputed myShape.length / myLength
     const double myLengthGeometryFactor;
 
@@ -1263,8 +1282,8 @@ protected:
     // @brief transient changes in permissions
     std::map<long, SVCPermissions> myPermissionChanges;
 
-    /// definition of the static dictionary type
-    typedef std::map< std::string, MSLane* > DictType;
+    /// definition of the static dictionary type (hashed, the id lookup is on the hot TraCI path)
+    typedef std::unordered_map< std::string, MSLane* > DictType;
 
     /// Static dictionary to associate string-ids with objects.
     static DictType myDict;
@@ -77,7 +77,8 @@ MSLaneChanger::ChangeElem::ChangeElem(MSLane* _lane) :
     lastBlocked(0),
     firstBlocked(0),
     ahead(lane),
-    aheadNext(lane, 0, 0) {
+    aheadNext(lane, 0, 0),
+    followersNext(lane, 0, 0) {
 }
 
 void
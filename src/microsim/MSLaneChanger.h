@@ -102,6 +102,9 @@ public:
 
         // the vehicles in from of the current vehicle (including those on the next edge, contiously update during change() ))
         MSLeaderDistanceInfo aheadNext;
+
+        // the followers of the current vehicle on this lane (computed once per candidate vehicle, reused for all maneuver directions)
+        MSLeaderDistanceInfo followersNext;
         ///@}
 
     };
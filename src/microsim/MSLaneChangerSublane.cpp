@@ -179,6 +179,17 @@ assert(vehicle->getLane() == (*myCandi).lane);
         sublaneIndex += ce->ahead.numSublanes();
     }
 
+    // scanning for followers is expensive; do it once per vehicle for the
+    // current and the neighboring lanes and reuse the result for all
+    // candidate maneuvers (executed changes only happen after all candidates
+    // for this vehicle were evaluated so the cache cannot become stale)
+    for (int offset = -1; offset <= 1; offset++) {
+        if (mayChange(offset)) {
+            ChangerIt ce = myCandi + offset;
+            ce->followersNext = ce->lane->getFollowersOnConsecutive(vehicle, vehicle->getBackPositionOnLane(), true);
+        }
+    }
+
     LaneChangeAction alternatives = (LaneChangeAction)((mayChange(-1) ? LCA_RIGHT : LCA_NONE)
                                     | (mayChange(1) ? LCA_LEFT : LCA_NONE));
 
@@ -527,10 +538,10 @@ MSLaneChangerSublane::checkChangeSublane(
     int blocked = 0;
 
     MSLeaderDistanceInfo neighLeaders = target->aheadNext;
-    MSLeaderDistanceInfo neighFollowers = target->lane->getFollowersOnConsecutive(vehicle, vehicle->getBackPositionOnLane(), true);
+    MSLeaderDistanceInfo neighFollowers = target->followersNext;
     MSLeaderDistanceInfo neighBlockers(&neighLane, vehicle, vehicle->getLane()->getRightSideOnEdge() - neighLane.getRightSideOnEdge());
     MSLeaderDistanceInfo leaders = myCandi->aheadNext;
-    MSLeaderDistanceInfo followers = myCandi->lane->getFollowersOnConsecutive(vehicle, vehicle->getBackPositionOnLane(), true);
+    MSLeaderDistanceInfo followers = myCandi->followersNext;
     MSLeaderDistanceInfo blockers(vehicle->getLane(), vehicle, 0);
 
 #ifdef DEBUG_SURROUNDING
@@ -50,6 +50,56 @@ typedef std::pair<MSVehicle*, double> LeaderDist;
 // ===========================================================================
 // class definitions
 // ===========================================================================
+/* @brief storage for one value per sublane with an inline buffer for the
+ * common case of few sublanes (leader info objects are created millions of
+ * times per step when lateral-resolution is active so the usual sizes must
+ * not allocate) */
+template <class T>
+class MSSublaneValues {
+public:
+    MSSublaneValues(int size, const T& val) : mySize(0) {
+        assign(size, val);
+    }
+
+    /// @brief resize and reset all values
+    void assign(int size, const T& val) {
+        mySize = size;
+        if (size > MAX_INLINE) {
+            myOverflow.assign(size, val);
+        } else {
+            for (int i = 0; i < size; i++) {
+                myInline[i] = val;
+            }
+        }
+    }
+
+    int size() const {
+        return mySize;
+    }
+
+    T& operator[](int index) {
+        return mySize <= MAX_INLINE ? myInline[index] : myOverflow[index];
+    }
+
+    const T& operator[](int index) const {
+        return mySize <= MAX_INLINE ? myInline[index] : myOverflow[index];
+    }
+
+private:
+    /// @brief the maximum number of values stored without heap allocation
+    static const int MAX_INLINE = 8;
+
+    /// @brief the values when there are at most MAX_INLINE of them
+    T myInline[MAX_INLINE];
+
+    /// @brief fallback storage for lanes with many sublanes
+    std::vector<T> myOverflow;
+
+    /// @brief the number of values
+    int mySize;
+};
+
+
 /**
  * @class MSLeaderInfo
  */
@@ -115,7 +165,7 @@ protected:
     // @note: not const to simplify assignment
     double myWidth;
 
-    std::vector<const MSVehicle*> myVehicles;
+    MSSublaneValues<const MSVehicle*> myVehicles;
 
     /// @brief the number of free sublanes
     // if an ego vehicle is given in the constructor, the number of free
@@ -171,7 +221,7 @@ public:
 
 protected:
 
-    std::vector<double> myDistances;
+    MSSublaneValues<double> myDistances;
 
 };
 
@@ -221,7 +271,7 @@ public:
 protected:
 
     // @brief the differences between requriedGap and actual gap for each of the followers
-    std::vector<double> myMissingGaps;
+    MSSublaneValues<double> myMissingGaps;
 
 };
 
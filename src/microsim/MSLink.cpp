@@ -266,9 +266,12 @@ MSLink::setApproaching(const SUMOVehicle* approaching, const SUMOTime arrivalTim
         }
     }
 #endif
-    myApproachingVehicles.insert(std::make_pair(approaching,
-                                 ApproachingVehicleInformation(arrivalTime, leaveTime, arrivalSpeed, leaveSpeed, setRequest,
-                                         arrivalTimeBraking, arrivalSpeedBraking, waitingTime, dist)));
+    ApproachingVehicles::iterator i = std::lower_bound(myApproachingVehicles.begin(), myApproachingVehicles.end(), approaching, &approachingBefore);
+    if (i == myApproachingVehicles.end() || i->first != approaching) {
+        myApproachingVehicles.insert(i, std::make_pair(approaching,
+                                     ApproachingVehicleInformation(arrivalTime, leaveTime, arrivalSpeed, leaveSpeed, setRequest,
+                                             arrivalTimeBraking, arrivalSpeedBraking, waitingTime, dist)));
+    }
 }
 
 
@@ -283,7 +286,10 @@ MSLink::setApproaching(const SUMOVehicle* approaching, ApproachingVehicleInforma
         }
     }
 #endif
-    myApproachingVehicles.insert(std::make_pair(approaching, ai));
+    ApproachingVehicles::iterator i = std::lower_bound(myApproachingVehicles.begin(), myApproachingVehicles.end(), approaching, &approachingBefore);
+    if (i == myApproachingVehicles.end() || i->first != approaching) {
+        myApproachingVehicles.insert(i, std::make_pair(approaching, ai));
+    }
 }
 
 
@@ -317,14 +323,17 @@ MSLink::removeApproaching(const SUMOVehicle* veh) {
         }
     }
 #endif
-    myApproachingVehicles.erase(veh);
+    ApproachingVehicles::iterator i = std::lower_bound(myApproachingVehicles.begin(), myApproachingVehicles.end(), veh, &approachingBefore);
+    if (i != myApproachingVehicles.end() && i->first == veh) {
+        myApproachingVehicles.erase(i);
+    }
 }
 
 
 MSLink::ApproachingVehicleInformation
 MSLink::getApproaching(const SUMOVehicle* veh) const {
-    std::map<const SUMOVehicle*, ApproachingVehicleInformation>::const_iterator i = myApproachingVehicles.find(veh);
-    if (i != myApproachingVehicles.end()) {
+    ApproachingVehicles::const_iterator i = std::lower_bound(myApproachingVehicles.begin(), myApproachingVehicles.end(), veh, &approachingBefore);
+    if (i != myApproachingVehicles.end() && i->first == veh) {
         return i->second;
     } else {
         return ApproachingVehicleInformation(-1000, -1000, 0, 0, false, -1000, 0, 0, 0);
@@ -332,6 +341,13 @@ MSLink::getApproaching(const SUMOVehicle* veh) const {
 }
 
 
+bool
+MSLink::approachingBefore(const std::pair<const SUMOVehicle*, ApproachingVehicleInformation>& item,
+                          const SUMOVehicle* veh) {
+    return item.first->getID() < veh->getID();
+}
+
+
 SUMOTime
 MSLink::getLeaveTime(const SUMOTime arrivalTime, const double arrivalSpeed,
                      const double leaveSpeed, const double vehicleLength) const {
@@ -354,8 +370,12 @@ MSLink::opened(SUMOTime arrivalTime, double arrivalSpeed, double leaveSpeed, dou
         // check for foes on the same lane
         for (std::vector<MSLink*>::const_iterator it = mySublaneFoeLinks.begin(); it != mySublaneFoeLinks.end(); ++it) {
             const MSLink* foeLink = *it;
+            if (!foeLink->isBlockingAnyone()) {
+                // no vehicle is approaching this foe link
+                continue;
+            }
             assert(myLane != foeLink->getLane());
-            for (std::map<const SUMOVehicle*, ApproachingVehicleInformation>::const_iterator i = foeLink->myApproachingVehicles.begin(); i != foeLink->myApproachingVehicles.end(); ++i) {
+            for (ApproachingVehicles::const_iterator i = foeLink->myApproachingVehicles.begin(); i != foeLink->myApproachingVehicles.end(); ++i) {
                 const SUMOVehicle* foe = i->first;
                 if (
                     // there only is a conflict if the paths cross
@@ -405,6 +425,11 @@ MSLink::opened(SUMOTime arrivalTime, double arrivalSpeed, double leaveSpeed, dou
 #endif
 
     for (std::vector<MSLink*>::const_iterator i = myFoeLinks.begin(); i != myFoeLinks.end(); ++i) {
+        if (!(*i)->isBlockingAnyone()) {
+            // uncontested links (the common case on lightly loaded junctions)
+            //  need no per-vehicle checks at all
+            continue;
+        }
         if (MSGlobals::gUseMesoSim) {
             if ((*i)->haveRed()) {
                 continue;
@@ -426,7 +451,7 @@ bool
 MSLink::blockedAtTime(SUMOTime arrivalTime, SUMOTime leaveTime, double arrivalSpeed, double leaveSpeed,
                       bool sameTargetLane, double impatience, double decel, SUMOTime waitingTime,
                       std::vector<const SUMOVehicle*>* collectFoes, const SUMOVehicle* ego) const {
-    for (std::map<const SUMOVehicle*, ApproachingVehicleInformation>::const_iterator i = myApproachingVehicles.begin(); i != myApproachingVehicles.end(); ++i) {
+    for (ApproachingVehicles::const_iterator i = myApproachingVehicles.begin(); i != myApproachingVehicles.end(); ++i) {
 #ifdef MSLink_DEBUG_OPENED
         if (gDebugFlag1) {
             if (ego != 0
@@ -612,13 +637,13 @@ MSLink::writeApproaching(OutputDevice& od, const std::string fromLaneID) const {
         od.writeAttr(SUMO_ATTR_VIA, via);
         od.writeAttr(SUMO_ATTR_TO, getLane() == 0 ? "" : getLane()->getID());
         std::vector<std::pair<SUMOTime, const SUMOVehicle*> > toSort; // stabilize output
-        for (std::map<const SUMOVehicle*, ApproachingVehicleInformation>::const_iterator it = myApproachingVehicles.begin(); it != myApproachingVehicles.end(); ++it) {
+        for (ApproachingVehicles::const_iterator it = myApproachingVehicles.begin(); it != myApproachingVehicles.end(); ++it) {
             toSort.push_back(std::make_pair(it->second.arrivalTime, it->first));
         }
         std::sort(toSort.begin(), toSort.end());
         for (std::vector<std::pair<SUMOTime, const SUMOVehicle*> >::const_iterator it = toSort.begin(); it != toSort.end(); ++it) {
             od.openTag("approaching");
-            const ApproachingVehicleInformation& avi = myApproachingVehicles.find(it->second)->second;
+            const ApproachingVehicleInformation avi = getApproaching(it->second);
             od.writeAttr(SUMO_ATTR_ID, it->second->getID());
             od.writeAttr(SUMO_ATTR_IMPATIENCE, it->second->getImpatience());
             od.writeAttr("arrivalTime", time2string(avi.arrivalTime));
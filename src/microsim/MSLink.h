@@ -120,30 +120,35 @@ public:
         }
 
         /// @brief The time the vehicle's front arrives at the link
-        const SUMOTime arrivalTime;
+        SUMOTime arrivalTime;
         /// @brief The estimated time at which the vehicle leaves the link
-        const SUMOTime leavingTime;
+        SUMOTime leavingTime;
         /// @brief The estimated speed with which the vehicle arrives at the link (for headway computation)
-        const double arrivalSpeed;
+        double arrivalSpeed;
         /// @brief The estimated speed with which the vehicle leaves the link (for headway computation)
-        const double leaveSpeed;
+        double leaveSpeed;
         /// @brief Whether the vehicle wants to pass the link (@todo: check semantics)
-        const bool willPass;
+        bool willPass;
         /// @brief The time the vehicle's front arrives at the link if it starts braking
-        const SUMOTime arrivalTimeBraking;
+        SUMOTime arrivalTimeBraking;
         /// @brief The estimated speed with which the vehicle arrives at the link if it starts braking(for headway computation)
-        const double arrivalSpeedBraking;
+        double arrivalSpeedBraking;
         /// @brief The waiting duration at the current link
-        const SUMOTime waitingTime;
+        SUMOTime waitingTime;
         /// @brief The distance up to the current link
-        const double dist;
-
-    private:
-        /// invalidated assignment operator
-        ApproachingVehicleInformation& operator=(const ApproachingVehicleInformation& s);
+        double dist;
 
     };
 
+    /** @brief The vehicles approaching this link together with their approach information
+     *
+     * The vector is kept sorted by the vehicle id so that iteration visits
+     *  the vehicles in the same deterministic order as the formerly used
+     *  map; with the handful of entries a link typically has, the sorted
+     *  vector avoids the per-step node allocations of the map.
+     */
+    typedef std::vector<std::pair<const SUMOVehicle*, ApproachingVehicleInformation> > ApproachingVehicles;
+
 
     /** @brief Constructor for simulation which uses internal lanes
      *
@@ -204,7 +209,7 @@ public:
     ApproachingVehicleInformation getApproaching(const SUMOVehicle* veh) const;
 
     /// @brief return all approaching vehicles
-    const std::map<const SUMOVehicle*, ApproachingVehicleInformation, SUMOVehicle::ComparatorIdLess>& getApproaching() const {
+    const ApproachingVehicles& getApproaching() const {
         return myApproachingVehicles;
     }
 
@@ -522,6 +527,10 @@ private:
                       bool sameTargetLane, double impatience, double decel, SUMOTime waitingTime,
                       const SUMOVehicle* ego) const;
 
+    /// @brief whether the given approach entry sorts before the given vehicle (for binary search)
+    static bool approachingBefore(const std::pair<const SUMOVehicle*, ApproachingVehicleInformation>& item,
+                                  const SUMOVehicle* veh);
+
 private:
     /// @brief The lane behind the junction approached by this link
     MSLane* myLane;
@@ -529,7 +538,7 @@ private:
     /// @brief The lane approaching this link
     MSLane* myLaneBefore;
 
-    std::map<const SUMOVehicle*, ApproachingVehicleInformation, SUMOVehicle::ComparatorIdLess> myApproachingVehicles;
+    ApproachingVehicles myApproachingVehicles;
     std::set<MSLink*> myBlockedFoeLinks;
 
     /// @brief The position within this respond
@@ -41,6 +41,7 @@
 #include <typeinfo>
 #include <algorithm>
 #include <cassert>
+#include <cstdio>
 #include <vector>
 #include <ctime>
 
@@ -61,11 +62,13 @@
 #include <utils/options/OptionsIO.h>
 #include <utils/shapes/ShapeContainer.h>
 #include <utils/vehicle/DijkstraRouter.h>
+#include <utils/vehicle/BidiDijkstraRouter.h>
 #include <utils/vehicle/AStarRouter.h>
 #include <utils/vehicle/PedestrianRouter.h>
 #include <utils/xml/SUMORouteLoaderControl.h>
 #include <utils/xml/XMLSubSys.h>
 #include <mesosim/MELoop.h>
+#include <mesosim/MEVehicle.h>
 #include <microsim/output/MSDetectorControl.h>
 #include <microsim/MSCModel_NonInteracting.h>
 #include <microsim/MSVehicleTransfer.h>
@@ -82,6 +85,7 @@
 #include <microsim/output/MSVTKExport.h>
 #include <microsim/output/MSXMLRawOut.h>
 #include <microsim/output/MSAmitranTrajectories.h>
+#include <microsim/output/MSHeatmapExport.h>
 #include <microsim/pedestrians/MSPModel.h>
 #include <microsim/pedestrians/MSPerson.h>
 #include <microsim/traffic_lights/MSTrafficLightLogic.h>
@@ -96,6 +100,7 @@
 #include "MSJunction.h"
 #include "MSJunctionLogic.h"
 #include "MSLane.h"
+#include "MSVehicle.h"
 #include "MSVehicleTransfer.h"
 #include "MSRoute.h"
 #include "MSGlobals.h"
@@ -134,13 +139,16 @@ const std::string MSNet::STAGE_INSERTIONS("insertion");
 // ===========================================================================
 double
 MSNet::getEffort(const MSEdge* const e, const SUMOVehicle* const v, double t) {
-    double value;
-    const MSVehicle* const veh = dynamic_cast<const MSVehicle* const>(v);
-    if (veh != 0 && veh->getWeightsStorage().retrieveExistingEffort(e, t, value)) {
-        return value;
-    }
-    if (getInstance()->getWeightsStorage().retrieveExistingEffort(e, t, value)) {
-        return value;
+    // the cast and the lookups are worth paying only if custom weights exist
+    if (MSEdgeWeightsStorage::hasWeights()) {
+        double value;
+        const MSVehicle* const veh = dynamic_cast<const MSVehicle* const>(v);
+        if (veh != 0 && veh->getWeightsStorage().retrieveExistingEffort(e, t, value)) {
+            return value;
+        }
+        if (getInstance()->getWeightsStorage().retrieveExistingEffort(e, t, value)) {
+            return value;
+        }
     }
     return 0;
 }
@@ -148,13 +156,16 @@ MSNet::getEffort(const MSEdge* const e, const SUMOVehicle* const v, double t) {
 
 double
 MSNet::getTravelTime(const MSEdge* const e, const SUMOVehicle* const v, double t) {
-    double value;
-    const MSVehicle* const veh = dynamic_cast<const MSVehicle* const>(v);
-    if (veh != 0 && veh->getWeightsStorage().retrieveExistingTravelTime(e, t, value)) {
-        return value;
-    }
-    if (getInstance()->getWeightsStorage().retrieveExistingTravelTime(e, t, value)) {
-        return value;
+    // the cast and the lookups are worth paying only if custom weights exist
+    if (MSEdgeWeightsStorage::hasWeights()) {
+        double value;
+        const MSVehicle* const veh = dynamic_cast<const MSVehicle* const>(v);
+        if (veh != 0 && veh->getWeightsStorage().retrieveExistingTravelTime(e, t, value)) {
+            return value;
+        }
+        if (getInstance()->getWeightsStorage().retrieveExistingTravelTime(e, t, value)) {
+            return value;
+        }
     }
     return e->getMinimumTravelTime(v);
 }
@@ -191,6 +202,34 @@ MSNet::MSNet(MSVehicleControl* vc, MSEventControl* beginOfTimestepEvents,
     myMaxTeleports = oc.getInt("max-num-teleports");
     myLogExecutionTime = !oc.getBool("no-duration-log");
     myLogStepNumber = !oc.getBool("no-step-log");
+    myLogPhaseTimings = oc.isSet("phase-timing-output");
+    for (int i = 0; i < PHASE_MAX; ++i) {
+        myPhaseDurations[i] = 0;
+    }
+    myStepDeadline = (long)string2time(oc.getString("step-deadline"));
+    myShedOutputs = false;
+    myShedSteps = 0;
+    myGridlockCheckInterval = string2time(oc.getString("gridlock-check"));
+    myGridlockWaitingTime = string2time(oc.getString("gridlock-check.waiting-time"));
+    myGridlockThreshold = oc.getFloat("gridlock-check.threshold");
+    myGridlockAbort = oc.getBool("gridlock-check.abort");
+    myGridlockAlarm = false;
+    mySkipIdleSteps = oc.getBool("skip-idle-steps");
+    if (mySkipIdleSteps) {
+        // outputs which write a row for every step would lose the jumped steps
+        const std::string stepBound[] = {
+            "netstate-dump", "fcd-output", "emission-output", "battery-output",
+            "full-output", "queue-output", "amitran-output", "vtk-output", "heatmap-output",
+            "summary-output", "link-output", "phase-timing-output"
+        };
+        for (int i = 0; i < (int)(sizeof(stepBound) / sizeof(stepBound[0])); ++i) {
+            if (oc.isSet(stepBound[i])) {
+                WRITE_WARNING("Option --skip-idle-steps is ignored because the step-bound output '--" + stepBound[i] + "' is active.");
+                mySkipIdleSteps = false;
+                break;
+            }
+        }
+    }
     myInserter = new MSInsertionControl(*vc, string2time(oc.getString("max-depart-delay")), oc.getBool("eager-insert"), oc.getInt("max-num-vehicles"));
     myVehicleControl = vc;
     myDetectorControl = new MSDetectorControl();
@@ -235,6 +274,7 @@ MSNet::closeBuilding(const OptionsCont& oc, MSEdgeControl* edges, MSJunctionCont
     myStateDumpPeriod = string2time(oc.getString("save-state.period"));
     myStateDumpPrefix = oc.getString("save-state.prefix");
     myStateDumpSuffix = oc.getString("save-state.suffix");
+    myStateDumpKeep = oc.getInt("save-state.period.keep");
 
     // set requests/responses
     myJunctions->postloadInitContainer();
@@ -380,6 +420,12 @@ MSNet::closeSimulation(SUMOTime start) {
     if (OptionsCont::getOptions().isSet("chargingstations-output")) {
         writeChargingStationOutput();
     }
+    if (OptionsCont::getOptions().isSet("heatmap-output")) {
+        MSHeatmapExport::finish(OutputDevice::getDeviceByOption("heatmap-output"), myStep);
+    }
+    if (myShedSteps > 0) {
+        WRITE_WARNING("Skipped the optional outputs in " + toString(myShedSteps) + " steps which exceeded the step deadline.");
+    }
     if (myLogExecutionTime) {
         long duration = SysUtils::getCurrentMillis() - mySimBeginMillis;
         std::ostringstream msg;
@@ -429,6 +475,23 @@ MSNet::closeSimulation(SUMOTime start) {
         }
         if (OptionsCont::getOptions().getBool("duration-log.statistics")) {
             msg << MSDevice_Tripinfo::printStatistics();
+            msg << MSDevice_Routing::printStatistics();
+            // coarse per-owner memory accounting to aid the sizing of large scenarios
+            const std::pair<int, long long> routeMem = MSRoute::dictionaryMemoryUsage();
+            msg << "Memory (estimate):\n"
+                << " Routes: " << routeMem.first << " (" << (routeMem.second / 1024) << " kB)\n"
+                << " Running Vehicles: " << myVehicleControl->getRunningVehicleNo()
+                << " (" << ((long long)myVehicleControl->getRunningVehicleNo() * (long long)sizeof(MSVehicle) / 1024) << " kB base)\n";
+            const int pooledBlocks = MSGlobals::gUseMesoSim
+                                     ? ObjectPool<MEVehicle>::getFreeBlockCount()
+                                     : ObjectPool<MSVehicle>::getFreeBlockCount();
+            if (pooledBlocks > 0) {
+                msg << " Vehicle Pool: " << pooledBlocks << " free blocks\n";
+            }
+            const long peakMem = SysUtils::getPeakMemoryKBytes();
+            if (peakMem >= 0) {
+                msg << " Process Peak RSS: " << peakMem << " kB\n";
+            }
         }
         WRITE_MESSAGE(msg.str());
     }
@@ -442,6 +505,13 @@ MSNet::simulationStep() {
               << ", myStep = " << myStep
               << std::endl;
 #endif
+    long long phaseMark = 0;
+    if (myLogPhaseTimings) {
+        for (int i = 0; i < PHASE_MAX; ++i) {
+            myPhaseDurations[i] = 0;
+        }
+        phaseMark = SysUtils::getCurrentMicros();
+    }
 #ifndef NO_TRACI
     if (myLogExecutionTime) {
         myTraCIStepDuration = SysUtils::getCurrentMillis();
@@ -461,7 +531,9 @@ MSNet::simulationStep() {
 #ifdef DEBUG_SIMSTEP
     std::cout << SIMTIME << ": TraCI target time: " << t->getTargetTime() << std::endl;
 #endif
+    endPhase(PHASE_TRACI, phaseMark);
 #endif
+    const long stepComputeBegin = myStepDeadline > 0 ? SysUtils::getCurrentMillis() : 0;
     // execute beginOfTimestepEvents
     if (myLogExecutionTime) {
         mySimStepDuration = SysUtils::getCurrentMillis();
@@ -473,7 +545,16 @@ MSNet::simulationStep() {
         MSStateHandler::saveState(myStateDumpFiles[dist], myStep);
     }
     if (myStateDumpPeriod > 0 && myStep % myStateDumpPeriod == 0) {
-        MSStateHandler::saveState(myStateDumpPrefix + "_" + time2string(myStep) + myStateDumpSuffix, myStep);
+        const std::string filename = myStateDumpPrefix + "_" + time2string(myStep) + myStateDumpSuffix;
+        MSStateHandler::saveState(filename, myStep);
+        if (myStateDumpKeep > 0) {
+            // rolling checkpoints: drop the oldest snapshots to bound disk usage
+            myPeriodicStateFiles.push_back(filename);
+            while ((int)myPeriodicStateFiles.size() > myStateDumpKeep) {
+                std::remove(myPeriodicStateFiles.front().c_str());
+                myPeriodicStateFiles.erase(myPeriodicStateFiles.begin());
+            }
+        }
     }
     myBeginOfTimestepEvents->execute(myStep);
 #ifdef HAVE_FOX
@@ -482,11 +563,14 @@ MSNet::simulationStep() {
     if (MSGlobals::gCheck4Accidents) {
         myEdges->detectCollisions(myStep, STAGE_EVENTS);
     }
+    endPhase(PHASE_EVENTS, phaseMark);
     // check whether the tls programs need to be switched
     myLogics->check2Switch(myStep);
+    endPhase(PHASE_TLS, phaseMark);
 
     if (MSGlobals::gUseMesoSim) {
         MSGlobals::gMesoNet->simulate(myStep);
+        endPhase(PHASE_EXECUTEMOVEMENTS, phaseMark);
     } else {
         // assure all lanes with vehicles are 'active'
         myEdges->patchActiveLanes();
@@ -494,12 +578,14 @@ MSNet::simulationStep() {
         // compute safe velocities for all vehicles for the next few lanes
         // also register ApproachingVehicleInformation for all links
         myEdges->planMovements(myStep);
+        endPhase(PHASE_PLANMOVEMENTS, phaseMark);
 
         // decide right-of-way and execute movements
         myEdges->executeMovements(myStep);
         if (MSGlobals::gCheck4Accidents) {
             myEdges->detectCollisions(myStep, STAGE_MOVEMENTS);
         }
+        endPhase(PHASE_EXECUTEMOVEMENTS, phaseMark);
 
         // vehicles may change lanes
         myEdges->changeLanes(myStep);
@@ -507,6 +593,7 @@ MSNet::simulationStep() {
         if (MSGlobals::gCheck4Accidents) {
             myEdges->detectCollisions(myStep, STAGE_LANECHANGE);
         }
+        endPhase(PHASE_CHANGELANES, phaseMark);
     }
     loadRoutes();
 
@@ -533,6 +620,7 @@ MSNet::simulationStep() {
 
     // execute endOfTimestepEvents
     myEndOfTimestepEvents->execute(myStep);
+    endPhase(PHASE_INSERTION, phaseMark);
 
 #ifndef NO_TRACI
     if (TraCIServer::getInstance() != 0) {
@@ -544,15 +632,152 @@ MSNet::simulationStep() {
             myTraCIStepDuration += SysUtils::getCurrentMillis();
         }
     }
+    endPhase(PHASE_TRACI, phaseMark);
 #endif
+    if (myGridlockCheckInterval > 0 && myStep % myGridlockCheckInterval == 0) {
+        checkGridlock();
+    }
     // update and write (if needed) detector values
+    if (myStepDeadline > 0) {
+        // over budget: shed the optional per-step outputs to hold the deadline
+        myShedOutputs = SysUtils::getCurrentMillis() - stepComputeBegin >= myStepDeadline;
+        if (myShedOutputs) {
+            myShedSteps++;
+        }
+    }
     writeOutput();
-
+    endPhase(PHASE_OUTPUT, phaseMark);
+
+    if (myLogPhaseTimings) {
+        OutputDevice& od = OutputDevice::getDeviceByOption("phase-timing-output");
+        od.openTag("step").writeAttr(SUMO_ATTR_TIME, time2string(myStep));
+        od.writeAttr("traci", myPhaseDurations[PHASE_TRACI]);
+        od.writeAttr("events", myPhaseDurations[PHASE_EVENTS]);
+        od.writeAttr("tls", myPhaseDurations[PHASE_TLS]);
+        od.writeAttr("planMovements", myPhaseDurations[PHASE_PLANMOVEMENTS]);
+        od.writeAttr("executeMovements", myPhaseDurations[PHASE_EXECUTEMOVEMENTS]);
+        od.writeAttr("changeLanes", myPhaseDurations[PHASE_CHANGELANES]);
+        od.writeAttr("insertion", myPhaseDurations[PHASE_INSERTION]);
+        od.writeAttr("output", myPhaseDurations[PHASE_OUTPUT]);
+        od.closeTag();
+    }
     if (myLogExecutionTime) {
         mySimStepDuration = SysUtils::getCurrentMillis() - mySimStepDuration;
         myVehiclesMoved += myVehicleControl->getRunningVehicleNo();
     }
+    // reclaim all transient allocations of this step
+    myStepArena.reset();
     myStep += DELTA_T;
+    if (mySkipIdleSteps) {
+        skipIdleTime();
+    }
+}
+
+
+void
+MSNet::skipIdleTime() {
+    // only jump when the network is completely at rest
+    if (myVehicleControl->getRunningVehicleNo() > 0
+            || myInserter->getWaitingVehicleNo() > 0
+            || MSVehicleTransfer::getInstance()->hasPending()
+            || myLogics->hasPendingSwitch()
+            || (myPersonControl != 0 && myPersonControl->hasTransportables())
+            || (myContainerControl != 0 && myContainerControl->hasTransportables())
+            || !MSDevice_SSM::getInstances().empty()) {
+        return;
+    }
+#ifndef NO_TRACI
+    if (TraCIServer::getInstance() != 0) {
+        // clients single-step the simulation and may act at any time
+        return;
+    }
+#endif
+    // the earliest time at which anything can happen again
+    SUMOTime next = myInserter->getNextDeparture();
+    if (!myRouteLoaders->haveAllLoaded()) {
+        // departures beyond the loading horizon are not known yet
+        next = MIN2(next, myRouteLoaders->getNextLoadTime());
+    }
+    next = MIN2(next, myBeginOfTimestepEvents->getNextEventTime());
+    next = MIN2(next, myEndOfTimestepEvents->getNextEventTime());
+    next = MIN2(next, myInsertionEvents->getNextEventTime());
+    // interval outputs are written in the step before the interval ends
+    next = MIN2(next, myDetectorControl->getNextIntervalEnd() - DELTA_T);
+    for (std::vector<SUMOTime>::const_iterator i = myStateDumpTimes.begin(); i != myStateDumpTimes.end(); ++i) {
+        if (*i >= myStep) {
+            next = MIN2(next, *i);
+        }
+    }
+    if (myStateDumpPeriod > 0) {
+        const SUMOTime rest = myStep % myStateDumpPeriod;
+        next = MIN2(next, rest == 0 ? myStep : myStep + myStateDumpPeriod - rest);
+    }
+    if (next == SUMOTime_MAX) {
+        // nothing is pending at all; the simulation will end by itself
+        return;
+    }
+    // an action at time t is processed in the step which covers t
+    const SUMOTime target = (next / DELTA_T) * DELTA_T;
+    if (target > myStep) {
+        myStep = target;
+    }
+}
+
+
+void
+MSNet::checkGridlock() {
+    int running = 0;
+    int blocked = 0;
+    std::map<const MSJunction*, int> blockedApproaches;
+    for (MSVehicleControl::constVehIt i = myVehicleControl->loadedVehBegin(); i != myVehicleControl->loadedVehEnd(); ++i) {
+        const MSVehicle* const veh = dynamic_cast<const MSVehicle*>(i->second);
+        if (veh == 0 || !veh->isOnRoad()) {
+            continue;
+        }
+        running++;
+        if (veh->getWaitingTime() >= myGridlockWaitingTime) {
+            blocked++;
+            const MSJunction* const junction = veh->getLane()->getEdge().getToJunction();
+            if (junction != 0) {
+                blockedApproaches[junction]++;
+            }
+        }
+    }
+    const bool alarm = running > 0 && blocked >= myGridlockThreshold * (double)running;
+    if (alarm && !myGridlockAlarm) {
+        // report the junctions with the most blocked approaching vehicles
+        std::vector<std::pair<int, std::string> > worst;
+        for (std::map<const MSJunction*, int>::const_iterator i = blockedApproaches.begin(); i != blockedApproaches.end(); ++i) {
+            worst.push_back(std::make_pair(-i->second, i->first->getID()));
+        }
+        std::sort(worst.begin(), worst.end());
+        std::string junctions;
+        myGridlockedJunctions.clear();
+        for (int j = 0; j < (int)worst.size() && j < 10; ++j) {
+            if (j > 0) {
+                junctions += " ";
+            }
+            junctions += worst[j].second;
+            myGridlockedJunctions.push_back(worst[j].second);
+        }
+        WRITE_WARNING("Gridlock suspected: " + toString(blocked) + " of " + toString(running)
+                      + " vehicles have been waiting for more than " + time2string(myGridlockWaitingTime)
+                      + " at time=" + time2string(myStep) + " (most affected junctions: " + junctions + ").");
+        if (myGridlockAbort) {
+            throw ProcessError("Gridlock detected at time=" + time2string(myStep) + ".");
+        }
+    }
+    myGridlockAlarm = alarm;
+}
+
+
+void
+MSNet::endPhase(TimedPhase phase, long long& mark) {
+    if (myLogPhaseTimings) {
+        const long long now = SysUtils::getCurrentMicros();
+        myPhaseDurations[phase] += now - mark;
+        mark = now;
+    }
 }
 
 
@@ -627,6 +852,7 @@ MSNet::clearAll() {
     MSDevice::cleanupAll();
     MSTrigger::cleanup();
     MSCalibrator::cleanup();
+    MSFCDExport::cleanup();
     MSPModel::cleanup();
     MSCModel_NonInteracting::cleanup();
     MSDevice_BTsender::cleanup();
@@ -648,45 +874,51 @@ MSNet::writeOutput() {
     const OptionsCont& oc = OptionsCont::getOptions();
 
     // check state dumps
-    if (oc.isSet("netstate-dump")) {
+    if (!myShedOutputs && oc.isSet("netstate-dump")) {
         MSXMLRawOut::write(OutputDevice::getDeviceByOption("netstate-dump"), *myEdges, myStep,
-                           oc.getInt("netstate-dump.precision"));
+                           oc.getInt("netstate-dump.precision"), oc.getBool("netstate-dump.delta"),
+                           string2time(oc.getString("netstate-dump.keyframe-period")));
     }
 
     // check fcd dumps
-    if (OptionsCont::getOptions().isSet("fcd-output")) {
+    if (!myShedOutputs && OptionsCont::getOptions().isSet("fcd-output")) {
         MSFCDExport::write(OutputDevice::getDeviceByOption("fcd-output"), myStep, myHasElevation);
     }
 
     // check emission dumps
-    if (OptionsCont::getOptions().isSet("emission-output")) {
+    if (!myShedOutputs && OptionsCont::getOptions().isSet("emission-output")) {
         MSEmissionExport::write(OutputDevice::getDeviceByOption("emission-output"), myStep,
                                 oc.getInt("emission-output.precision"));
     }
 
     // battery dumps
-    if (OptionsCont::getOptions().isSet("battery-output")) {
+    if (!myShedOutputs && OptionsCont::getOptions().isSet("battery-output")) {
         MSBatteryExport::write(OutputDevice::getDeviceByOption("battery-output"), myStep,
                                oc.getInt("battery-output.precision"));
     }
 
     // check full dumps
-    if (OptionsCont::getOptions().isSet("full-output")) {
+    if (!myShedOutputs && OptionsCont::getOptions().isSet("full-output")) {
         MSFullExport::write(OutputDevice::getDeviceByOption("full-output"), myStep);
     }
 
     // check queue dumps
-    if (OptionsCont::getOptions().isSet("queue-output")) {
+    if (!myShedOutputs && OptionsCont::getOptions().isSet("queue-output")) {
         MSQueueExport::write(OutputDevice::getDeviceByOption("queue-output"), myStep);
     }
 
     // check amitran dumps
-    if (OptionsCont::getOptions().isSet("amitran-output")) {
+    if (!myShedOutputs && OptionsCont::getOptions().isSet("amitran-output")) {
         MSAmitranTrajectories::write(OutputDevice::getDeviceByOption("amitran-output"), myStep);
     }
 
+    // check heatmap dumps
+    if (!myShedOutputs && OptionsCont::getOptions().isSet("heatmap-output")) {
+        MSHeatmapExport::write(OutputDevice::getDeviceByOption("heatmap-output"), myStep);
+    }
+
     // check vtk dumps
-    if (OptionsCont::getOptions().isSet("vtk-output")) {
+    if (!myShedOutputs && OptionsCont::getOptions().isSet("vtk-output")) {
 
         if (MSNet::getInstance()->getVehicleControl().getRunningVehicleNo() > 0) {
             std::string timestep = time2string(myStep);
@@ -900,6 +1132,9 @@ MSNet::getRouterTT(const MSEdgeVector& prohibited) const {
         if (routingAlgorithm == "dijkstra") {
             myRouterTT = new DijkstraRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >(
                 MSEdge::getAllEdges(), true, &MSNet::getTravelTime);
+        } else if (routingAlgorithm == "bidijkstra") {
+            myRouterTT = new BidiDijkstraRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >(
+                MSEdge::getAllEdges(), true, &MSNet::getTravelTime);
         } else {
             if (routingAlgorithm != "astar") {
                 WRITE_WARNING("TraCI and Triggers cannot use routing algorithm '" + routingAlgorithm + "'. using 'astar' instead.");
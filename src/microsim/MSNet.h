@@ -43,6 +43,7 @@
 #include <iostream>
 #include <cmath>
 #include <iomanip>
+#include <utils/common/MemoryArena.h>
 #include <utils/common/SUMOTime.h>
 #include <utils/common/UtilExceptions.h>
 #include <utils/common/NamedObjectCont.h>
@@ -247,6 +248,22 @@ public:
     static std::string getStateMessage(SimulationState state);
 
 
+    /** @brief Returns whether the last gridlock check raised the alarm
+     * @return Whether the blocked fraction of the running vehicles reached the threshold
+     */
+    bool getGridlockAlarm() const {
+        return myGridlockAlarm;
+    }
+
+
+    /** @brief Returns the junctions with the most blocked approaching vehicles at the last alarm
+     * @return The ids of the most affected junctions
+     */
+    const std::vector<std::string>& getGridlockedJunctions() const {
+        return myGridlockedJunctions;
+    }
+
+
     /** @brief Returns the current simulation step
      * @return the current simulation step
      */
@@ -361,6 +378,18 @@ public:
     }
 
 
+    /** @brief Returns the arena for allocations living at most one step
+     *
+     * The arena is reset at the end of every simulation step, so memory
+     *  obtained from it must not be kept across steps.
+     *
+     * @return The per-step memory arena
+     */
+    MemoryArena& getStepArena() {
+        return myStepArena;
+    }
+
+
     /** @brief Returns the detector control
      * @return The detector control
      * @see MSDetectorControl
@@ -663,6 +692,8 @@ protected:
     ShapeContainer* myShapeContainer;
     /// @brief The net's knowledge about edge efforts/travel times; @see MSEdgeWeightsStorage
     MSEdgeWeightsStorage* myEdgeWeights;
+    /// @brief Arena for allocations living at most one step; @see MemoryArena
+    MemoryArena myStepArena;
     /// @}
 
 
@@ -684,9 +715,86 @@ protected:
 
     /// @brief The overall number of vehicle movements
     long long int myVehiclesMoved;
+
+    /// @brief The phases of a simulation step which are timed separately
+    enum TimedPhase {
+        PHASE_TRACI,
+        PHASE_EVENTS,
+        PHASE_TLS,
+        PHASE_PLANMOVEMENTS,
+        PHASE_EXECUTEMOVEMENTS,
+        PHASE_CHANGELANES,
+        PHASE_INSERTION,
+        PHASE_OUTPUT,
+        PHASE_MAX
+    };
+
+    /// @brief Whether per-phase step timings shall be collected ("phase-timing-output" is set)
+    bool myLogPhaseTimings;
+
+    /// @brief The durations of the phases of the current step [us]
+    long long myPhaseDurations[PHASE_MAX];
+
+    /** @brief Adds the time passed since the last mark to the given phase
+     *
+     * Does nothing unless phase timings are collected.
+     * @param[in] phase The phase which just ended
+     * @param[in, out] mark The start time of the phase, set to the current time
+     */
+    void endPhase(TimedPhase phase, long long& mark);
     //}
 
 
+    /// @brief The wall-clock budget per step after which optional outputs are shed ("step-deadline") [ms]
+    long myStepDeadline;
+
+    /// @brief Whether the optional per-step outputs are shed in the current step
+    bool myShedOutputs;
+
+    /// @brief The number of steps in which optional outputs were shed
+    int myShedSteps;
+
+    /// @brief The interval between two gridlock checks ("gridlock-check", 0 means disabled)
+    SUMOTime myGridlockCheckInterval;
+
+    /// @brief The waiting time after which a vehicle counts as blocked ("gridlock-check.waiting-time")
+    SUMOTime myGridlockWaitingTime;
+
+    /// @brief The blocked fraction of the running vehicles which raises the alarm ("gridlock-check.threshold")
+    double myGridlockThreshold;
+
+    /// @brief Whether a raised alarm shall abort the simulation ("gridlock-check.abort")
+    bool myGridlockAbort;
+
+    /// @brief Whether the last gridlock check raised the alarm
+    bool myGridlockAlarm;
+
+    /// @brief The junctions with the most blocked approaching vehicles at the last alarm
+    std::vector<std::string> myGridlockedJunctions;
+
+    /** @brief Counts the blocked vehicles and raises the gridlock alarm
+     *
+     * A vehicle counts as blocked when it has been waiting for at least
+     *  myGridlockWaitingTime; the alarm is raised when the blocked fraction
+     *  of the running vehicles reaches myGridlockThreshold. Called every
+     *  myGridlockCheckInterval from simulationStep.
+     */
+    void checkGridlock();
+
+    /// @brief Whether steps in which nothing can happen shall be jumped over ("skip-idle-steps")
+    bool mySkipIdleSteps;
+
+    /** @brief Advances the simulation clock over steps in which nothing can happen
+     *
+     * Called at the end of simulationStep when "skip-idle-steps" is enabled.
+     * When the network is completely at rest, myStep is set to the step of
+     *  the earliest known activity (departure, scheduled event, detector
+     *  interval end or state dump); the steps in between only pay fixed
+     *  per-step costs and are not simulated at all.
+     */
+    void skipIdleTime();
+
+
 
     /// @name State output variables
     /// @{
@@ -700,6 +808,10 @@ protected:
     /// @brief name components for periodic state
     std::string myStateDumpPrefix;
     std::string myStateDumpSuffix;
+    /// @brief The number of periodic state files to keep (0 keeps all)
+    int myStateDumpKeep;
+    /// @brief The periodic state files written so far (only filled when rolling)
+    std::vector<std::string> myPeriodicStateFiles;
     /// @}
 
 
@@ -88,6 +88,7 @@ MSParkingArea::MSParkingArea(const std::string& id,
                 // angled parking
                 mySpaceOccupancies[i].myPosition = (f + s) * 0.5;
             }
+            myFreeLots.insert(i);
 
         }
     }
@@ -103,22 +104,18 @@ MSParkingArea::getLastFreePos(const SUMOVehicle& /* forVehicle */) const {
 
 Position
 MSParkingArea::getVehiclePosition(const SUMOVehicle& forVehicle) {
-    std::map<unsigned int, LotSpaceDefinition >::iterator i;
-    for (i = mySpaceOccupancies.begin(); i != mySpaceOccupancies.end(); i++) {
-        if ((*i).second.vehicle == &forVehicle) {
-            return (*i).second.myPosition;
-        }
+    std::map<const SUMOVehicle*, int>::const_iterator i = myVehicleLots.find(&forVehicle);
+    if (i != myVehicleLots.end()) {
+        return mySpaceOccupancies[(*i).second].myPosition;
     }
     return Position::INVALID;
 }
 
 double
 MSParkingArea::getVehicleAngle(const SUMOVehicle& forVehicle) {
-    std::map<unsigned int, LotSpaceDefinition >::iterator i;
-    for (i = mySpaceOccupancies.begin(); i != mySpaceOccupancies.end(); i++) {
-        if ((*i).second.vehicle == &forVehicle) {
-            return (((*i).second.myRotation - 90.) * (double) M_PI / (double) 180.0);
-        }
+    std::map<const SUMOVehicle*, int>::const_iterator i = myVehicleLots.find(&forVehicle);
+    if (i != myVehicleLots.end()) {
+        return ((mySpaceOccupancies[(*i).second].myRotation - 90.) * (double) M_PI / (double) 180.0);
     }
     return 0.;
 }
@@ -144,6 +141,7 @@ MSParkingArea::addLotEntry(double x, double y, double z,
     mySpaceOccupancies[i].myLength = length;
     mySpaceOccupancies[i].myRotation = angle;
     mySpaceOccupancies[i].myEndPos = myEndPos;
+    myFreeLots.insert(i);
     myCapacity = (int)mySpaceOccupancies.size();
     computeLastFreePos();
 }
@@ -153,6 +151,8 @@ void
 MSParkingArea::enter(SUMOVehicle* what, double beg, double end) {
     if (myLastFreeLot >= 1 && myLastFreeLot <= (int)mySpaceOccupancies.size()) {
         mySpaceOccupancies[myLastFreeLot].vehicle = what;
+        myVehicleLots[what] = myLastFreeLot;
+        myFreeLots.erase(myLastFreeLot);
         myEndPositions[what] = std::pair<double, double>(beg, end);
         computeLastFreePos();
     }
@@ -162,12 +162,11 @@ MSParkingArea::enter(SUMOVehicle* what, double beg, double end) {
 void
 MSParkingArea::leaveFrom(SUMOVehicle* what) {
     assert(myEndPositions.find(what) != myEndPositions.end());
-    std::map<unsigned int, LotSpaceDefinition >::iterator i;
-    for (i = mySpaceOccupancies.begin(); i != mySpaceOccupancies.end(); i++) {
-        if ((*i).second.vehicle == what) {
-            (*i).second.vehicle = 0;
-            break;
-        }
+    std::map<const SUMOVehicle*, int>::iterator i = myVehicleLots.find(what);
+    if (i != myVehicleLots.end()) {
+        mySpaceOccupancies[(*i).second].vehicle = 0;
+        myFreeLots.insert((*i).second);
+        myVehicleLots.erase(i);
     }
     myEndPositions.erase(myEndPositions.find(what));
     computeLastFreePos();
@@ -176,15 +175,13 @@ MSParkingArea::leaveFrom(SUMOVehicle* what) {
 
 void
 MSParkingArea::computeLastFreePos() {
-    myLastFreeLot = 0;
-    myLastFreePos = myBegPos;
-    std::map<unsigned int, LotSpaceDefinition >::iterator i;
-    for (i = mySpaceOccupancies.begin(); i != mySpaceOccupancies.end(); i++) {
-        if ((*i).second.vehicle == 0) {
-            myLastFreeLot = (*i).first;
-            myLastFreePos = (*i).second.myEndPos;
-            break;
-        }
+    if (myFreeLots.empty()) {
+        myLastFreeLot = 0;
+        myLastFreePos = myBegPos;
+    } else {
+        // the lowest free index is assigned next, as with the former linear scan
+        myLastFreeLot = *myFreeLots.begin();
+        myLastFreePos = mySpaceOccupancies[myLastFreeLot].myEndPos;
     }
 }
 
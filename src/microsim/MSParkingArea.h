@@ -32,6 +32,7 @@
 #include <vector>
 #include <algorithm>
 #include <map>
+#include <set>
 #include <string>
 #include <utils/geom/PositionVector.h>
 #include <utils/common/Named.h>
@@ -239,6 +240,12 @@ protected:
     /// @brief A map from objects (vehicles) to the areas they acquire after entering the stop
     std::map<unsigned int, LotSpaceDefinition > mySpaceOccupancies;
 
+    /// @brief The free lot indices; the lowest one is assigned next
+    std::set<int> myFreeLots;
+
+    /// @brief A map from parked vehicles to their lot indices
+    std::map<const SUMOVehicle*, int> myVehicleLots;
+
     /// @brief The roadside shape of this parkingArea
     PositionVector myShape;
 
@@ -33,6 +33,7 @@
 #include <cassert>
 #include <algorithm>
 #include <limits>
+#include <set>
 #include <utils/common/FileHelpers.h>
 #include <utils/common/RGBColor.h>
 #include <utils/iodevices/BinaryInputDevice.h>
@@ -47,6 +48,8 @@
 // ===========================================================================
 MSRoute::RouteDict MSRoute::myDict;
 MSRoute::RouteDistDict MSRoute::myDistDict;
+MSRoute::EdgeVectorPool MSRoute::myEdgeVectorPool;
+long long int MSRoute::myValidationEpoch(0);
 #ifdef HAVE_FOX
 FXMutex MSRoute::myDictMutex(true);
 #endif
@@ -59,9 +62,9 @@ MSRoute::MSRoute(const std::string& id,
                  const ConstMSEdgeVector& edges,
                  const bool isPermanent, const RGBColor* const c,
                  const std::vector<SUMOVehicleParameter::Stop>& stops)
-    : Named(id), myEdges(edges), myAmPermanent(isPermanent),
+    : Named(id), myEdges(getSharedEdges(edges)), myAmPermanent(isPermanent),
       myReferenceCounter(isPermanent ? 1 : 0),
-      myColor(c), myStops(stops) {}
+      myColor(c), myStops(stops), myValidatedClasses(0), myValidatedEpoch(0) {}
 
 
 MSRoute::~MSRoute() {
@@ -69,28 +72,67 @@ MSRoute::~MSRoute() {
 }
 
 
+std::shared_ptr<const ConstMSEdgeVector>
+MSRoute::getSharedEdges(const ConstMSEdgeVector& edges) {
+#ifdef HAVE_FOX
+    FXMutexLock f(myDictMutex);
+#endif
+    EdgeVectorPool::iterator it = myEdgeVectorPool.find(&edges);
+    if (it != myEdgeVectorPool.end()) {
+        std::shared_ptr<const ConstMSEdgeVector> pooled = it->second.lock();
+        if (pooled != 0) {
+            return pooled;
+        }
+        // the reference count hit zero in another thread but the deleter
+        //  still waits for the mutex; drop the stale entry here so the
+        //  deleter (which compares the pointer) leaves the fresh one alone
+        myEdgeVectorPool.erase(it);
+    }
+    std::shared_ptr<const ConstMSEdgeVector> result(new ConstMSEdgeVector(edges), &MSRoute::removePooledEdges);
+    myEdgeVectorPool[result.get()] = result;
+    return result;
+}
+
+
+void
+MSRoute::removePooledEdges(const ConstMSEdgeVector* edges) {
+#ifdef HAVE_FOX
+    FXMutexLock f(myDictMutex); // recursive; may be held by release()
+#endif
+    // called when the last route using the vector is deleted; the content is
+    //  still valid here so the pool lookup works
+    EdgeVectorPool::iterator it = myEdgeVectorPool.find(edges);
+    // compare the pointer: getSharedEdges may have replaced the expired
+    //  entry with a fresh vector of the same content in the meantime
+    if (it != myEdgeVectorPool.end() && it->first == edges) {
+        myEdgeVectorPool.erase(it);
+    }
+    delete edges;
+}
+
+
 MSRouteIterator
 MSRoute::begin() const {
-    return myEdges.begin();
+    return myEdges->begin();
 }
 
 
 MSRouteIterator
 MSRoute::end() const {
-    return myEdges.end();
+    return myEdges->end();
 }
 
 
 int
 MSRoute::size() const {
-    return (int)myEdges.size();
+    return (int)myEdges->size();
 }
 
 
 const MSEdge*
 MSRoute::getLastEdge() const {
-    assert(myEdges.size() > 0);
-    return myEdges[myEdges.size() - 1];
+    assert(myEdges->size() > 0);
+    return (*myEdges)[myEdges->size() - 1];
 }
 
 
@@ -217,20 +259,41 @@ MSRoute::insertIDs(std::vector<std::string>& into) {
 }
 
 
+std::pair<int, long long>
+MSRoute::dictionaryMemoryUsage() {
+#ifdef HAVE_FOX
+    FXMutexLock f(myDictMutex);
+#endif
+    long long bytes = 0;
+    std::set<const ConstMSEdgeVector*> countedEdges;
+    for (RouteDict::const_iterator i = myDict.begin(); i != myDict.end(); ++i) {
+        const MSRoute* const route = (*i).second;
+        bytes += (long long)(sizeof(MSRoute) + route->getID().capacity());
+        const ConstMSEdgeVector* const edges = route->myEdges.get();
+        if (countedEdges.count(edges) == 0) {
+            bytes += (long long)(sizeof(ConstMSEdgeVector) + edges->capacity() * sizeof(const MSEdge*));
+            countedEdges.insert(edges);
+        }
+        bytes += (long long)(route->myStops.size() * sizeof(SUMOVehicleParameter::Stop));
+    }
+    return std::make_pair((int)myDict.size(), bytes);
+}
+
+
 int
 MSRoute::writeEdgeIDs(OutputDevice& os, const MSEdge* const from, const MSEdge* const upTo) const {
     int numWritten = 0;
-    ConstMSEdgeVector::const_iterator i = myEdges.begin();
+    ConstMSEdgeVector::const_iterator i = myEdges->begin();
     if (from != 0) {
-        i = std::find(myEdges.begin(), myEdges.end(), from);
+        i = std::find(myEdges->begin(), myEdges->end(), from);
     }
-    for (; i != myEdges.end(); ++i) {
+    for (; i != myEdges->end(); ++i) {
         if ((*i) == upTo) {
             return numWritten;
         }
         os << (*i)->getID();
         numWritten++;
-        if (upTo || i != myEdges.end() - 1) {
+        if (upTo || i != myEdges->end() - 1) {
             os << ' ';
         }
     }
@@ -252,7 +315,7 @@ MSRoute::containsAnyOf(const MSEdgeVector& edgelist) const {
 
 const MSEdge*
 MSRoute::operator[](int index) const {
-    return myEdges[index];
+    return (*myEdges)[index];
 }
 
 
@@ -264,7 +327,7 @@ MSRoute::dict_saveState(OutputDevice& out) {
     for (RouteDict::iterator it = myDict.begin(); it != myDict.end(); ++it) {
         out.openTag(SUMO_TAG_ROUTE).writeAttr(SUMO_ATTR_ID, (*it).second->getID());
         out.writeAttr(SUMO_ATTR_STATE, (*it).second->myAmPermanent);
-        out.writeAttr(SUMO_ATTR_EDGES, (*it).second->myEdges).closeTag();
+        out.writeAttr(SUMO_ATTR_EDGES, *(*it).second->myEdges).closeTag();
     }
     for (RouteDistDict::iterator it = myDistDict.begin(); it != myDistDict.end(); ++it) {
         out.openTag(SUMO_TAG_ROUTE_DISTRIBUTION).writeAttr(SUMO_ATTR_ID, (*it).first);
@@ -282,7 +345,7 @@ MSRoute::getDistanceBetween(double fromPos, double toPos,
     /// XXX routes that start and end within the same intersection are not supported
     //std::cout << SIMTIME << " getDistanceBetween from=" << fromEdge->getID() << " to=" << toEdge->getID() << " fromPos=" << fromPos << " toPos=" << toPos << " includeInternal=" << includeInternal << "\n";
     if (fromEdge->isInternal()) {
-        if (fromEdge == myEdges.front()) {
+        if (fromEdge == myEdges->front()) {
             const MSEdge* succ = fromEdge->getSuccessors().front();
             assert(succ != 0);
             //std::cout << "  recurse fromSucc=" << succ->getID() << "\n";
@@ -300,17 +363,17 @@ MSRoute::getDistanceBetween(double fromPos, double toPos,
         //std::cout << "  recurse toPred=" << pred->getID() << "\n";
         return toPos + getDistanceBetween(fromPos, pred->getLength(), fromEdge, pred, includeInternal);
     }
-    ConstMSEdgeVector::const_iterator it = std::find(myEdges.begin(), myEdges.end(), fromEdge);
-    if (it == myEdges.end() || std::find(it, myEdges.end(), toEdge) == myEdges.end()) {
+    ConstMSEdgeVector::const_iterator it = std::find(myEdges->begin(), myEdges->end(), fromEdge);
+    if (it == myEdges->end() || std::find(it, myEdges->end(), toEdge) == myEdges->end()) {
         // start or destination not contained in route
         return std::numeric_limits<double>::max();
     }
-    ConstMSEdgeVector::const_iterator it2 = std::find(it + 1, myEdges.end(), toEdge);
+    ConstMSEdgeVector::const_iterator it2 = std::find(it + 1, myEdges->end(), toEdge);
 
     if (fromEdge == toEdge) {
         if (fromPos <= toPos) {
             return toPos - fromPos;
-        } else if (it2 == myEdges.end()) {
+        } else if (it2 == myEdges->end()) {
             // we don't visit the edge again
             return std::numeric_limits<double>::max();
         }
@@ -35,6 +35,7 @@
 
 #include <string>
 #include <map>
+#include <memory>
 #include <vector>
 #include <algorithm>
 #include <utils/common/Named.h>
@@ -107,7 +108,35 @@ public:
     int writeEdgeIDs(OutputDevice& os, const MSEdge* const from, const MSEdge* const upTo = 0) const;
 
     bool contains(const MSEdge* const edge) const {
-        return std::find(myEdges.begin(), myEdges.end(), edge) != myEdges.end();
+        return std::find(myEdges->begin(), myEdges->end(), edge) != myEdges->end();
+    }
+
+    /// @brief Returns whether the route was already validated for the given vehicle class
+    bool isValidated(SUMOVehicleClass svc) const {
+        if (myValidatedEpoch != myValidationEpoch) {
+            // permissions changed since the last validation
+            myValidatedClasses = 0;
+            myValidatedEpoch = myValidationEpoch;
+        }
+        return (myValidatedClasses & svc) == svc;
+    }
+
+    /// @brief Marks the route as validated for the given vehicle class
+    void setValidated(SUMOVehicleClass svc) const {
+        if (myValidatedEpoch != myValidationEpoch) {
+            myValidatedClasses = 0;
+            myValidatedEpoch = myValidationEpoch;
+        }
+        myValidatedClasses |= svc;
+    }
+
+    /** @brief Invalidates the validation caches of all routes
+     *
+     * Must be called whenever edge or lane permissions change during the
+     *  simulation (see MSEdge::rebuildAllowedLanes).
+     */
+    static void invalidateValidatedClasses() {
+        myValidationEpoch++;
     }
 
     bool containsAnyOf(const MSEdgeVector& edgelist) const;
@@ -125,7 +154,7 @@ public:
     /// @}
 
     const ConstMSEdgeVector& getEdges() const {
-        return myEdges;
+        return *myEdges;
     }
 
     /** @brief Compute the distance between 2 given edges on this route, including the length of internal lanes.
@@ -228,9 +257,39 @@ public:
 
     static void insertIDs(std::vector<std::string>& into);
 
+    /** @brief Returns the number of known routes together with an estimate
+     *         of their memory footprint in bytes
+     *
+     * Edge vectors shared between routes are counted only once.
+     * @return The number of routes and the estimated total byte count
+     */
+    static std::pair<int, long long> dictionaryMemoryUsage();
+
 private:
-    /// The list of edges to pass
-    ConstMSEdgeVector myEdges;
+    /** @brief Returns a shared edge vector with the given content
+     *
+     * Routes with identical edge lists (frequent when many vehicles are
+     *  rerouted over the same corridor) share one vector; the last route
+     *  using it removes it from the pool
+     */
+    static std::shared_ptr<const ConstMSEdgeVector> getSharedEdges(const ConstMSEdgeVector& edges);
+
+    /// @brief Removes the given vector from the pool and deletes it
+    static void removePooledEdges(const ConstMSEdgeVector* edges);
+
+    /// @brief Comparator for the edge vector pool (compares the pointed-to sequences)
+    struct EdgeVectorLess {
+        bool operator()(const ConstMSEdgeVector* a, const ConstMSEdgeVector* b) const {
+            return *a < *b;
+        }
+    };
+
+    /// @brief Definition of the pool of edge vectors shared between routes
+    typedef std::map<const ConstMSEdgeVector*, std::weak_ptr<const ConstMSEdgeVector>, EdgeVectorLess> EdgeVectorPool;
+
+private:
+    /// The list of edges to pass (shared between routes with identical edges)
+    std::shared_ptr<const ConstMSEdgeVector> myEdges;
 
     /// whether the route may be deleted after the last vehicle abandoned it
     const bool myAmPermanent;
@@ -247,6 +306,16 @@ private:
     /// @brief List of the stops on the parsed route
     std::vector<SUMOVehicleParameter::Stop> myStops;
 
+    /// @brief Bitmask of vehicle classes for which connectivity was validated
+    /// (routes are shared among many vehicles so the check is done only once)
+    mutable SVCPermissions myValidatedClasses;
+
+    /// @brief The value of myValidationEpoch at which myValidatedClasses was filled
+    mutable long long int myValidatedEpoch;
+
+    /// @brief Counter of network-wide permission changes, bumped to drop stale validations
+    static long long int myValidationEpoch;
+
 private:
     /// Definition of the dictionary container
     typedef std::map<std::string, const MSRoute*> RouteDict;
@@ -260,6 +329,9 @@ private:
     /// The dictionary container
     static RouteDistDict myDistDict;
 
+    /// The pool of edge vectors shared between routes with identical edges
+    static EdgeVectorPool myEdgeVectorPool;
+
 #ifdef HAVE_FOX
     /// @brief the mutex for the route dictionaries
     static FXMutex myDictMutex;
@@ -33,6 +33,11 @@
 #include <version.h>
 #endif
 
+#ifndef WIN32
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
 #include <sstream>
 #include <utils/common/TplConvert.h>
 #include <utils/options/OptionsCont.h>
@@ -76,6 +81,31 @@ MSStateHandler::~MSStateHandler() {
 
 void
 MSStateHandler::saveState(const std::string& file, SUMOTime step) {
+#ifndef WIN32
+    if (OptionsCont::getOptions().getBool("save-state.parallel")) {
+        // reap writers from earlier snapshots so they do not linger as zombies
+        while (waitpid(-1, 0, WNOHANG) > 0) {
+        }
+        const pid_t pid = fork();
+        if (pid > 0) {
+            // parent: continue simulating, the child works on the
+            //  copy-on-write image frozen at this instant
+            return;
+        }
+        if (pid == 0) {
+            writeState(file, step);
+            // exit without flushing the parent's buffered devices
+            _exit(0);
+        }
+        WRITE_WARNING("Could not fork a state writer process, saving state synchronously.");
+    }
+#endif
+    writeState(file, step);
+}
+
+
+void
+MSStateHandler::writeState(const std::string& file, SUMOTime step) {
     OutputDevice& out = OutputDevice::getDevice(file);
     out.writeHeader<MSEdge>(SUMO_TAG_SNAPSHOT);
     out.writeAttr("xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance").writeAttr("xsi:noNamespaceSchemaLocation", "http://sumo.dlr.de/xsd/state_file.xsd");
@@ -57,6 +57,10 @@ public:
     virtual ~MSStateHandler();
 
     /** @brief Saves the current state
+     *
+     * With --save-state.parallel the writing happens in a forked child
+     *  process working on the copy-on-write image of the simulation, so the
+     *  step loop only blocks for the duration of the fork.
      *
      * @param[in] file The file to write the state into
      */
@@ -93,6 +97,13 @@ protected:
     /// Ends the processing of a vehicle
     void closeVehicle();
 
+private:
+    /** @brief Performs the actual state writing
+     *
+     * @param[in] file The file to write the state into
+     */
+    static void writeState(const std::string& file, SUMOTime step);
+
 private:
     const SUMOTime myOffset;
     SUMOTime myTime;
@@ -75,7 +75,9 @@ MSStoppingPlace::getEndLanePosition() const {
 void
 MSStoppingPlace::enter(SUMOVehicle* what, double beg, double end) {
     myEndPositions[what] = std::pair<double, double>(beg, end);
-    computeLastFreePos();
+    // entering can only move the last free position backwards so the
+    //  cached value is updated without scanning all stopped vehicles
+    myLastFreePos = MIN2(myLastFreePos, end);
 }
 
 
@@ -107,7 +107,7 @@ public:
      *
      * Stores the position of the entering vehicle in myEndPositions.
      *
-     * Recomputes the free space using "computeLastFreePos" then.
+     * Updates the cached last free position.
      *
      * @param[in] what The vehicle that enters the bus stop
      * @param[in] beg The begin halting position of the vehicle
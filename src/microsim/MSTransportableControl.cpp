@@ -156,15 +156,31 @@ MSTransportableControl::addWaiting(const MSEdge* const edge, MSTransportable* tr
 }
 
 
+const MSTransportableControl::TransportableVector&
+MSTransportableControl::getWaiting(const MSEdge* edge) const {
+    static const TransportableVector emptyVector;
+    std::map<const MSEdge*, TransportableVector>::const_iterator it = myWaiting4Vehicle.find(edge);
+    if (it == myWaiting4Vehicle.end()) {
+        return emptyVector;
+    }
+    return it->second;
+}
+
+
 bool
 MSTransportableControl::boardAnyWaiting(MSEdge* edge, MSVehicle* vehicle, MSVehicle::Stop* stop) {
     bool ret = false;
-    if (myWaiting4Vehicle.find(edge) != myWaiting4Vehicle.end()) {
-        TransportableVector& wait = myWaiting4Vehicle[edge];
+    std::map<const MSEdge*, TransportableVector>::iterator waiting = myWaiting4Vehicle.find(edge);
+    if (waiting != myWaiting4Vehicle.end()) {
+        TransportableVector& wait = waiting->second;
         const std::string& line = vehicle->getParameter().line == "" ? vehicle->getParameter().id : vehicle->getParameter().line;
-        SUMOTime currentTime =  MSNet::getInstance()->getCurrentTimeStep();
+        const SUMOTime currentTime = MSNet::getInstance()->getCurrentTimeStep();
         for (TransportableVector::iterator i = wait.begin(); i != wait.end();) {
-            if ((*i)->isWaitingFor(line) && vehicle->getVehicleType().getPersonCapacity() > vehicle->getPersonNumber() && stop->timeToBoardNextPerson <= currentTime && stop->pars.startPos <= (*i)->getEdgePos() && (*i)->getEdgePos() <= stop->pars.endPos) {
+            if (vehicle->getVehicleType().getPersonCapacity() <= vehicle->getPersonNumber()) {
+                // no need to check the remaining waiting persons
+                break;
+            }
+            if ((*i)->isWaitingFor(line) && stop->timeToBoardNextPerson <= currentTime && stop->pars.startPos <= (*i)->getEdgePos() && (*i)->getEdgePos() <= stop->pars.endPos) {
                 edge->removePerson(*i);
                 vehicle->addPerson(*i);
                 //if the time a person needs to enter the vehicle extends the duration of the stop of the vehicle extend
@@ -189,7 +205,7 @@ MSTransportableControl::boardAnyWaiting(MSEdge* edge, MSVehicle* vehicle, MSVehi
             }
         }
         if (wait.size() == 0) {
-            myWaiting4Vehicle.erase(myWaiting4Vehicle.find(edge));
+            myWaiting4Vehicle.erase(waiting);
         }
     }
     return ret;
@@ -199,12 +215,17 @@ MSTransportableControl::boardAnyWaiting(MSEdge* edge, MSVehicle* vehicle, MSVehi
 bool
 MSTransportableControl::loadAnyWaiting(MSEdge* edge, MSVehicle* vehicle, MSVehicle::Stop* stop) {
     bool ret = false;
-    if (myWaiting4Vehicle.find(edge) != myWaiting4Vehicle.end()) {
-        TransportableVector& waitContainers = myWaiting4Vehicle[edge];
+    std::map<const MSEdge*, TransportableVector>::iterator waiting = myWaiting4Vehicle.find(edge);
+    if (waiting != myWaiting4Vehicle.end()) {
+        TransportableVector& waitContainers = waiting->second;
+        const std::string& line = vehicle->getParameter().line == "" ? vehicle->getParameter().id : vehicle->getParameter().line;
+        const SUMOTime currentTime = MSNet::getInstance()->getCurrentTimeStep();
         for (TransportableVector::iterator i = waitContainers.begin(); i != waitContainers.end();) {
-            const std::string& line = vehicle->getParameter().line == "" ? vehicle->getParameter().id : vehicle->getParameter().line;
-            SUMOTime currentTime = MSNet::getInstance()->getCurrentTimeStep();
-            if ((*i)->isWaitingFor(line) && vehicle->getVehicleType().getContainerCapacity() > vehicle->getContainerNumber()
+            if (vehicle->getVehicleType().getContainerCapacity() <= vehicle->getContainerNumber()) {
+                // no need to check the remaining waiting containers
+                break;
+            }
+            if ((*i)->isWaitingFor(line)
                     && stop->timeToLoadNextContainer <= currentTime
                     && stop->pars.startPos <= (*i)->getEdgePos() && (*i)->getEdgePos() <= stop->pars.endPos) {
                 edge->removeContainer(*i);
@@ -227,7 +248,7 @@ MSTransportableControl::loadAnyWaiting(MSEdge* edge, MSVehicle* vehicle, MSVehic
             }
         }
         if (waitContainers.size() == 0) {
-            myWaiting4Vehicle.erase(myWaiting4Vehicle.find(edge));
+            myWaiting4Vehicle.erase(waiting);
         }
     }
     return ret;
@@ -99,6 +99,12 @@ public:
     /// adds a transportable to the list of transportables waiting for a vehicle on the specified edge
     void addWaiting(const MSEdge* edge, MSTransportable* person);
 
+    /** @brief Returns the transportables waiting for a vehicle on the given edge
+     * @param[in] edge The edge to check
+     * @return The list of waiting transportables (empty if there are none)
+     */
+    const TransportableVector& getWaiting(const MSEdge* edge) const;
+
     /** @brief board any applicable persons
      * Boards any people who wait on that edge for the given vehicle and removes them from myWaiting
      * @param[in] the edge on which the boarding should take place
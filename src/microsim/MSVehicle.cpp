@@ -2100,10 +2100,13 @@ MSVehicle::adaptToLeaders(const MSLeaderInfo& ahead, double latOffset,
         return;
     }
     */
+    const MSVehicle* predDone = 0;
     for (int sublane = rightmost; sublane <= leftmost; ++sublane) {
         const MSVehicle* pred = ahead[sublane];
-        if (pred != 0) {
-            // @todo avoid multiple adaptations to the same leader
+        if (pred != 0 && pred != predDone) {
+            // a vehicle occupies contiguous sublanes so comparing against the
+            // previous leader avoids multiple adaptations to the same leader
+            predDone = pred;
             const double predBack = pred->getBackPositionOnLane(lane);
             const double gap = (lastLink == 0
                                 ? predBack - myState.myPos - getVehicleType().getMinGap()
@@ -3416,7 +3419,16 @@ MSVehicle::checkRewindLinkLanes(const double lengthsInFront, DriveItemVector& lf
             }
         }
     }
-    for (DriveItemVector::iterator i = lfLinks.begin(); i != lfLinks.end(); ++i) {
+}
+
+
+void
+MSVehicle::setApproachingForAllLinks() {
+    if (!myActionStep) {
+        // no new plan was computed, the previous registrations remain valid
+        return;
+    }
+    for (DriveItemVector::iterator i = myLFLinkLanes.begin(); i != myLFLinkLanes.end(); ++i) {
         if ((*i).myLink != 0) {
             if ((*i).myLink->getState() == LINKSTATE_ALLWAY_STOP) {
                 (*i).myArrivalTime += (SUMOTime)RandHelper::rand((int)2); // tie braker
@@ -3427,7 +3439,7 @@ MSVehicle::checkRewindLinkLanes(const double lengthsInFront, DriveItemVector& lf
     }
     if (getLaneChangeModel().getShadowLane() != 0) {
         // register on all shadow links
-        for (DriveItemVector::iterator i = lfLinks.begin(); i != lfLinks.end(); ++i) {
+        for (DriveItemVector::iterator i = myLFLinkLanes.begin(); i != myLFLinkLanes.end(); ++i) {
             if ((*i).myLink != 0) {
                 MSLink* parallelLink = (*i).myLink->getParallelLink(getLaneChangeModel().getShadowDirection());
                 if (parallelLink != 0) {
@@ -44,6 +44,7 @@
 #include <set>
 #include <string>
 #include <vector>
+#include <utils/common/ObjectPool.h>
 #include "MSGlobals.h"
 #include "MSVehicleType.h"
 #include "MSBaseVehicle.h"
@@ -244,6 +245,23 @@ public:
     virtual ~MSVehicle();
 
 
+    /// @name Pooled allocation
+    ///
+    /// Vehicle objects are allocated from a free list so that scenarios with
+    ///  high vehicle turnover do not churn the heap allocator. Subclasses
+    ///  (i.e. GUIVehicle) have a different size and fall through to the heap.
+    /// @{
+
+    static void* operator new(size_t size) {
+        return ObjectPool<MSVehicle>::allocate(size);
+    }
+
+    static void operator delete(void* ptr, size_t size) {
+        ObjectPool<MSVehicle>::deallocate(ptr, size);
+    }
+    /// @}
+
+
     /// @name insertion/removal
     //@{
 
@@ -360,9 +378,6 @@ public:
      * Afterwards it checks if any DriveProcessItem should be discarded to avoid
      * blocking a junction (checkRewindLinkLanes).
      *
-     * Finally the ApproachingVehicleInformation is registered for all links that
-     * shall be passed
-     *
      * @param[in] t The current timeStep
      * @param[in] ahead The leaders (may be 0)
      * @param[in] lengthsInFront Sum of vehicle lengths in front of the vehicle
@@ -370,6 +385,16 @@ public:
     void planMove(const SUMOTime t, const MSLeaderInfo& ahead, const double lengthsInFront);
 
 
+    /** @brief Register the ApproachingVehicleInformation for all links that shall be passed
+     *
+     * The approaching information of a link is shared between vehicles
+     *  coming from different edges, so this must run serially after the
+     *  (possibly parallel) plan phase. Does nothing for vehicles without an
+     *  action point in the current step; their registrations remain valid.
+     */
+    void setApproachingForAllLinks();
+
+
     /** @brief Executes planned vehicle movements with regards to right-of-way
      *
      * This method goes through all DriveProcessItems in myLFLinkLanes in order
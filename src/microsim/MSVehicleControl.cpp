@@ -31,6 +31,7 @@
 
 #include "MSVehicleControl.h"
 #include "MSVehicle.h"
+#include <mesosim/MEVehicle.h>
 #include "MSLane.h"
 #include "MSEdge.h"
 #include "MSNet.h"
@@ -82,6 +83,7 @@ MSVehicleControl::~MSVehicleControl() {
         delete(*i).second;
     }
     myVehicleDict.clear();
+    myVehicleLookup.clear();
     // delete vehicle type distributions
     for (VTypeDistDictType::iterator i = myVTypeDistDict.begin(); i != myVTypeDistDict.end(); ++i) {
         delete(*i).second;
@@ -92,6 +94,11 @@ MSVehicleControl::~MSVehicleControl() {
         //delete(*i).second;
     }
     myVTypeDict.clear();
+    // all vehicles are gone now, return the pooled allocation blocks
+    // (the meso pool is cleared here as well since the vehicles are only
+    //  deleted by this base class destructor)
+    ObjectPool<MSVehicle>::clear();
+    ObjectPool<MEVehicle>::clear();
 }
 
 SUMOTime
@@ -190,6 +197,7 @@ MSVehicleControl::addVehicle(const std::string& id, SUMOVehicle* v) {
     if (it == myVehicleDict.end()) {
         // id not in myVehicleDict.
         myVehicleDict[id] = v;
+        myVehicleLookup[id] = v;
         const SUMOVehicleParameter& pars = v->getParameter();
         if (pars.departProcedure == DEPART_TRIGGERED || pars.departProcedure == DEPART_CONTAINER_TRIGGERED) {
             const MSEdge* const firstEdge = v->getRoute().getEdges()[0];
@@ -211,8 +219,8 @@ MSVehicleControl::addVehicle(const std::string& id, SUMOVehicle* v) {
 
 SUMOVehicle*
 MSVehicleControl::getVehicle(const std::string& id) const {
-    VehicleDictType::const_iterator it = myVehicleDict.find(id);
-    if (it == myVehicleDict.end()) {
+    std::unordered_map<std::string, SUMOVehicle*>::const_iterator it = myVehicleLookup.find(id);
+    if (it == myVehicleLookup.end()) {
         return 0;
     }
     return it->second;
@@ -227,6 +235,7 @@ MSVehicleControl::deleteVehicle(SUMOVehicle* veh, bool discard) {
     }
     if (veh != 0) {
         myVehicleDict.erase(veh->getID());
+        myVehicleLookup.erase(veh->getID());
     }
     delete veh;
 }
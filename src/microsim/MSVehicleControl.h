@@ -35,6 +35,7 @@
 #include <string>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <utils/distribution/RandomDistributor.h>
 #include <utils/common/SUMOTime.h>
 #include <utils/common/SUMOVehicleClass.h>
@@ -531,6 +532,11 @@ protected:
     typedef std::map< std::string, SUMOVehicle* > VehicleDictType;
     /// @brief Dictionary of vehicles
     VehicleDictType myVehicleDict;
+
+    /// @brief Hashed index into the dictionary for O(1) retrieval by id
+    ///  (the sorted dictionary is kept because state saving and the TraCI
+    ///   id lists rely on iterating vehicles in id order)
+    std::unordered_map<std::string, SUMOVehicle*> myVehicleLookup;
     /// @}
 
 
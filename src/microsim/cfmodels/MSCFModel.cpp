@@ -687,7 +687,9 @@ MSCFModel::maximumSafeStopSpeedEuler(double gap) const {
     // exactly after gap and decelerate with b every simulation step
     // h = 0.5 * n * (n-1) * b * s + n * b * t (solve for n)
     //n = ((1.0/2.0) - ((t + (pow(((s*s) + (4.0*((s*((2.0*h/b) - t)) + (t*t)))), (1.0/2.0))*sign/2.0))/s));
-    const double n = floor(.5 - ((t + (sqrt(((s * s) + (4.0 * ((s * (2.0 * g / b - t)) + (t * t))))) * -0.5)) / s));
+    // the radicand simplifies to (s - 2*t)^2 + 8*s*g/b
+    const double sMinus2t = s - 2. * t;
+    const double n = floor(.5 - ((t - sqrt(sMinus2t * sMinus2t + 8. * s * g / b) * 0.5) / s));
     const double h = 0.5 * n * (n - 1) * b * s + n * b * t;
     assert(h <= g + NUMERICAL_EPS);
     // compute the additional speed that must be used during deceleration to fix
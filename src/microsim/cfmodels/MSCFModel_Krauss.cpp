@@ -108,25 +108,47 @@ MSCFModel_Krauss::stopSpeed(const MSVehicle* const veh, const double speed, doub
     // NOTE: This allows return of smaller values than minNextSpeed().
     // Only relevant for the ballistic update: We give the argument headway=veh->getActionStepLengthSecs(), to assure that
     // the stopping position is approached with a uniform deceleration also for tau!=veh->getActionStepLengthSecs().
-    return MIN2(maximumSafeStopSpeed(gap, speed, false, veh->getActionStepLengthSecs()), maxNextSpeed(speed, veh));
+    const double vmax = maxNextSpeed(speed, veh);
+    if (uncriticalGapEuler(gap, vmax)) {
+        return vmax;
+    }
+    return MIN2(maximumSafeStopSpeed(gap, speed, false, veh->getActionStepLengthSecs()), vmax);
 }
 
 
 double
 MSCFModel_Krauss::followSpeed(const MSVehicle* const veh, double speed, double gap, double predSpeed, double predMaxDecel) const {
-    const double vsafe = maximumSafeFollowSpeed(gap, speed, predSpeed, predMaxDecel);
-    const double vmin = minNextSpeed(speed);
     const double vmax = maxNextSpeed(speed, veh);
     if (MSGlobals::gSemiImplicitEulerUpdate) {
-        return MIN2(vsafe, vmax);
+        // account for the leader's braking distance as in maximumSafeFollowSpeed
+        if (uncriticalGapEuler(gap + brakeGapEuler(predSpeed, MAX2(myDecel, predMaxDecel), 0.), vmax)) {
+            return vmax;
+        }
+        return MIN2(maximumSafeFollowSpeed(gap, speed, predSpeed, predMaxDecel), vmax);
     } else {
         // ballistic
         // XXX: the euler variant can break as strong as it wishes immediately! The ballistic cannot, refs. #2575.
-        return MAX2(MIN2(vsafe, vmax), vmin);
+        const double vsafe = maximumSafeFollowSpeed(gap, speed, predSpeed, predMaxDecel);
+        return MAX2(MIN2(vsafe, vmax), minNextSpeed(speed));
     }
 }
 
 
+bool
+MSCFModel_Krauss::uncriticalGapEuler(double gap, double vmax) const {
+    // maximumSafeStopSpeedEuler inverts the (monotone) braking distance given by
+    // brakeGapEuler. When the gap exceeds the braking distance at the maximum
+    // attainable speed, the safe velocity cannot constrain the result and the
+    // (costly) inversion may be skipped. The extra NUMERICAL_EPS keeps clear of
+    // the small-gap workaround for #2310 and of rounding artifacts near the
+    // decision boundary.
+    gap -= NUMERICAL_EPS; // as in maximumSafeStopSpeedEuler
+    return MSGlobals::gSemiImplicitEulerUpdate
+           && gap > ACCEL2SPEED(myDecel)
+           && gap > brakeGapEuler(vmax, myDecel, myHeadwayTime) + NUMERICAL_EPS;
+}
+
+
 double
 MSCFModel_Krauss::dawdle2(double speed, double sigma) const {
     if (!MSGlobals::gSemiImplicitEulerUpdate) {
@@ -110,6 +110,16 @@ public:
 
 protected:
 
+    /** @brief Whether the safe velocity for the given gap cannot fall below vmax
+     *
+     * When this holds, computing the safe velocity (which inverts the braking
+     *  distance) can be skipped. Only ever true for the semi-implicit Euler update.
+     * @param[in] gap The (netto) distance to the desired stopping point
+     * @param[in] vmax The maximum speed attainable in the next step
+     * @return Whether the safe velocity cannot constrain the next speed
+     */
+    bool uncriticalGapEuler(double gap, double vmax) const;
+
     /** @brief Applies driver imperfection (dawdling / sigma)
      * @param[in] speed The speed with no dawdling
      * @param[in] sigma The sigma value to use
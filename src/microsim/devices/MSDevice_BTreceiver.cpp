@@ -28,8 +28,10 @@
 #include <config.h>
 #endif
 
+#include <algorithm>
 #include <utils/common/MsgHandler.h>
 #include <utils/options/OptionsCont.h>
+#include <foreign/rtree/RTree.h>
 #include <utils/iodevices/OutputDevice.h>
 #include <utils/vehicle/SUMOVehicle.h>
 #include <utils/geom/Position.h>
@@ -44,6 +46,31 @@
 #include "MSDevice_BTsender.h"
 
 
+// ===========================================================================
+// rtree specialisation for storing sender information objects
+// ===========================================================================
+#define BTSENDER_RTREE_QUAL RTree<MSDevice_BTsender::VehicleInformation*, MSDevice_BTsender::VehicleInformation, float, 2, BTsenderStoringVisitor>
+
+template<>
+inline float BTSENDER_RTREE_QUAL::RectSphericalVolume(Rect* a_rect) {
+    ASSERT(a_rect);
+    const float extent0 = a_rect->m_max[0] - a_rect->m_min[0];
+    const float extent1 = a_rect->m_max[1] - a_rect->m_min[1];
+    return .78539816f * (extent0 * extent0 + extent1 * extent1);
+}
+
+template<>
+inline BTSENDER_RTREE_QUAL::Rect BTSENDER_RTREE_QUAL::CombineRect(Rect* a_rectA, Rect* a_rectB) {
+    ASSERT(a_rectA && a_rectB);
+    Rect newRect;
+    newRect.m_min[0] = rtree_min(a_rectA->m_min[0], a_rectB->m_min[0]);
+    newRect.m_max[0] = rtree_max(a_rectA->m_max[0], a_rectB->m_max[0]);
+    newRect.m_min[1] = rtree_min(a_rectA->m_min[1], a_rectB->m_min[1]);
+    newRect.m_max[1] = rtree_max(a_rectA->m_max[1], a_rectB->m_max[1]);
+    return newRect;
+}
+
+
 // ===========================================================================
 // static members
 // ===========================================================================
@@ -118,7 +145,7 @@ MSDevice_BTreceiver::BTreceiverUpdate::~BTreceiverUpdate() {
 SUMOTime
 MSDevice_BTreceiver::BTreceiverUpdate::execute(SUMOTime /*currentTime*/) {
     // build rtree with senders
-    NamedRTree rt;
+    BTSENDER_RTREE_QUAL rt(&MSDevice_BTsender::VehicleInformation::visit);
     for (std::map<std::string, MSDevice_BTsender::VehicleInformation*>::const_iterator i = MSDevice_BTsender::sVehicles.begin(); i != MSDevice_BTsender::sVehicles.end(); ++i) {
         MSDevice_BTsender::VehicleInformation* vi = (*i).second;
         Boundary b = vi->getBoxBoundary();
@@ -132,6 +159,7 @@ MSDevice_BTreceiver::BTreceiverUpdate::execute(SUMOTime /*currentTime*/) {
     OptionsCont& oc = OptionsCont::getOptions();
     bool allRecognitions = oc.getBool("device.btreceiver.all-recognitions");
     bool haveOutput = oc.isSet("bt-output");
+    std::vector<MSDevice_BTsender::VehicleInformation*> surroundingVehicles;
     for (std::map<std::string, MSDevice_BTreceiver::VehicleInformation*>::iterator i = MSDevice_BTreceiver::sVehicles.begin(); i != MSDevice_BTreceiver::sVehicles.end();) {
         // collect surrounding vehicles
         MSDevice_BTreceiver::VehicleInformation* vi = (*i).second;
@@ -139,17 +167,19 @@ MSDevice_BTreceiver::BTreceiverUpdate::execute(SUMOTime /*currentTime*/) {
         b.grow(vi->range);
         const float cmin[2] = {(float) b.xmin(), (float) b.ymin()};
         const float cmax[2] = {(float) b.xmax(), (float) b.ymax()};
-        std::set<std::string> surroundingVehicles;
-        Named::StoringVisitor sv(surroundingVehicles);
+        surroundingVehicles.clear();
+        BTsenderStoringVisitor sv(surroundingVehicles);
         rt.Search(cmin, cmax, sv);
+        // keep the id-based processing order for determinism
+        std::sort(surroundingVehicles.begin(), surroundingVehicles.end(), Named::NamedLikeComparatorIdLess<MSDevice_BTsender::VehicleInformation>());
 
         // loop over surrounding vehicles, check visibility status
-        for (std::set<std::string>::const_iterator j = surroundingVehicles.begin(); j != surroundingVehicles.end(); ++j) {
-            if ((*i).first == *j) {
+        for (std::vector<MSDevice_BTsender::VehicleInformation*>::const_iterator j = surroundingVehicles.begin(); j != surroundingVehicles.end(); ++j) {
+            if ((*i).first == (*j)->getID()) {
                 // seeing oneself? skip
                 continue;
             }
-            updateVisibility(*vi, *MSDevice_BTsender::sVehicles.find(*j)->second);
+            updateVisibility(*vi, **j);
         }
 
         if (vi->haveArrived) {
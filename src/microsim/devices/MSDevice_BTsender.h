@@ -41,6 +41,7 @@
 // class declarations
 // ===========================================================================
 class SUMOVehicle;
+class BTsenderStoringVisitor;
 
 
 // ===========================================================================
@@ -195,6 +196,13 @@ public:
             return ret;
         }
 
+        /** @brief Adds this vehicle information to the given container
+         *
+         * Callback executed by the rtree during a range query
+         * @param[in] cont The storage to add this object to
+         */
+        void visit(const BTsenderStoringVisitor& cont) const;
+
         /// @brief List of position updates during last step
         std::vector<VehicleState> updates;
 
@@ -238,6 +246,43 @@ private:
 };
 
 
+/** @class BTsenderStoringVisitor
+ * @brief Collects sender information objects during an rtree range query
+ *
+ * In contrast to Named::StoringVisitor, the objects themselves are collected
+ *  so that no subsequent id-based lookup is needed
+ */
+class BTsenderStoringVisitor {
+public:
+    /// @brief Constructor
+    BTsenderStoringVisitor(std::vector<MSDevice_BTsender::VehicleInformation*>& objects) : myObjects(objects) {}
+
+    /// @brief Destructor
+    ~BTsenderStoringVisitor() {}
+
+    /// @brief Adds the given object to the container
+    void add(const MSDevice_BTsender::VehicleInformation* const vi) const {
+        myObjects.push_back(const_cast<MSDevice_BTsender::VehicleInformation*>(vi));
+    }
+
+    /// @brief The container
+    std::vector<MSDevice_BTsender::VehicleInformation*>& myObjects;
+
+private:
+    /// @brief invalidated copy constructor
+    BTsenderStoringVisitor(const BTsenderStoringVisitor& src);
+
+    /// @brief invalidated assignment operator
+    BTsenderStoringVisitor& operator=(const BTsenderStoringVisitor& src);
+};
+
+
+inline void
+MSDevice_BTsender::VehicleInformation::visit(const BTsenderStoringVisitor& cont) const {
+    cont.add(this);
+}
+
+
 #endif
 
 /****************************************************************************/
@@ -31,6 +31,7 @@
 #endif
 
 #include "MSDevice_Routing.h"
+#include <sstream>
 #include <microsim/MSNet.h>
 #include <microsim/MSLane.h>
 #include <microsim/MSEdge.h>
@@ -43,6 +44,7 @@
 #include <utils/common/StaticCommand.h>
 #include <utils/common/StringUtils.h>
 #include <utils/vehicle/DijkstraRouter.h>
+#include <utils/vehicle/BidiDijkstraRouter.h>
 #include <utils/vehicle/AStarRouter.h>
 #include <utils/vehicle/CHRouter.h>
 #include <utils/vehicle/CHRouterWrapper.h>
@@ -52,16 +54,22 @@
 // static member variables
 // ===========================================================================
 std::vector<double> MSDevice_Routing::myEdgeSpeeds;
+std::vector<double> MSDevice_Routing::myEdgeSpeedTrends;
+SUMOTime MSDevice_Routing::myForecastHorizon = 0;
 std::vector<std::vector<double> > MSDevice_Routing::myPastEdgeSpeeds;
 Command* MSDevice_Routing::myEdgeWeightSettingCommand = 0;
 double MSDevice_Routing::myAdaptationWeight;
 int MSDevice_Routing::myAdaptationSteps;
 int MSDevice_Routing::myAdaptationStepsIndex = 0;
+int MSDevice_Routing::myAdaptationRuns = 0;
+long long int MSDevice_Routing::myTotalAdaptedEdges = 0;
 SUMOTime MSDevice_Routing::myAdaptationInterval = -1;
 SUMOTime MSDevice_Routing::myLastAdaptation = -1;
 bool MSDevice_Routing::myWithTaz;
 std::map<std::pair<const MSEdge*, const MSEdge*>, const MSRoute*> MSDevice_Routing::myCachedRoutes;
 SUMOAbstractRouter<MSEdge, SUMOVehicle>* MSDevice_Routing::myRouter = 0;
+std::vector<SUMOAbstractRouter<MSEdge, SUMOVehicle>*> MSDevice_Routing::myCandidateRouters;
+const long long int MSDevice_Routing::AUTO_SAMPLE_QUERIES;
 AStarRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >* MSDevice_Routing::myRouterWithProhibited = 0;
 double MSDevice_Routing::myRandomizeWeightsFactor = 0;
 #ifdef HAVE_FOX
@@ -99,6 +107,10 @@ MSDevice_Routing::insertOptions(OptionsCont& oc) {
     oc.addSynonyme("device.rerouting.adaptation-interval", "device.routing.adaptation-interval", true);
     oc.addDescription("device.rerouting.adaptation-interval", "Routing", "The interval for updating the edge weights");
 
+    oc.doRegister("device.rerouting.forecast-horizon", new Option_String("0", "TIME"));
+    oc.addSynonyme("device.rerouting.forecast-horizon", "device.routing.forecast-horizon", true);
+    oc.addDescription("device.rerouting.forecast-horizon", "Routing", "Extrapolate edge speeds along their current trend up to the given time horizon when routing (0 disables the forecast)");
+
     oc.doRegister("device.rerouting.with-taz", new Option_Bool(false));
     oc.addSynonyme("device.rerouting.with-taz", "device.routing.with-taz", true);
     oc.addSynonyme("device.rerouting.with-taz", "with-taz");
@@ -115,6 +127,7 @@ MSDevice_Routing::insertOptions(OptionsCont& oc) {
 
     myEdgeWeightSettingCommand = 0;
     myEdgeSpeeds.clear();
+    myEdgeSpeedTrends.clear();
     myAdaptationInterval = -1;
     myAdaptationSteps = -1;
     myLastAdaptation = -1;
@@ -163,6 +176,7 @@ MSDevice_Routing::buildVehicleDevices(SUMOVehicle& v, std::vector<MSDevice*>& in
         if (myAdaptationInterval == -1) {
             myAdaptationInterval = string2time(oc.getString("device.rerouting.adaptation-interval"));
             myAdaptationWeight = oc.getFloat("device.rerouting.adaptation-weight");
+            myForecastHorizon = string2time(oc.getString("device.rerouting.forecast-horizon"));
             if (myAdaptationWeight < 1. && myAdaptationInterval > 0) {
                 myEdgeWeightSettingCommand = new StaticCommand<MSDevice_Routing>(&MSDevice_Routing::adaptEdgeEfforts);
                 MSNet::getInstance()->getEndOfTimestepEvents()->addEvent(myEdgeWeightSettingCommand);
@@ -243,6 +257,9 @@ MSDevice_Routing::initEdgeWeights() {
                 myPastEdgeSpeeds[edge->getNumericalID()] = std::vector<double>(myAdaptationSteps, myEdgeSpeeds[edge->getNumericalID()]);
             }
         }
+        if (myForecastHorizon > 0) {
+            myEdgeSpeedTrends.resize(myEdgeSpeeds.size(), 0.);
+        }
         myLastAdaptation = MSNet::getInstance()->getCurrentTimeStep();
         myRandomizeWeightsFactor = oc.getFloat("weights.random-factor");
     }
@@ -278,10 +295,19 @@ MSDevice_Routing::wrappedRerouteCommandExecute(SUMOTime currentTime) {
 
 
 double
-MSDevice_Routing::getEffort(const MSEdge* const e, const SUMOVehicle* const v, double) {
+MSDevice_Routing::getEffort(const MSEdge* const e, const SUMOVehicle* const v, double t) {
     const int id = e->getNumericalID();
     if (id < (int)myEdgeSpeeds.size()) {
-        double effort = MAX2(e->getLength() / MAX2(myEdgeSpeeds[id], NUMERICAL_EPS), e->getMinimumTravelTime(v));
+        double speed = myEdgeSpeeds[id];
+        if (myForecastHorizon > 0 && myAdaptationInterval > 0) {
+            // edges further along the route are reached later; extrapolate
+            //  their smoothed speed along the current trend so the efforts do
+            //  not reflect conditions which will have changed by then
+            const double lookahead = MIN2(STEPS2TIME(myForecastHorizon), MAX2(0., t - SIMTIME));
+            speed += myEdgeSpeedTrends[id] * lookahead / STEPS2TIME(myAdaptationInterval);
+            speed = MIN2(speed, MAX2(myEdgeSpeeds[id], e->getSpeedLimit()));
+        }
+        double effort = MAX2(e->getLength() / MAX2(speed, NUMERICAL_EPS), e->getMinimumTravelTime(v));
         if (myRandomizeWeightsFactor != 1) {
             effort *= RandHelper::rand((double)1, myRandomizeWeightsFactor);
         }
@@ -309,13 +335,32 @@ MSDevice_Routing::adaptEdgeEfforts(SUMOTime currentTime) {
     }
     myCachedRoutes.clear();
     const MSEdgeVector& edges = MSNet::getInstance()->getEdgeControl().getEdges();
+    // edges which saw no vehicle since the last interval and whose smoothed
+    //  speed has converged back to the free-flow speed cannot change and may
+    //  be skipped (only known for the microsimulation)
+    const bool maySkipClean = !MSGlobals::gUseMesoSim;
+    long long int numAdapted = 0;
     if (myAdaptationSteps > 0) {
-        // moving average
+        // moving average; an edge may only be skipped when no vehicle entered
+        //  it within the whole averaging window so all window samples equal
+        //  the free-flow speed
+        const SUMOTime windowBegin = currentTime - myAdaptationSteps * myAdaptationInterval;
         for (MSEdgeVector::const_iterator i = edges.begin(); i != edges.end(); ++i) {
             const int id = (*i)->getNumericalID();
+            if (maySkipClean && (*i)->getLastEntryTime() < windowBegin && myEdgeSpeeds[id] == (*i)->getSpeedLimit()) {
+                if (myForecastHorizon > 0) {
+                    myEdgeSpeedTrends[id] = 0.;
+                }
+                continue;
+            }
             const double currSpeed = (*i)->getMeanSpeed();
+            const double oldSpeed = myEdgeSpeeds[id];
             myEdgeSpeeds[id] += (currSpeed - myPastEdgeSpeeds[id][myAdaptationStepsIndex]) / myAdaptationSteps;
             myPastEdgeSpeeds[id][myAdaptationStepsIndex] = currSpeed;
+            if (myForecastHorizon > 0) {
+                myEdgeSpeedTrends[id] = myEdgeSpeeds[id] - oldSpeed;
+            }
+            numAdapted++;
         }
         myAdaptationStepsIndex = (myAdaptationStepsIndex + 1) % myAdaptationSteps;
     } else {
@@ -323,12 +368,25 @@ MSDevice_Routing::adaptEdgeEfforts(SUMOTime currentTime) {
         const double newWeightFactor = (double)(1. - myAdaptationWeight);
         for (MSEdgeVector::const_iterator i = edges.begin(); i != edges.end(); ++i) {
             const int id = (*i)->getNumericalID();
+            if (maySkipClean && (*i)->getLastEntryTime() < myLastAdaptation && myEdgeSpeeds[id] == (*i)->getSpeedLimit()) {
+                if (myForecastHorizon > 0) {
+                    myEdgeSpeedTrends[id] = 0.;
+                }
+                continue;
+            }
             const double currSpeed = (*i)->getMeanSpeed();
             if (currSpeed != myEdgeSpeeds[id]) {
-                myEdgeSpeeds[id] = myEdgeSpeeds[id] * myAdaptationWeight + currSpeed * newWeightFactor;
+                const double newSpeed = myEdgeSpeeds[id] * myAdaptationWeight + currSpeed * newWeightFactor;
+                if (myForecastHorizon > 0) {
+                    myEdgeSpeedTrends[id] = newSpeed - myEdgeSpeeds[id];
+                }
+                myEdgeSpeeds[id] = newSpeed;
             }
+            numAdapted++;
         }
     }
+    myAdaptationRuns++;
+    myTotalAdaptedEdges += numAdapted;
     myLastAdaptation = currentTime + DELTA_T; // because we run at the end of the time step
     if (OptionsCont::getOptions().isSet("device.rerouting.output")) {
         OutputDevice& dev = OutputDevice::getDeviceByOption("device.rerouting.output");
@@ -364,9 +422,33 @@ MSDevice_Routing::reroute(const SUMOTime currentTime, const bool onInit) {
 #endif
     if (needThread && myRouter == 0) {
         OptionsCont& oc = OptionsCont::getOptions();
-        const std::string routingAlgorithm = oc.getString("routing-algorithm");
+        std::string routingAlgorithm = oc.getString("routing-algorithm");
         const bool mayHaveRestrictions = MSNet::getInstance()->hasPermissions() || oc.getInt("remote-port") != 0;
-        if (routingAlgorithm == "dijkstra") {
+        if (routingAlgorithm == "auto" && oc.getInt("device.rerouting.threads") > 0) {
+            WRITE_WARNING("Routing algorithm 'auto' does not support parallel routing. Using 'dijkstra' instead.");
+            routingAlgorithm = "dijkstra";
+        }
+        if (routingAlgorithm == "auto") {
+            // sample the first queries with each candidate and keep the fastest
+            //  (the CH routers are left out because their preprocessing would
+            //   dominate such a short sample)
+            if (mayHaveRestrictions) {
+                myCandidateRouters.push_back(new DijkstraRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >(
+                                                 MSEdge::getAllEdges(), true, &MSDevice_Routing::getEffort));
+                myCandidateRouters.push_back(new BidiDijkstraRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >(
+                                                 MSEdge::getAllEdges(), true, &MSDevice_Routing::getEffort));
+                myCandidateRouters.push_back(new AStarRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >(
+                                                 MSEdge::getAllEdges(), true, &MSDevice_Routing::getEffort));
+            } else {
+                myCandidateRouters.push_back(new DijkstraRouter<MSEdge, SUMOVehicle, noProhibitions<MSEdge, SUMOVehicle> >(
+                                                 MSEdge::getAllEdges(), true, &MSDevice_Routing::getEffort));
+                myCandidateRouters.push_back(new BidiDijkstraRouter<MSEdge, SUMOVehicle, noProhibitions<MSEdge, SUMOVehicle> >(
+                                                 MSEdge::getAllEdges(), true, &MSDevice_Routing::getEffort));
+                myCandidateRouters.push_back(new AStarRouter<MSEdge, SUMOVehicle, noProhibitions<MSEdge, SUMOVehicle> >(
+                                                 MSEdge::getAllEdges(), true, &MSDevice_Routing::getEffort));
+            }
+            myRouter = myCandidateRouters.front();
+        } else if (routingAlgorithm == "dijkstra") {
             if (mayHaveRestrictions) {
                 myRouter = new DijkstraRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >(
                     MSEdge::getAllEdges(), true, &MSDevice_Routing::getEffort);
@@ -374,6 +456,14 @@ MSDevice_Routing::reroute(const SUMOTime currentTime, const bool onInit) {
                 myRouter = new DijkstraRouter<MSEdge, SUMOVehicle, noProhibitions<MSEdge, SUMOVehicle> >(
                     MSEdge::getAllEdges(), true, &MSDevice_Routing::getEffort);
             }
+        } else if (routingAlgorithm == "bidijkstra") {
+            if (mayHaveRestrictions) {
+                myRouter = new BidiDijkstraRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >(
+                    MSEdge::getAllEdges(), true, &MSDevice_Routing::getEffort);
+            } else {
+                myRouter = new BidiDijkstraRouter<MSEdge, SUMOVehicle, noProhibitions<MSEdge, SUMOVehicle> >(
+                    MSEdge::getAllEdges(), true, &MSDevice_Routing::getEffort);
+            }
         } else if (routingAlgorithm == "astar") {
             if (mayHaveRestrictions) {
                 typedef AStarRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> > AStar;
@@ -419,9 +509,15 @@ MSDevice_Routing::reroute(const SUMOTime currentTime, const bool onInit) {
             }
         } else if (routingAlgorithm == "CHWrapper") {
             const SUMOTime weightPeriod = myAdaptationInterval > 0 ? myAdaptationInterval : std::numeric_limits<int>::max();
-            myRouter = new CHRouterWrapper<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >(
-                MSEdge::getAllEdges(), true, &MSDevice_Routing::getEffort,
-                string2time(oc.getString("begin")), string2time(oc.getString("end")), weightPeriod, oc.getInt("device.rerouting.threads"));
+            if (mayHaveRestrictions) {
+                myRouter = new CHRouterWrapper<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >(
+                    MSEdge::getAllEdges(), true, &MSDevice_Routing::getEffort,
+                    string2time(oc.getString("begin")), string2time(oc.getString("end")), weightPeriod, oc.getInt("device.rerouting.threads"));
+            } else {
+                myRouter = new CHRouterWrapper<MSEdge, SUMOVehicle, noProhibitions<MSEdge, SUMOVehicle> >(
+                    MSEdge::getAllEdges(), true, &MSDevice_Routing::getEffort,
+                    string2time(oc.getString("begin")), string2time(oc.getString("end")), weightPeriod, oc.getInt("device.rerouting.threads"));
+            }
         } else {
             throw ProcessError("Unknown routing algorithm '" + routingAlgorithm + "'!");
         }
@@ -441,6 +537,34 @@ MSDevice_Routing::reroute(const SUMOTime currentTime, const bool onInit) {
         return;
     }
 #endif
+    if (!myCandidateRouters.empty()) {
+        // in auto mode every candidate answers the same number of sample
+        //  queries; afterwards only the fastest one is kept
+        myRouter = myCandidateRouters.front();
+        for (SUMOAbstractRouter<MSEdge, SUMOVehicle>* const candidate : myCandidateRouters) {
+            if (candidate->getNumQueries() < myRouter->getNumQueries()) {
+                myRouter = candidate;
+            }
+        }
+        if (myRouter->getNumQueries() >= AUTO_SAMPLE_QUERIES) {
+            for (SUMOAbstractRouter<MSEdge, SUMOVehicle>* const candidate : myCandidateRouters) {
+                if (candidate->getQueryTimeSum() < myRouter->getQueryTimeSum()
+                        || (candidate->getQueryTimeSum() == myRouter->getQueryTimeSum()
+                            && candidate->getQueryVisits() < myRouter->getQueryVisits())) {
+                    myRouter = candidate;
+                }
+            }
+            WRITE_MESSAGE("Rerouting device keeps " + myRouter->getType() + " after sampling "
+                          + toString(AUTO_SAMPLE_QUERIES) + " queries with each candidate.");
+            // deleting the losers reports their query statistics
+            for (SUMOAbstractRouter<MSEdge, SUMOVehicle>* const candidate : myCandidateRouters) {
+                if (candidate != myRouter) {
+                    delete candidate;
+                }
+            }
+            myCandidateRouters.clear();
+        }
+    }
     myHolder.reroute(currentTime, *myRouter, onInit, myWithTaz);
 }
 
@@ -503,10 +627,40 @@ MSDevice_Routing::setParameter(const std::string& key, const std::string& value)
 
 
 
+std::string
+MSDevice_Routing::printStatistics() {
+    std::ostringstream msg;
+    if (myAdaptationRuns > 0) {
+        msg << "Routing weight adaptation:\n"
+            << " Intervals: " << myAdaptationRuns << "\n"
+            << " Avg edges updated: " << (double)myTotalAdaptedEdges / myAdaptationRuns
+            << " of " << MSEdge::dictSize() << "\n";
+    }
+    if (myRouter != 0 && myRouter->getNumQueries() > 0) {
+        msg << "Routing queries (" << myRouter->getType() << "):\n"
+            << " Queries: " << myRouter->getNumQueries() << "\n"
+            << " Avg edges settled: " << (double)myRouter->getQueryVisits() / myRouter->getNumQueries() << "\n"
+            << " Avg query time: " << (double)myRouter->getQueryTimeSum() / myRouter->getNumQueries() << "ms\n";
+    }
+    return msg.str();
+}
+
+
 void
 MSDevice_Routing::cleanup() {
+    // reset the statistics for subsequent runs
+    myAdaptationRuns = 0;
+    myTotalAdaptedEdges = 0;
     delete myRouterWithProhibited;
     myRouterWithProhibited = 0;
+    // in auto mode the sampling phase may still be running; myRouter is
+    //  one of the candidates and is deleted below
+    for (SUMOAbstractRouter<MSEdge, SUMOVehicle>* const candidate : myCandidateRouters) {
+        if (candidate != myRouter) {
+            delete candidate;
+        }
+    }
+    myCandidateRouters.clear();
 #ifdef HAVE_FOX
     if (myThreadPool.size() > 0) {
         // we cannot wait for the static destructor to do the cleanup
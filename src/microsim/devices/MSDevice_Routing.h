@@ -113,6 +113,9 @@ public:
         return !myWithTaz && myAdaptationInterval >= 0;
     }
 
+    /// @brief returns a summary of the weight adaptation effort for the statistics output
+    static std::string printStatistics();
+
     /// @brief return the router instance
     static SUMOAbstractRouter<MSEdge, SUMOVehicle>& getRouterTT(
         const MSEdgeVector& prohibited = MSEdgeVector());
@@ -335,6 +338,12 @@ private:
     /// @brief The container of edge speeds
     static std::vector<double> myEdgeSpeeds;
 
+    /// @brief The container of edge speed changes per adaptation interval (only filled when forecasting)
+    static std::vector<double> myEdgeSpeedTrends;
+
+    /// @brief How far ahead edge speeds get extrapolated along their trend when routing (0 disables the forecast)
+    static SUMOTime myForecastHorizon;
+
     /// @brief Information which weight prior edge efforts have
     static double myAdaptationWeight;
 
@@ -350,6 +359,12 @@ private:
     /// @brief The current index in the pastEdgeSpeed ring-buffer
     static int myAdaptationStepsIndex;
 
+    /// @brief The number of weight adaptation intervals which were run (for statistics)
+    static int myAdaptationRuns;
+
+    /// @brief The accumulated number of edges touched by the smoothing passes (for statistics)
+    static long long int myTotalAdaptedEdges;
+
     /// @brief The container of edge speeds
     static std::vector<std::vector<double> > myPastEdgeSpeeds;
 
@@ -362,6 +377,12 @@ private:
     /// @brief The router to use
     static SUMOAbstractRouter<MSEdge, SUMOVehicle>* myRouter;
 
+    /// @brief The routers still being sampled when using routing-algorithm 'auto' (empty otherwise)
+    static std::vector<SUMOAbstractRouter<MSEdge, SUMOVehicle>*> myCandidateRouters;
+
+    /// @brief The number of queries each candidate router answers before the fastest one is chosen
+    static const long long int AUTO_SAMPLE_QUERIES = 20;
+
     /// @brief The router to use by rerouter elements
     static AStarRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >* myRouterWithProhibited;
 
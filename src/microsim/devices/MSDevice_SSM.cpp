@@ -246,7 +246,7 @@ MSDevice_SSM::buildVehicleDevices(SUMOVehicle& v, std::vector<MSDevice*>& into)
 }
 
 
-MSDevice_SSM::Encounter::Encounter(const MSVehicle* _ego, const MSVehicle* const _foe, double _begin, double extraTime) :
+MSDevice_SSM::Encounter::Encounter(const MSVehicle* _ego, const MSVehicle* const _foe, double _begin, double extraTime, bool _saveTrajectories) :
     ego(_ego),
     foe(_foe),
     egoID(_ego->getID()),
@@ -255,6 +255,7 @@ MSDevice_SSM::Encounter::Encounter(const MSVehicle* _ego, const MSVehicle* const
     end(-INVALID),
     currentType(ENCOUNTER_TYPE_NOCONFLICT_AHEAD),
     remainingExtraTime(extraTime),
+    saveTrajectories(_saveTrajectories),
     egoConflictEntryTime(INVALID),
     egoConflictExitTime(INVALID),
     foeConflictEntryTime(INVALID),
@@ -291,17 +292,34 @@ MSDevice_SSM::Encounter::add(double time, const EncounterType type, Position ego
 #endif
     currentType = type;
 
-    timeSpan.push_back(time);
-    typeSpan.push_back(type);
-    egoTrajectory.x.push_back(egoX);
-    egoTrajectory.v.push_back(egoV);
-    foeTrajectory.x.push_back(foeX);
-    foeTrajectory.v.push_back(foeV);
-    conflictPointSpan.push_back(conflictPoint);
-    egoDistsToConflict.push_back(egoDistToConflict);
-    foeDistsToConflict.push_back(foeDistToConflict);
-
-    TTCspan.push_back(ttc);
+    if (saveTrajectories || timeSpan.empty()) {
+        timeSpan.push_back(time);
+        typeSpan.push_back(type);
+        egoTrajectory.x.push_back(egoX);
+        egoTrajectory.v.push_back(egoV);
+        foeTrajectory.x.push_back(foeX);
+        foeTrajectory.v.push_back(foeV);
+        conflictPointSpan.push_back(conflictPoint);
+        egoDistsToConflict.push_back(egoDistToConflict);
+        foeDistsToConflict.push_back(foeDistToConflict);
+        TTCspan.push_back(ttc);
+        DRACspan.push_back(drac);
+    } else {
+        // if no trajectories are to be written out, only the most recent data
+        // point is ever inspected, so the series are kept at length one
+        timeSpan.back() = time;
+        typeSpan.back() = type;
+        egoTrajectory.x.back() = egoX;
+        egoTrajectory.v.back() = egoV;
+        foeTrajectory.x.back() = foeX;
+        foeTrajectory.v.back() = foeV;
+        conflictPointSpan.back() = conflictPoint;
+        egoDistsToConflict.back() = egoDistToConflict;
+        foeDistsToConflict.back() = foeDistToConflict;
+        TTCspan.back() = ttc;
+        DRACspan.back() = drac;
+    }
+
     if (ttc != INVALID && (ttc < minTTC.value || minTTC.value == INVALID)) {
         minTTC.value = ttc;
         minTTC.time = time;
@@ -309,7 +327,6 @@ MSDevice_SSM::Encounter::add(double time, const EncounterType type, Position ego
         minTTC.type = type;
     }
 
-    DRACspan.push_back(drac);
     if (drac != INVALID && (drac > maxDRAC.value || maxDRAC.value == INVALID)) {
         maxDRAC.value = drac;
         maxDRAC.time = time;
@@ -425,7 +442,7 @@ MSDevice_SSM::createEncounters(FoeInfoMap& foes) {
 
     for (FoeInfoMap::const_iterator foe = foes.begin(); foe != foes.end(); ++foe) {
         std::pair<MSLane*, MSLane*> conflictLanes;
-        Encounter* e = new Encounter(myHolderMS, foe->first, SIMTIME, myExtraTime);
+        Encounter* e = new Encounter(myHolderMS, foe->first, SIMTIME, myExtraTime, mySaveTrajectories);
         updateEncounter(e, foe->second); // deletes foe->second
         if (myOldestActiveEncounterBegin == INVALID) {
             assert(myActiveEncounters.empty());
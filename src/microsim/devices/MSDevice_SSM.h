@@ -154,7 +154,7 @@ private:
 
     public:
         /// @brief Constructor
-        Encounter(const MSVehicle* _ego, const MSVehicle* const _foe, double _begin, double extraTime);
+        Encounter(const MSVehicle* _ego, const MSVehicle* const _foe, double _begin, double extraTime, bool _saveTrajectories);
         /// @brief Destructor
         ~Encounter();
 
@@ -195,6 +195,10 @@ private:
         /// @brief Remaining extra time (decreases after an encounter ended)
         double remainingExtraTime;
 
+        /// @brief Whether the complete data series shall be kept (only the most
+        ///        recent data point is stored otherwise, @see add())
+        const bool saveTrajectories;
+
         /// @brief Times when the ego vehicle entered/left the conflict area. Currently only applies for crossing situations. Used for PET calculation. (May be defined for merge conflicts in the future)
         double egoConflictEntryTime, egoConflictExitTime;
         /// @brief Times when the foe vehicle entered/left the conflict area. Currently only applies for crossing situations. Used for PET calculation. (May be defined for merge conflicts in the future)
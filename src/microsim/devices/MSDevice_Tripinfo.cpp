@@ -276,15 +276,18 @@ MSDevice_Tripinfo::generateOutput() const {
 
 void
 MSDevice_Tripinfo::generateOutputForUnfinished() {
+    const bool writeOutput = OptionsCont::getOptions().isSet("tripinfo-output");
     while (myPendingOutput.size() > 0) {
         const MSDevice_Tripinfo* d = *myPendingOutput.begin();
         if (d->myHolder.hasDeparted()) {
             d->generateOutput();
-            if (!OptionsCont::getOptions().isSet("tripinfo-output")) {
-                return;
+            if (writeOutput) {
+                // @todo also generate emission output if holder has a device
+                OutputDevice::getDeviceByOption("tripinfo-output").closeTag();
+            } else {
+                // only the aggregate statistics were updated
+                myPendingOutput.erase(d);
             }
-            // @todo also generate emission output if holder has a device
-            OutputDevice::getDeviceByOption("tripinfo-output").closeTag();
         } else {
             myPendingOutput.erase(d);
         }
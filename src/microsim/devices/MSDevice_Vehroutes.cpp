@@ -53,9 +53,11 @@ bool MSDevice_Vehroutes::mySorted = false;
 bool MSDevice_Vehroutes::myIntendedDepart = false;
 bool MSDevice_Vehroutes::myRouteLength = false;
 bool MSDevice_Vehroutes::mySkipPTLines = false;
+bool MSDevice_Vehroutes::myWriteDictionary = false;
 MSDevice_Vehroutes::StateListener MSDevice_Vehroutes::myStateListener;
 std::map<const SUMOTime, int> MSDevice_Vehroutes::myDepartureCounts;
 std::map<const SUMOTime, std::map<const std::string, std::string> > MSDevice_Vehroutes::myRouteInfos;
+std::set<std::string> MSDevice_Vehroutes::myWrittenRoutes;
 
 
 // ===========================================================================
@@ -75,6 +77,7 @@ MSDevice_Vehroutes::init() {
         myIntendedDepart = OptionsCont::getOptions().getBool("vehroute-output.intended-depart");
         myRouteLength = OptionsCont::getOptions().getBool("vehroute-output.route-length");
         mySkipPTLines = OptionsCont::getOptions().getBool("vehroute-output.skip-ptlines");
+        myWriteDictionary = OptionsCont::getOptions().getBool("vehroute-output.dictionary");
         MSNet::getInstance()->addVehicleStateListener(&myStateListener);
     }
 }
@@ -240,6 +243,19 @@ MSDevice_Vehroutes::writeXMLRoute(OutputDevice& os, int index) const {
 }
 
 
+void
+MSDevice_Vehroutes::writeRouteDefinition(OutputDevice& routeOut) const {
+    if (myWrittenRoutes.count(myCurrentRoute->getID()) != 0) {
+        return;
+    }
+    routeOut.openTag(SUMO_TAG_ROUTE).writeAttr(SUMO_ATTR_ID, myCurrentRoute->getID());
+    routeOut << " edges=\"";
+    myCurrentRoute->writeEdgeIDs(routeOut, 0);
+    (routeOut << "\"").closeTag();
+    myWrittenRoutes.insert(myCurrentRoute->getID());
+}
+
+
 void
 MSDevice_Vehroutes::generateOutput() const {
     writeOutput(true);
@@ -308,6 +324,21 @@ MSDevice_Vehroutes::writeOutput(const bool hasArrived) const {
         } else {
             writeXMLRoute(od);
         }
+    } else if (myWriteDictionary && myReplacedRoutes.empty()) {
+        // the route definition is shared between all vehicles driving it so it
+        // is written (once) into the top-level dictionary and only referenced here
+        writeRouteDefinition(routeOut);
+        od.writeAttr(SUMO_ATTR_ROUTE, myCurrentRoute->getID());
+        if (mySaveExits) {
+            std::ostringstream str;
+            for (std::vector<SUMOTime>::const_iterator it = myExits.begin(); it != myExits.end(); ++it) {
+                if (it != myExits.begin()) {
+                    str << " ";
+                }
+                str << time2string(*it);
+            }
+            od.writeAttr("exitTimes", str.str());
+        }
     } else {
         if (myReplacedRoutes.size() > 0) {
             od.openTag(SUMO_TAG_ROUTE_DISTRIBUTION);
@@ -166,6 +166,13 @@ private:
     void writeXMLRoute(OutputDevice& os, int index = -1) const;
 
 
+    /** @brief Writes the current route into the dictionary unless already present
+     *
+     * @param[in] routeOut the output device to write the route definition into
+     */
+    void writeRouteDefinition(OutputDevice& routeOut) const;
+
+
     /** @brief Called on writing vehroutes output
     *
     * @param[in] hasArrived whether the vehicle has valid arrival information
@@ -202,6 +209,9 @@ private:
     /// @brief A shortcut for the Option "vehroute-output.skip-ptlines"
     static bool mySkipPTLines;
 
+    /// @brief A shortcut for the Option "vehroute-output.dictionary"
+    static bool myWriteDictionary;
+
 
     /** @class StateListener
      * @brief A class that is notified about reroutings
@@ -232,6 +242,9 @@ private:
     /// @todo: describe
     static std::map<const SUMOTime, std::map<const std::string, std::string> > myRouteInfos;
 
+    /// @brief The ids of routes which were already written to the dictionary
+    static std::set<std::string> myWrittenRoutes;
+
 
     /**
      * @class RouteReplaceInfo
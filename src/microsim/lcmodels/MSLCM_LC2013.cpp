@@ -1204,7 +1204,8 @@ MSLCM_LC2013::_wantsChange(
     double roundaboutDistanceAheadNeigh = 0;
     int roundaboutEdgesAhead = 0;
     int roundaboutEdgesAheadNeigh = 0;
-    if (!isOpposite()) {
+    if (!isOpposite() && MSEdge::haveRoundabouts()) {
+        // skip the continuation scan if the network has no roundabouts at all
         getRoundaboutAheadInfo(this, curr, neigh, roundaboutDistanceAhead, roundaboutDistanceAheadNeigh, roundaboutEdgesAhead, roundaboutEdgesAheadNeigh);
     }
     // 2) add a distance bonus for roundabout edges
@@ -28,6 +28,7 @@
 #endif
 
 #include <iostream>
+#include <deque>
 #include <utils/common/RandHelper.h>
 #include <utils/common/TplConvert.h>
 #include <microsim/MSEdge.h>
@@ -1146,21 +1147,24 @@ MSLCM_SL2015::_wantsChangeSublane(
     // TODO: include updated roundabout distance code from LC2013 (probably best to put it to AbstractLCModel class)
     // VARIANT_15 (insideRoundabout)
     int roundaboutEdgesAhead = 0;
-    for (std::vector<MSLane*>::iterator it = curr.bestContinuations.begin(); it != curr.bestContinuations.end(); ++it) {
-        if ((*it) != 0 && (*it)->getEdge().isRoundabout()) {
-            roundaboutEdgesAhead += 1;
-        } else if (roundaboutEdgesAhead > 0) {
-            // only check the next roundabout
-            break;
-        }
-    }
     int roundaboutEdgesAheadNeigh = 0;
-    for (std::vector<MSLane*>::iterator it = neigh.bestContinuations.begin(); it != neigh.bestContinuations.end(); ++it) {
-        if ((*it) != 0 && (*it)->getEdge().isRoundabout()) {
-            roundaboutEdgesAheadNeigh += 1;
-        } else if (roundaboutEdgesAheadNeigh > 0) {
-            // only check the next roundabout
-            break;
+    if (MSEdge::haveRoundabouts()) {
+        // skip the continuation scans if the network has no roundabouts at all
+        for (std::vector<MSLane*>::iterator it = curr.bestContinuations.begin(); it != curr.bestContinuations.end(); ++it) {
+            if ((*it) != 0 && (*it)->getEdge().isRoundabout()) {
+                roundaboutEdgesAhead += 1;
+            } else if (roundaboutEdgesAhead > 0) {
+                // only check the next roundabout
+                break;
+            }
+        }
+        for (std::vector<MSLane*>::iterator it = neigh.bestContinuations.begin(); it != neigh.bestContinuations.end(); ++it) {
+            if ((*it) != 0 && (*it)->getEdge().isRoundabout()) {
+                roundaboutEdgesAheadNeigh += 1;
+            } else if (roundaboutEdgesAheadNeigh > 0) {
+                // only check the next roundabout
+                break;
+            }
         }
     }
     if (roundaboutEdgesAhead > 1) {
@@ -1397,18 +1401,32 @@ MSLCM_SL2015::_wantsChangeSublane(
                 << " sublaneCompact=" << sublaneCompact
                 << "\n";
 #endif
+    // compute the minimum expected speed over the sublanes covered by the
+    // vehicle for all candidate positions in a single sliding-window pass
+    // instead of rescanning the covered range for every candidate
+    std::vector<double> minCoveredSpeeds(sublaneSides.size());
+    {
+        std::deque<int> window; // indices with increasing speeds within the covered range
+        int windowEnd = -1;
+        for (int i = 0; i < (int)sublaneSides.size(); ++i) {
+            while (windowEnd + 1 < (int)sublaneSides.size() && sublaneSides[windowEnd + 1] < sublaneSides[i] + vehWidth) {
+                ++windowEnd;
+                while (!window.empty() && myExpectedSublaneSpeeds[window.back()] >= myExpectedSublaneSpeeds[windowEnd]) {
+                    window.pop_back();
+                }
+                window.push_back(windowEnd);
+            }
+            while (window.front() < i) {
+                window.pop_front();
+            }
+            minCoveredSpeeds[i] = myExpectedSublaneSpeeds[window.front()];
+        }
+    }
     for (int i = iMin; i < (int)sublaneSides.size(); ++i) {
         if (sublaneSides[i] + vehWidth < leftMax) {
             // i is the rightmost sublane and the left side of vehicles still fits on the edge,
-            // compute min speed of all sublanes covered by the vehicle in this case
-            double vMin = myExpectedSublaneSpeeds[i];
-            //std::cout << "   i=" << i << "\n";
-            int j = i;
-            while (vMin > 0 && j < (int)sublaneSides.size() && sublaneSides[j] < sublaneSides[i] + vehWidth) {
-                vMin = MIN2(vMin, myExpectedSublaneSpeeds[j]);
-                //std::cout << "     j=" << j << " vMin=" << vMin << " sublaneSides[j]=" << sublaneSides[j] << " leftVehSide=" << leftVehSide << " rightVehSide=" << rightVehSide << "\n";
-                ++j;
-            }
+            // use the precomputed min speed of all sublanes covered by the vehicle in this case
+            const double vMin = minCoveredSpeeds[i];
             const double relativeGain = (vMin - defaultNextSpeed) / MAX2(vMin, RELGAIN_NORMALIZATION_MIN_SPEED);
             const double currentLatDist = sublaneSides[i] - rightVehSide;
             // @note this is biased for changing to the left since we compare the sublanes in ascending order
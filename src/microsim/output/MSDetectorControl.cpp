@@ -35,6 +35,9 @@
 #include <iostream>
 #include "MSDetectorControl.h"
 #include "MSMeanData_Net.h"
+#include <microsim/MSNet.h>
+#include <microsim/MSEdgeControl.h>
+#include <utils/iodevices/OutputDevice_String.h>
 #include <utils/options/OptionsCont.h>
 #include <utils/options/Option.h>
 #include <utils/common/MsgHandler.h>
@@ -128,6 +131,27 @@ MSDetectorControl::updateDetectors(const SUMOTime step) {
 }
 
 
+void
+MSDetectorControl::reset() {
+    for (const auto& i : myDetectors) {
+        for (const auto& j : getTypedDetectors(i.first)) {
+            j.second->reset();
+        }
+    }
+    for (MSMeanData* const i : myMeanData) {
+        i->reset();
+    }
+}
+
+
+#ifdef HAVE_FOX
+void
+MSDetectorControl::FlushTask::run(FXWorkerThread*) {
+    myDetector.writeXMLOutput(myBuffer, myBegin, myEnd);
+}
+#endif
+
+
 void
 MSDetectorControl::writeOutput(SUMOTime step, bool closing) {
     for (Intervals::iterator i = myIntervals.begin(); i != myIntervals.end(); ++i) {
@@ -136,6 +160,35 @@ MSDetectorControl::writeOutput(SUMOTime step, bool closing) {
             DetectorFileVec dfVec = (*i).second;
             SUMOTime startTime = myLastCalls[interval];
             // check whether at the end the output was already generated
+#ifdef HAVE_FOX
+            FXWorkerThread::Pool& pool = MSNet::getInstance()->getEdgeControl().getThreadPool();
+            if (pool.size() > 1 && dfVec.size() > 1) {
+                // format each detector into a buffer of its own in parallel
+                //  and append the buffers to the real devices in order;
+                //  binary devices need the formatter state of the real device
+                //  and are thus written serially below
+                std::vector<OutputDevice_String*> buffers(dfVec.size(), 0);
+                int index = 0;
+                for (DetectorFileVec::iterator it = dfVec.begin(); it != dfVec.end(); ++it, ++index) {
+                    if (!it->second->isBinary()) {
+                        buffers[index] = new OutputDevice_String(false, 1);
+                        pool.add(new FlushTask(*it->first, *buffers[index], startTime, step), index % pool.size());
+                    }
+                }
+                pool.waitAll();
+                index = 0;
+                for (DetectorFileVec::iterator it = dfVec.begin(); it != dfVec.end(); ++it, ++index) {
+                    if (buffers[index] != 0) {
+                        it->second->writePreformattedTag(buffers[index]->getString());
+                        delete buffers[index];
+                    } else {
+                        it->first->writeXMLOutput(*(it->second), startTime, step);
+                    }
+                }
+                myLastCalls[interval] = step;
+                continue;
+            }
+#endif
             for (DetectorFileVec::iterator it = dfVec.begin(); it != dfVec.end(); ++it) {
                 MSDetectorFileOutput* det = it->first;
                 det->writeXMLOutput(*(it->second), startTime, step);
@@ -146,6 +199,16 @@ MSDetectorControl::writeOutput(SUMOTime step, bool closing) {
 }
 
 
+SUMOTime
+MSDetectorControl::getNextIntervalEnd() const {
+    SUMOTime result = SUMOTime_MAX;
+    for (std::map<IntervalsKey, SUMOTime>::const_iterator i = myLastCalls.begin(); i != myLastCalls.end(); ++i) {
+        result = MIN2(result, (*i).second + (*i).first.first);
+    }
+    return result;
+}
+
+
 void
 MSDetectorControl::addDetectorAndInterval(MSDetectorFileOutput* det,
         OutputDevice* device,
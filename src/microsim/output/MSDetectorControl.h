@@ -41,6 +41,9 @@
 #include <microsim/output/MSE3Collector.h>
 #include <microsim/output/MSInductLoop.h>
 #include <microsim/output/MSRouteProbe.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 
 // ===========================================================================
@@ -170,6 +173,15 @@ public:
     void updateDetectors(const SUMOTime step);
 
 
+    /** @brief Resets the dynamic state of all known detectors
+     *
+     * Calls "reset" on every detector and mean data collector; the
+     *  values gathered so far are discarded while the detectors
+     *  themselves stay registered
+     */
+    void reset();
+
+
     /** @brief Writes the output to be generated within the given time step
      *
      * Goes through the list of intervals. If one interval has ended within the
@@ -184,6 +196,16 @@ public:
     void writeOutput(SUMOTime step, bool closing);
 
 
+    /** @brief Returns the time at which the earliest sampling interval ends
+     *
+     * Used to bound jumps over idle simulation time so that no interval
+     *  output is written with a shifted interval end.
+     *
+     * @return The end of the earliest pending interval (SUMOTime_MAX if none)
+     */
+    SUMOTime getNextIntervalEnd() const;
+
+
 protected:
     /// @name Structures needed for assigning detectors to intervals
     /// @{
@@ -219,6 +241,32 @@ protected:
         }
     };
 
+#ifdef HAVE_FOX
+    /**
+     * @class FlushTask
+     * @brief Formats the closed interval of one detector into a string buffer
+     *
+     * Every task writes into a buffer of its own so that detectors sharing
+     *  an output device may be formatted concurrently. The buffers are
+     *  appended to the real devices in order after all tasks have finished.
+     */
+    class FlushTask : public FXWorkerThread::Task {
+    public:
+        FlushTask(MSDetectorFileOutput& detector, OutputDevice& buffer,
+                  const SUMOTime begin, const SUMOTime end)
+            : myDetector(detector), myBuffer(buffer), myBegin(begin), myEnd(end) {}
+        void run(FXWorkerThread* context);
+    private:
+        MSDetectorFileOutput& myDetector;
+        OutputDevice& myBuffer;
+        const SUMOTime myBegin;
+        const SUMOTime myEnd;
+    private:
+        /// @brief Invalidated assignment operator.
+        FlushTask& operator=(const FlushTask&);
+    };
+#endif
+
 protected:
     /// @brief The detectors map, first by detector type, then using NamedObjectCont (@see NamedObjectCont)
     std::map<SumoXMLTag, NamedObjectCont< MSDetectorFileOutput*> > myDetectors;
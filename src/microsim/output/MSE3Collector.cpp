@@ -249,7 +249,7 @@ MSE3Collector::writeXMLOutput(OutputDevice& dev,
     double meanSpeed = 0.;
     double meanHaltsPerVehicle = 0.;
     double meanTimeLoss = 0.;
-    for (std::map<const SUMOVehicle*, E3Values>::iterator i = myLeftContainer.begin(); i != myLeftContainer.end(); ++i) {
+    for (VehicleInfoMap::iterator i = myLeftContainer.begin(); i != myLeftContainer.end(); ++i) {
         meanHaltsPerVehicle += (double)(*i).second.haltings;
         meanTravelTime += (*i).second.frontLeaveTime - (*i).second.entryTime;
         const double steps = (*i).second.backLeaveTime - (*i).second.entryTime;
@@ -274,7 +274,7 @@ MSE3Collector::writeXMLOutput(OutputDevice& dev,
     double meanIntervalHaltsPerVehicleWithin = 0.;
     double meanIntervalDurationWithin = 0.;
     double meanTimeLossWithin = 0.;
-    for (std::map<const SUMOVehicle*, E3Values>::iterator i = myEnteredContainer.begin(); i != myEnteredContainer.end(); ++i) {
+    for (VehicleInfoMap::iterator i = myEnteredContainer.begin(); i != myEnteredContainer.end(); ++i) {
         meanHaltsPerVehicleWithin += (double)(*i).second.haltings;
         meanIntervalHaltsPerVehicleWithin += (double)(*i).second.intervalHaltings;
         const double end = (*i).second.backLeaveTime == 0 ? STEPS2TIME(stopTime) : (*i).second.backLeaveTime;
@@ -336,7 +336,7 @@ void
 MSE3Collector::detectorUpdate(const SUMOTime step) {
     myCurrentMeanSpeed = 0;
     myCurrentHaltingsNumber = 0;
-    for (std::map<const SUMOVehicle*, E3Values>::iterator pair = myEnteredContainer.begin(); pair != myEnteredContainer.end(); ++pair) {
+    for (VehicleInfoMap::iterator pair = myEnteredContainer.begin(); pair != myEnteredContainer.end(); ++pair) {
         const SUMOVehicle* veh = pair->first;
         E3Values& values = pair->second;
         myCurrentMeanSpeed += veh->getSpeed();
@@ -385,7 +385,7 @@ MSE3Collector::getVehiclesWithin() const {
 std::vector<std::string>
 MSE3Collector::getCurrentVehicleIDs() const {
     std::vector<std::string> ret;
-    for (std::map<const SUMOVehicle*, E3Values>::const_iterator pair = myEnteredContainer.begin(); pair != myEnteredContainer.end(); ++pair) {
+    for (VehicleInfoMap::const_iterator pair = myEnteredContainer.begin(); pair != myEnteredContainer.end(); ++pair) {
         ret.push_back((*pair).first->getID());
     }
     std::sort(ret.begin(), ret.end());
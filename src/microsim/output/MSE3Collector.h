@@ -34,6 +34,7 @@
 
 #include <string>
 #include <vector>
+#include <unordered_map>
 #include <limits>
 #include <microsim/MSMoveReminder.h>
 #include <microsim/output/MSDetectorFileOutput.h>
@@ -376,11 +377,15 @@ protected:
         bool hadUpdate;
     };
 
+    /// @brief Hashed container type for vehicle state; enter / leave lookups
+    ///  stay constant time even with many vehicles inside the area
+    typedef std::unordered_map<const SUMOVehicle*, E3Values> VehicleInfoMap;
+
     /// @brief Container for vehicles that have entered the area
-    std::map<const SUMOVehicle*, E3Values> myEnteredContainer;
+    VehicleInfoMap myEnteredContainer;
 
     /// @brief Container for vehicles that have left the area
-    std::map<const SUMOVehicle*, E3Values> myLeftContainer;
+    VehicleInfoMap myLeftContainer;
 
 
     /// @name Storages for current values
@@ -30,10 +30,16 @@
 #include <config.h>
 #endif
 
+#include <map>
+#include <set>
+#include <utils/common/MsgHandler.h>
 #include <utils/iodevices/OutputDevice.h>
 #include <utils/options/OptionsCont.h>
+#include <utils/geom/Boundary.h>
 #include <utils/geom/GeoConvHelper.h>
 #include <utils/geom/GeomHelper.h>
+#include <utils/shapes/SUMOPolygon.h>
+#include <utils/shapes/ShapeContainer.h>
 #include <microsim/MSEdgeControl.h>
 #include <microsim/MSEdge.h>
 #include <microsim/MSLane.h>
@@ -45,6 +51,34 @@
 #include <microsim/MSTransportableControl.h>
 #include <microsim/MSContainer.h>
 #include <microsim/MSVehicleControl.h>
+#include <microsim/MSVehicleType.h>
+
+
+// ===========================================================================
+// static member variables
+// ===========================================================================
+// the filtering regions (bounding box for the cheap pre-test plus a copy of
+//  the shape; the polygons in the shape container may be removed at runtime)
+static std::vector<std::pair<Boundary, PositionVector> > gFilterShapes;
+static bool gFilterShapesInit = false;
+
+
+// ===========================================================================
+// static methods
+// ===========================================================================
+/// @brief whether the given position lies within one of the filtering regions (or no filter is set)
+static bool
+isVisible(const Position& pos) {
+    if (gFilterShapes.empty()) {
+        return true;
+    }
+    for (std::vector<std::pair<Boundary, PositionVector> >::const_iterator i = gFilterShapes.begin(); i != gFilterShapes.end(); ++i) {
+        if ((*i).first.around(pos) && (*i).second.around(pos)) {
+            return true;
+        }
+    }
+    return false;
+}
 
 
 // ===========================================================================
@@ -52,15 +86,52 @@
 // ===========================================================================
 void
 MSFCDExport::write(OutputDevice& of, SUMOTime timestep, bool elevation) {
-    const bool useGeo = OptionsCont::getOptions().getBool("fcd-output.geo");
-    const bool signals = OptionsCont::getOptions().getBool("fcd-output.signals");
+    const OptionsCont& oc = OptionsCont::getOptions();
+    const bool useGeo = oc.getBool("fcd-output.geo");
+    const bool signals = oc.getBool("fcd-output.signals");
+    const SUMOTime begin = string2time(oc.getString("begin"));
+    const SUMOTime period = string2time(oc.getString("fcd-output.period"));
+    const std::vector<std::string> attrList = oc.getStringVector("fcd-output.attributes");
+    const std::set<std::string> attrMask(attrList.begin(), attrList.end());
+    const bool writeAngle = attrMask.empty() || attrMask.count("angle") > 0;
+    const bool writeType = attrMask.empty() || attrMask.count("type") > 0;
+    const bool writeSpeed = attrMask.empty() || attrMask.count("speed") > 0;
+    const bool writePos = attrMask.empty() || attrMask.count("pos") > 0;
+    const bool writeLane = attrMask.empty() || attrMask.count("lane") > 0;
+    const bool writeSlope = attrMask.empty() || attrMask.count("slope") > 0;
+    if (!gFilterShapesInit) {
+        gFilterShapesInit = true;
+        const std::vector<std::string> shapeIDs = oc.getStringVector("fcd-output.filter-shapes");
+        for (std::vector<std::string>::const_iterator i = shapeIDs.begin(); i != shapeIDs.end(); ++i) {
+            const SUMOPolygon* const p = MSNet::getInstance()->getShapeContainer().getPolygons().get(*i);
+            if (p == 0) {
+                WRITE_ERROR("Unknown polygon '" + *i + "' in fcd-output.filter-shapes.");
+            } else {
+                gFilterShapes.push_back(std::make_pair(p->getShape().getBoxBoundary(), p->getShape()));
+            }
+        }
+    }
     of.openTag("timestep").writeAttr(SUMO_ATTR_TIME, time2string(timestep));
     MSVehicleControl& vc = MSNet::getInstance()->getVehicleControl();
     for (MSVehicleControl::constVehIt it = vc.loadedVehBegin(); it != vc.loadedVehEnd(); ++it) {
         const SUMOVehicle* veh = it->second;
         const MSVehicle* microVeh = dynamic_cast<const MSVehicle*>(veh);
         if (veh->isOnRoad() || veh->isParking() || veh->isRemoteControlled()) {
+            // the type may request its own emission rate (e.g. high-frequency probes);
+            //  the parsed value is memoized on the type itself so it cannot
+            //  outlive it (singular types are deleted with their vehicle)
+            SUMOTime effectivePeriod = period;
+            const double typePeriod = veh->getVehicleType().getParameter().getDouble("fcd.period", -1.);
+            if (typePeriod >= 0) {
+                effectivePeriod = TIME2STEPS(typePeriod);
+            }
+            if (effectivePeriod > 0 && (timestep - begin) % effectivePeriod != 0) {
+                continue;
+            }
             Position pos = veh->getPosition();
+            if (!isVisible(pos)) {
+                continue;
+            }
             if (useGeo) {
                 of.setPrecision(gPrecisionGeo);
                 GeoConvHelper::getFinal().cartesian2geo(pos);
@@ -72,14 +143,24 @@ MSFCDExport::write(OutputDevice& of, SUMOTime timestep, bool elevation) {
             if (elevation) {
                 of.writeAttr(SUMO_ATTR_Z, pos.z());
             }
-            of.writeAttr(SUMO_ATTR_ANGLE, GeomHelper::naviDegree(veh->getAngle()));
-            of.writeAttr(SUMO_ATTR_TYPE, veh->getVehicleType().getID());
-            of.writeAttr(SUMO_ATTR_SPEED, veh->getSpeed());
-            of.writeAttr(SUMO_ATTR_POSITION, veh->getPositionOnLane());
-            if (microVeh != 0) {
+            if (writeAngle) {
+                of.writeAttr(SUMO_ATTR_ANGLE, GeomHelper::naviDegree(veh->getAngle()));
+            }
+            if (writeType) {
+                of.writeAttr(SUMO_ATTR_TYPE, veh->getVehicleType().getID());
+            }
+            if (writeSpeed) {
+                of.writeAttr(SUMO_ATTR_SPEED, veh->getSpeed());
+            }
+            if (writePos) {
+                of.writeAttr(SUMO_ATTR_POSITION, veh->getPositionOnLane());
+            }
+            if (microVeh != 0 && writeLane) {
                 of.writeAttr(SUMO_ATTR_LANE, microVeh->getLane()->getID());
             }
-            of.writeAttr(SUMO_ATTR_SLOPE, veh->getSlope());
+            if (writeSlope) {
+                of.writeAttr(SUMO_ATTR_SLOPE, veh->getSlope());
+            }
             if (microVeh != 0 && signals) {
                 of.writeAttr("signals", toString(microVeh->getSignals()));
             }
@@ -97,7 +178,9 @@ MSFCDExport::write(OutputDevice& of, SUMOTime timestep, bool elevation) {
             }
         }
     }
-    if (MSNet::getInstance()->getPersonControl().hasTransportables()) {
+    // transportables follow the global period only
+    const bool transportablesDue = period <= 0 || (timestep - begin) % period == 0;
+    if (transportablesDue && MSNet::getInstance()->getPersonControl().hasTransportables()) {
         // write persons
         MSEdgeControl& ec = MSNet::getInstance()->getEdgeControl();
         const MSEdgeVector& edges = ec.getEdges();
@@ -108,7 +191,7 @@ MSFCDExport::write(OutputDevice& of, SUMOTime timestep, bool elevation) {
             }
         }
     }
-    if (MSNet::getInstance()->getContainerControl().hasTransportables()) {
+    if (transportablesDue && MSNet::getInstance()->getContainerControl().hasTransportables()) {
         // write containers
         MSEdgeControl& ec = MSNet::getInstance()->getEdgeControl();
         const std::vector<MSEdge*>& edges = ec.getEdges();
@@ -123,9 +206,19 @@ MSFCDExport::write(OutputDevice& of, SUMOTime timestep, bool elevation) {
 }
 
 
+void
+MSFCDExport::cleanup() {
+    gFilterShapes.clear();
+    gFilterShapesInit = false;
+}
+
+
 void
 MSFCDExport::writeTransportable(OutputDevice& of, const MSEdge* e, MSTransportable* p, SumoXMLTag tag, bool useGeo, bool elevation) {
     Position pos = p->getPosition();
+    if (!isVisible(pos)) {
+        return;
+    }
     if (useGeo) {
         of.setPrecision(gPrecisionGeo);
         GeoConvHelper::getFinal().cartesian2geo(pos);
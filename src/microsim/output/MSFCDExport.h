@@ -66,6 +66,14 @@ public:
      */
     static void write(OutputDevice& of, SUMOTime timestep, bool elevation);
 
+    /** @brief Discards the cached filter shapes so they are resolved anew
+     *
+     * To be called when the shape container changes or the simulation is
+     *  reloaded; the cache holds copies, so this is needed for up-to-date
+     *  filtering rather than for memory safety.
+     */
+    static void cleanup();
+
 private:
     /// @brief write transportable
     static void writeTransportable(OutputDevice& of, const MSEdge* e, MSTransportable* p, SumoXMLTag tag, bool useGeo, bool elevation);
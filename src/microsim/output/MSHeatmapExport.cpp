@@ -0,0 +1,131 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2017 German Aerospace Center (DLR) and others.
+/****************************************************************************/
+//
+//   This program and the accompanying materials
+//   are made available under the terms of the Eclipse Public License v2.0
+//   which accompanies this distribution, and is available at
+//   http://www.eclipse.org/legal/epl-v20.html
+//
+/****************************************************************************/
+/// @file    MSHeatmapExport.cpp
+/// @date    2017-09-01
+/// @version $Id$
+///
+// Aggregates traffic onto a raster grid over the network
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cmath>
+#include <vector>
+#include <utils/common/SUMOTime.h>
+#include <utils/iodevices/OutputDevice.h>
+#include <utils/options/OptionsCont.h>
+#include <utils/geom/GeoConvHelper.h>
+#include <utils/geom/Boundary.h>
+#include "MSHeatmapExport.h"
+#include <microsim/MSNet.h>
+#include <microsim/MSVehicle.h>
+#include <microsim/MSVehicleControl.h>
+
+
+// ===========================================================================
+// static member variables
+// ===========================================================================
+// the grid is built on first use from the converted network boundary
+static bool gInitialised = false;
+static double gXmin, gYmin, gCellSize;
+static int gCols, gRows;
+static SUMOTime gPeriod;
+static SUMOTime gIntervalBegin;
+// per-cell accumulators, indexed row-wise
+static std::vector<double> gSampleSeconds;
+static std::vector<double> gSpeedSum;
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+void
+MSHeatmapExport::write(OutputDevice& of, SUMOTime timestep) {
+    if (!gInitialised) {
+        const OptionsCont& oc = OptionsCont::getOptions();
+        gCellSize = oc.getFloat("heatmap-output.cell-size");
+        gPeriod = string2time(oc.getString("heatmap-output.period"));
+        const Boundary& b = GeoConvHelper::getFinal().getConvBoundary();
+        gXmin = b.xmin();
+        gYmin = b.ymin();
+        gCols = MAX2(1, (int)ceil((b.xmax() - gXmin) / gCellSize));
+        gRows = MAX2(1, (int)ceil((b.ymax() - gYmin) / gCellSize));
+        gSampleSeconds.assign(gCols * gRows, 0.);
+        gSpeedSum.assign(gCols * gRows, 0.);
+        gIntervalBegin = timestep;
+        gInitialised = true;
+    }
+    MSVehicleControl& vc = MSNet::getInstance()->getVehicleControl();
+    for (MSVehicleControl::constVehIt it = vc.loadedVehBegin(); it != vc.loadedVehEnd(); ++it) {
+        const SUMOVehicle* veh = it->second;
+        if (!veh->isOnRoad()) {
+            continue;
+        }
+        const Position& pos = veh->getPosition();
+        // vehicles on the boundary edge belong to the outermost cell
+        const int col = MIN2(gCols - 1, MAX2(0, (int)((pos.x() - gXmin) / gCellSize)));
+        const int row = MIN2(gRows - 1, MAX2(0, (int)((pos.y() - gYmin) / gCellSize)));
+        const int index = row * gCols + col;
+        gSampleSeconds[index] += TS;
+        gSpeedSum[index] += veh->getSpeed() * TS;
+    }
+    if (timestep + DELTA_T - gIntervalBegin >= gPeriod) {
+        writeInterval(of, timestep + DELTA_T);
+        gIntervalBegin = timestep + DELTA_T;
+    }
+}
+
+
+void
+MSHeatmapExport::finish(OutputDevice& of, SUMOTime timestep) {
+    if (gInitialised && timestep > gIntervalBegin) {
+        writeInterval(of, timestep);
+    }
+}
+
+
+void
+MSHeatmapExport::writeInterval(OutputDevice& of, SUMOTime end) {
+    of.openTag("interval");
+    of.writeAttr(SUMO_ATTR_BEGIN, time2string(gIntervalBegin)).writeAttr(SUMO_ATTR_END, time2string(end));
+    of.writeAttr("cellSize", gCellSize).writeAttr("xMin", gXmin).writeAttr("yMin", gYmin);
+    of.writeAttr("cols", gCols).writeAttr("rows", gRows);
+    for (int row = 0; row < gRows; ++row) {
+        for (int col = 0; col < gCols; ++col) {
+            const int index = row * gCols + col;
+            const double sampleSeconds = gSampleSeconds[index];
+            if (sampleSeconds == 0.) {
+                // empty cells are omitted; the raster dimensions are in the header
+                continue;
+            }
+            of.openTag("cell");
+            of.writeAttr("x", col).writeAttr("y", row);
+            of.writeAttr("sampleSeconds", sampleSeconds);
+            of.writeAttr("speed", gSpeedSum[index] / sampleSeconds);
+            of.closeTag();
+        }
+    }
+    of.closeTag();
+    gSampleSeconds.assign(gCols * gRows, 0.);
+    gSpeedSum.assign(gCols * gRows, 0.);
+}
+
+
+/****************************************************************************/
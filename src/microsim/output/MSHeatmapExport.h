@@ -0,0 +1,95 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2017 German Aerospace Center (DLR) and others.
+/****************************************************************************/
+//
+//   This program and the accompanying materials
+//   are made available under the terms of the Eclipse Public License v2.0
+//   which accompanies this distribution, and is available at
+//   http://www.eclipse.org/legal/epl-v20.html
+//
+/****************************************************************************/
+/// @file    MSHeatmapExport.h
+/// @date    2017-09-01
+/// @version $Id$
+///
+// Aggregates traffic onto a raster grid over the network
+/****************************************************************************/
+#ifndef MSHeatmapExport_h
+#define MSHeatmapExport_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <utils/common/SUMOTime.h>
+
+
+// ===========================================================================
+// class declarations
+// ===========================================================================
+class OutputDevice;
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class MSHeatmapExport
+ * @brief Aggregates traffic onto a raster grid over the network
+ *
+ * The class accumulates the time vehicles spend in each cell of a regular
+ *  grid laid over the network boundary together with their speeds and
+ *  writes the non-empty cells once per aggregation interval. This replaces
+ *  rasterising edge-based dumps in a post-processing step.
+ *
+ * @todo consider error-handling on write (using IOError)
+ */
+class MSHeatmapExport {
+public:
+    /** @brief Adds the current vehicle positions to the grid
+     *
+     * Must be called every simulation step; writes and resets the grid
+     *  whenever the aggregation interval is over.
+     *
+     * @param[in] of The output device to use
+     * @param[in] timestep The current time step
+     * @exception IOError If an error on writing occurs (!!! not yet implemented)
+     */
+    static void write(OutputDevice& of, SUMOTime timestep);
+
+
+    /** @brief Writes the remainder of the current interval
+     *
+     * Called once when the simulation ends so that an incomplete last
+     *  interval is not lost.
+     *
+     * @param[in] of The output device to use
+     * @param[in] timestep The final time step
+     */
+    static void finish(OutputDevice& of, SUMOTime timestep);
+
+
+private:
+    /// @brief Writes the collected cells as an interval element and resets them
+    static void writeInterval(OutputDevice& of, SUMOTime end);
+
+private:
+    /// @brief Invalidated copy constructor.
+    MSHeatmapExport(const MSHeatmapExport&);
+
+    /// @brief Invalidated assignment operator.
+    MSHeatmapExport& operator=(const MSHeatmapExport&);
+
+};
+
+
+#endif
+
+/****************************************************************************/
@@ -46,6 +46,7 @@
 // ===========================================================================
 class MSLane;
 class MSVehicle;
+class MSVehicleType;
 class OutputDevice;
 
 
@@ -102,6 +103,19 @@ public:
     }
 
 
+    /** @brief Switches the detector to (or from) counting-only mode
+     *
+     * In counting-only mode the loop collects per-type passage counts
+     *  instead of per-vehicle records. The vehicle-level getters and the
+     *  dwell-based interval values are not available then.
+     *
+     * @param[in] val Whether only passage counts shall be collected
+     */
+    void setCountOnly(bool val) {
+        myCountOnly = val;
+    }
+
+
     /// @name Methods inherited from MSMoveReminder
     /// @{
     /** @brief Checks whether the reminder is activated by a vehicle entering the lane
@@ -349,6 +363,12 @@ protected:
     /// @brief The number of entered vehicles
     int myEnteredVehicleNumber;
 
+    /// @brief Whether only per-type passage counts are collected
+    bool myCountOnly;
+
+    /// @brief Passage counts by vehicle type (counting-only mode)
+    std::map<const MSVehicleType*, int> myPassedCountByType;
+
 
     /// @brief Type of myVehicleDataCont.
     typedef std::deque< VehicleData > VehicleDataCont;
@@ -31,6 +31,7 @@
 #include <config.h>
 #endif
 
+#include <algorithm>
 #include <limits>
 #include <microsim/MSEdgeControl.h>
 #include <microsim/MSEdge.h>
@@ -66,6 +67,7 @@ MSMeanData::MeanDataValues::MeanDataValues(
     const MSMeanData* const parent) :
     MSMoveReminder("meandata_" + (lane == 0 ? "NULL" :  lane->getID()), lane, doAdd),
     myParent(parent),
+    myWriteIndex(-1),
     myLaneLength(length),
     sampleSeconds(0),
     travelledDistance(0) {}
@@ -75,6 +77,14 @@ MSMeanData::MeanDataValues::~MeanDataValues() {
 }
 
 
+void
+MSMeanData::MeanDataValues::setDirty() {
+    if (myParent != 0 && myWriteIndex >= 0) {
+        myParent->markDirty(myWriteIndex);
+    }
+}
+
+
 bool
 MSMeanData::MeanDataValues::notifyEnter(SUMOVehicle& veh, MSMoveReminder::Notification reason, const MSLane* enteredLane) {
 #ifdef DEBUG_NOTIFY_ENTER
@@ -252,6 +262,7 @@ MSMeanData::MeanDataValues::notifyMove(SUMOVehicle& veh, double oldPos, double n
 //    const double travelledDistanceFrontOnLane = frontOnLane*newSpeed;
 //    const double travelledDistanceVehicleOnLane = timeOnLane*newSpeed;
 
+    setDirty();
     notifyMoveInternal(veh, frontOnLane, timeOnLane, (enterSpeed + leaveSpeedFront) / 2., (enterSpeed + leaveSpeed) / 2., travelledDistanceFrontOnLane, travelledDistanceVehicleOnLane, meanLengthOnLane);
     return ret;
 }
@@ -469,8 +480,13 @@ MSMeanData::init() {
                     myMeasures.back().push_back(createValues(*lane, (*lane)->getLength(), true));
                 }
             }
+            // let the collectors mark this edge as active when they receive data
+            for (std::vector<MeanDataValues*>::const_iterator j = myMeasures.back().begin(); j != myMeasures.back().end(); ++j) {
+                (*j)->setWriteIndex((int)myMeasures.size() - 1);
+            }
         }
     }
+    myEdgeDirty.resize(myMeasures.size(), false);
 }
 
 
@@ -483,6 +499,12 @@ MSMeanData::~MSMeanData() {
 }
 
 
+void
+MSMeanData::reset() {
+    resetOnly(MSNet::getInstance()->getCurrentTimeStep());
+}
+
+
 void
 MSMeanData::resetOnly(SUMOTime stopTime) {
     UNUSED_PARAMETER(stopTime);
@@ -499,11 +521,34 @@ MSMeanData::resetOnly(SUMOTime stopTime) {
         }
         return;
     }
+    if (!myTrackVehicles) {
+        // an untouched collector holds no data so only those which saw
+        //  traffic in this interval need resetting
+        for (std::vector<int>::const_iterator i = myDirtyEdges.begin(); i != myDirtyEdges.end(); ++i) {
+            const std::vector<MeanDataValues*>& values = myMeasures[*i];
+            for (std::vector<MeanDataValues*>::const_iterator j = values.begin(); j != values.end(); ++j) {
+                (*j)->reset();
+            }
+        }
+        clearDirty();
+        return;
+    }
+    // tracking requires a fresh entry on every collector
     for (std::vector<std::vector<MeanDataValues*> >::const_iterator i = myMeasures.begin(); i != myMeasures.end(); ++i) {
         for (std::vector<MeanDataValues*>::const_iterator j = (*i).begin(); j != (*i).end(); ++j) {
             (*j)->reset();
         }
     }
+    clearDirty();
+}
+
+
+void
+MSMeanData::clearDirty() const {
+    for (std::vector<int>::const_iterator i = myDirtyEdges.begin(); i != myDirtyEdges.end(); ++i) {
+        myEdgeDirty[*i] = false;
+    }
+    myDirtyEdges.clear();
 }
 
 
@@ -626,12 +671,22 @@ MSMeanData::writeXMLOutput(OutputDevice& dev,
             myPendingIntervals.pop_front();
         }
         openInterval(dev, startTime, stopTime);
-        MSEdgeVector::iterator edge = myEdges.begin();
-        for (std::vector<std::vector<MeanDataValues*> >::const_iterator i = myMeasures.begin(); i != myMeasures.end(); ++i, ++edge) {
-            writeEdge(dev, (*i), *edge, startTime, stopTime);
+        if (!myDumpEmpty && !myTrackVehicles && !MSGlobals::gUseMesoSim) {
+            // only edges which collected data can produce records; sort to
+            //  keep the output in network edge order
+            std::sort(myDirtyEdges.begin(), myDirtyEdges.end());
+            for (std::vector<int>::const_iterator i = myDirtyEdges.begin(); i != myDirtyEdges.end(); ++i) {
+                writeEdge(dev, myMeasures[*i], myEdges[*i], startTime, stopTime);
+            }
+        } else {
+            MSEdgeVector::iterator edge = myEdges.begin();
+            for (std::vector<std::vector<MeanDataValues*> >::const_iterator i = myMeasures.begin(); i != myMeasures.end(); ++i, ++edge) {
+                writeEdge(dev, (*i), *edge, startTime, stopTime);
+            }
         }
         dev.closeTag();
     }
+    clearDirty();
 }
 
 
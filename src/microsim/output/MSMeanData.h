@@ -166,10 +166,28 @@ public:
             return travelledDistance;
         }
 
+        /** @brief Sets the position of this collector within the parent's edge list
+         *
+         * @param[in] index The index of the edge in the parent's container
+         */
+        void setWriteIndex(const int index) {
+            myWriteIndex = index;
+        }
+
     protected:
+        /** @brief Marks the edge of this collector as active in the parent
+         *
+         * Must be called whenever data is collected so that output and reset
+         *  only need to visit edges which actually saw traffic.
+         */
+        void setDirty();
+
         /// @brief The meandata parent
         const MSMeanData* const myParent;
 
+        /// @brief The index of this collector's edge in the parent's container (-1 if untracked)
+        int myWriteIndex;
+
         /// @brief The length of the lane / edge the data collector is on
         const double myLaneLength;
 
@@ -356,6 +374,11 @@ public:
      */
     virtual void detectorUpdate(const SUMOTime step);
 
+    /** @brief Discards the values gathered in the current interval
+     * @see MSDetectorFileOutput::reset
+     */
+    void reset();
+
     double getMinSamples() const {
         return myMinSamples;
     }
@@ -423,6 +446,24 @@ protected:
     virtual bool writePrefix(OutputDevice& dev, const MeanDataValues& values,
                              const SumoXMLTag tag, const std::string id) const;
 
+    /** @brief Marks an edge as having collected data in the current interval
+     *
+     * Called by the value collectors (via MeanDataValues::setDirty) so that
+     *  writeXMLOutput and resetOnly only need to visit edges which actually
+     *  saw traffic instead of sweeping the whole network.
+     *
+     * @param[in] writeIndex The index of the edge in myEdges / myMeasures
+     */
+    void markDirty(const int writeIndex) const {
+        if (!myEdgeDirty[writeIndex]) {
+            myEdgeDirty[writeIndex] = true;
+            myDirtyEdges.push_back(writeIndex);
+        }
+    }
+
+    /// @brief Resets the dirty markers of all edges
+    void clearDirty() const;
+
 protected:
     /// @brief the minimum sample seconds
     const double myMinSamples;
@@ -446,6 +487,12 @@ private:
     /// @brief The corresponding first edges
     MSEdgeVector myEdges;
 
+    /// @brief Whether the edge at the same index in myEdges collected data in the current interval
+    mutable std::vector<bool> myEdgeDirty;
+
+    /// @brief The indices of the edges which collected data in the current interval
+    mutable std::vector<int> myDirtyEdges;
+
     /// @brief Whether empty lanes/edges shall be written
     const bool myPrintDefaults;
 
@@ -99,6 +99,7 @@ MSMeanData_Amitran::MSLaneMeanDataValues::notifyEnter(SUMOVehicle& veh, MSMoveRe
             if (reason == MSMoveReminder::NOTIFICATION_DEPARTED || reason == MSMoveReminder::NOTIFICATION_JUNCTION) {
                 ++amount;
                 typedAmount[&veh.getVehicleType()]++;
+                setDirty();
             }
         }
         return true;
@@ -38,6 +38,15 @@
 #include "MSMeanData_Emissions.h"
 #include <utils/emissions/PollutantsInterface.h>
 #include <limits>
+#include <map>
+
+
+// ===========================================================================
+// static members
+// ===========================================================================
+// emission amounts of an idling vehicle, cached per emission class
+//  (in a jam most vehicles share this state and the model lookup is costly)
+static std::map<SUMOEmissionClass, PollutantsInterface::Emissions> gIdleEmissions;
 
 
 // ===========================================================================
@@ -79,9 +88,19 @@ MSMeanData_Emissions::MSLaneMeanDataValues::notifyMoveInternal(const SUMOVehicle
     sampleSeconds += timeOnLane;
     travelledDistance += travelledDistanceVehicleOnLane;
     const double a = veh.getAcceleration();
-    myEmissions.addScaled(PollutantsInterface::computeAll(veh.getVehicleType().getEmissionClass(),
-                          // XXX: recheck, which value to use here for the speed. (Leo) Refs. #2579
-                          meanSpeedVehicleOnLane, a, veh.getSlope()), timeOnLane);
+    const double slope = veh.getSlope();
+    const SUMOEmissionClass c = veh.getVehicleType().getEmissionClass();
+    if (meanSpeedVehicleOnLane == 0. && a == 0. && slope == 0.) {
+        std::map<SUMOEmissionClass, PollutantsInterface::Emissions>::iterator it = gIdleEmissions.find(c);
+        if (it == gIdleEmissions.end()) {
+            it = gIdleEmissions.insert(std::make_pair(c, PollutantsInterface::computeAll(c, 0., 0., 0.))).first;
+        }
+        myEmissions.addScaled((*it).second, timeOnLane);
+    } else {
+        myEmissions.addScaled(PollutantsInterface::computeAll(c,
+                              // XXX: recheck, which value to use here for the speed. (Leo) Refs. #2579
+                              meanSpeedVehicleOnLane, a, slope), timeOnLane);
+    }
 }
 
 
@@ -187,6 +187,7 @@ MSMeanData_Net::MSLaneMeanDataValues::notifyLeave(SUMOVehicle& veh, double /*las
                 ++nVehVaporized;
             }
         }
+        setDirty();
     }
     if (MSGlobals::gUseMesoSim) {
         return false;
@@ -211,6 +212,7 @@ MSMeanData_Net::MSLaneMeanDataValues::notifyEnter(SUMOVehicle& veh, MSMoveRemind
             } else if (myParent == 0 || reason != MSMoveReminder::NOTIFICATION_SEGMENT) {
                 ++nVehEntered;
             }
+            setDirty();
         }
         return true;
     }
@@ -47,8 +47,9 @@
 // method definitions
 // ===========================================================================
 MSRouteProbe::MSRouteProbe(const std::string& id, const MSEdge* edge, const std::string& distID, const std::string& lastID,
-                           const std::string& vTypes) :
-    MSDetectorFileOutput(id, vTypes), MSMoveReminder(id) {
+                           const std::string& vTypes, int maxRoutes) :
+    MSDetectorFileOutput(id, vTypes), MSMoveReminder(id),
+    myMaxRoutes(maxRoutes), myTotalObserved(0) {
     myCurrentRouteDistribution = std::make_pair(distID, MSRoute::distDictionary(distID));
     if (myCurrentRouteDistribution.second == 0) {
         myCurrentRouteDistribution.second = new RandomDistributor<const MSRoute*>();
@@ -70,13 +71,46 @@ MSRouteProbe::MSRouteProbe(const std::string& id, const MSEdge* edge, const std:
 
 
 MSRouteProbe::~MSRouteProbe() {
+    for (std::map<const MSRoute*, SketchEntry>::const_iterator i = mySketch.begin(); i != mySketch.end(); ++i) {
+        i->first->release();
+    }
 }
 
 
 bool
 MSRouteProbe::notifyEnter(SUMOVehicle& veh, MSMoveReminder::Notification reason, const MSLane* /* enteredLane */) {
     if (reason != MSMoveReminder::NOTIFICATION_SEGMENT && reason != MSMoveReminder::NOTIFICATION_LANE_CHANGE) {
-        if (myCurrentRouteDistribution.second->add(&veh.getRoute(), 1.)) {
+        if (myMaxRoutes > 0) {
+            // sketch mode: keep at most myMaxRoutes counters (space-saving)
+            myTotalObserved += 1.;
+            const MSRoute* const route = &veh.getRoute();
+            std::map<const MSRoute*, SketchEntry>::iterator it = mySketch.find(route);
+            if (it != mySketch.end()) {
+                it->second.count += 1.;
+            } else if ((int)mySketch.size() < myMaxRoutes) {
+                SketchEntry entry;
+                entry.count = 1.;
+                entry.error = 0.;
+                mySketch[route] = entry;
+                route->addReference();
+            } else {
+                // evict the entry with the smallest count; the new route
+                // inherits that count as its overestimation bound
+                std::map<const MSRoute*, SketchEntry>::iterator minIt = mySketch.begin();
+                for (it = mySketch.begin(); it != mySketch.end(); ++it) {
+                    if (it->second.count < minIt->second.count) {
+                        minIt = it;
+                    }
+                }
+                SketchEntry entry;
+                entry.count = minIt->second.count + 1.;
+                entry.error = minIt->second.count;
+                minIt->first->release();
+                mySketch.erase(minIt);
+                mySketch[route] = entry;
+                route->addReference();
+            }
+        } else if (myCurrentRouteDistribution.second->add(&veh.getRoute(), 1.)) {
             veh.getRoute().addReference();
         }
     }
@@ -87,8 +121,26 @@ MSRouteProbe::notifyEnter(SUMOVehicle& veh, MSMoveReminder::Notification reason,
 void
 MSRouteProbe::writeXMLOutput(OutputDevice& dev,
                              SUMOTime startTime, SUMOTime stopTime) {
+    double otherMass = 0;
+    if (myMaxRoutes > 0) {
+        // fold the guaranteed sketch counts into the distribution, the
+        // overestimation bounds form the unattributed "other" mass
+        for (std::map<const MSRoute*, SketchEntry>::const_iterator i = mySketch.begin(); i != mySketch.end(); ++i) {
+            const double guaranteed = i->second.count - i->second.error;
+            if (guaranteed > 0 && myCurrentRouteDistribution.second->add(i->first, guaranteed)) {
+                i->first->addReference();
+            }
+            otherMass += i->second.error;
+            i->first->release();
+        }
+        mySketch.clear();
+        myTotalObserved = 0;
+    }
     if (myCurrentRouteDistribution.second->getOverallProb() > 0) {
         dev.openTag("routeDistribution") << " id=\"" << getID() + "_" + time2string(startTime) << "\"";
+        if (otherMass > 0) {
+            dev << " other=\"" << otherMass << "\"";
+        }
         const std::vector<const MSRoute*>& routes = myCurrentRouteDistribution.second->getVals();
         const std::vector<double>& probs = myCurrentRouteDistribution.second->getProbs();
         for (int j = 0; j < (int)routes.size(); ++j) {
@@ -32,6 +32,7 @@
 #endif
 
 #include <string>
+#include <map>
 #include <microsim/output/MSDetectorFileOutput.h>
 #include <microsim/MSMoveReminder.h>
 #include <utils/distribution/RandomDistributor.h>
@@ -72,10 +73,15 @@ public:
      * @param[in] edge The edge where the distribution shall be estimated
      * @param[in] distID The id of the distribution to add values to
      * @param[in] lastID The id of the last completed distribution to use for getRoute
+     * @param[in] maxRoutes The maximum number of routes to track (0 means unlimited)
+     *
+     * If maxRoutes is positive, the probe estimates the route distribution
+     *  with a space-saving sketch of that capacity instead of collecting
+     *  every distinct route, bounding its memory regardless of the flow.
      */
     MSRouteProbe(const std::string& id, const MSEdge* edge,
                  const std::string& distID, const std::string& lastID,
-                 const std::string& vTypes);
+                 const std::string& vTypes, int maxRoutes);
 
 
     /// @brief Destructor
@@ -133,12 +139,33 @@ public:
     const MSRoute* getRoute() const;
 
 private:
+    /** @brief Entry of the space-saving sketch
+     *
+     * The error denotes by how much the count may overestimate the true
+     *  number of observations (the count the entry inherited on eviction).
+     */
+    struct SketchEntry {
+        /// @brief The (possibly overestimated) number of observations
+        double count;
+        /// @brief The overestimation bound
+        double error;
+    };
+
     /// @brief The previous distribution of routes (probability->route)
     std::pair<std::string, RandomDistributor<const MSRoute*>*> myLastRouteDistribution;
 
     /// @brief The current distribution of routes (probability->route)
     std::pair<std::string, RandomDistributor<const MSRoute*>*> myCurrentRouteDistribution;
 
+    /// @brief The maximum number of routes to track (0 means unlimited)
+    const int myMaxRoutes;
+
+    /// @brief The space-saving sketch over the routes observed in the current interval
+    std::map<const MSRoute*, SketchEntry> mySketch;
+
+    /// @brief The total number of observations in the current interval (sketch mode)
+    double myTotalObserved;
+
 
 private:
     /// @brief Invalidated copy constructor.
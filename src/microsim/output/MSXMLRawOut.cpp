@@ -31,6 +31,7 @@
 #include <config.h>
 #endif
 
+#include <cmath>
 #include <utils/geom/GeomHelper.h>
 #include <microsim/MSEdgeControl.h>
 #include <microsim/MSEdge.h>
@@ -47,12 +48,25 @@
 #include <mesosim/MESegment.h>
 
 
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+std::map<std::string, MSXMLRawOut::VehicleState> MSXMLRawOut::myLastStates;
+SUMOTime MSXMLRawOut::myLastKeyframe(-1);
+
+
 // ===========================================================================
 // method definitions
 // ===========================================================================
 void
 MSXMLRawOut::write(OutputDevice& of, const MSEdgeControl& ec,
-                   SUMOTime timestep, int precision) {
+                   SUMOTime timestep, int precision,
+                   bool delta, SUMOTime keyframePeriod) {
+    if (delta && myLastKeyframe >= 0
+            && (keyframePeriod <= 0 || timestep < myLastKeyframe + keyframePeriod)) {
+        writeDelta(of, ec, timestep, precision);
+        return;
+    }
     of.openTag("timestep") << " time=\"" << time2string(timestep) << "\"";
     of.setPrecision(precision);
     const MSEdgeVector& edges = ec.getEdges();
@@ -61,6 +75,10 @@ MSXMLRawOut::write(OutputDevice& of, const MSEdgeControl& ec,
     }
     of.setPrecision(gPrecision);
     of.closeTag();
+    if (delta) {
+        myLastKeyframe = timestep;
+        updateDeltaState(ec, precision);
+    }
 }
 
 
@@ -175,6 +193,80 @@ MSXMLRawOut::writeVehicle(OutputDevice& of, const MSBaseVehicle& veh) {
 }
 
 
+void
+MSXMLRawOut::writeDelta(OutputDevice& of, const MSEdgeControl& ec,
+                        SUMOTime timestep, int precision) {
+    of.openTag("timestep") << " time=\"" << time2string(timestep) << "\" type=\"delta\"";
+    of.setPrecision(precision);
+    const double quantum = pow(10., -precision);
+    std::map<std::string, VehicleState> current;
+    const MSEdgeVector& edges = ec.getEdges();
+    for (MSEdgeVector::const_iterator e = edges.begin(); e != edges.end(); ++e) {
+        const std::vector<MSLane*>& lanes = (*e)->getLanes();
+        for (std::vector<MSLane*>::const_iterator lane = lanes.begin(); lane != lanes.end(); ++lane) {
+            std::vector<MSVehicle*> vehs((*lane)->myVehBuffer.begin(), (*lane)->myVehBuffer.end());
+            vehs.insert(vehs.end(), (*lane)->myVehicles.begin(), (*lane)->myVehicles.end());
+            for (std::vector<MSVehicle*>::const_iterator veh = vehs.begin(); veh != vehs.end(); ++veh) {
+                if (!(*veh)->isOnRoad()) {
+                    continue;
+                }
+                VehicleState state;
+                state.lane = *lane;
+                state.pos = floor((*veh)->getPositionOnLane() / quantum + 0.5) * quantum;
+                state.speed = floor((*veh)->getSpeed() / quantum + 0.5) * quantum;
+                const std::map<std::string, VehicleState>::const_iterator last = myLastStates.find((*veh)->getID());
+                if (last == myLastStates.end() || last->second.lane != state.lane
+                        || last->second.pos != state.pos || last->second.speed != state.speed) {
+                    of.openTag(SUMO_TAG_VEHICLE);
+                    of.writeAttr(SUMO_ATTR_ID, (*veh)->getID());
+                    of.writeAttr(SUMO_ATTR_LANE, (*lane)->getID());
+                    of.writeAttr(SUMO_ATTR_POSITION, (*veh)->getPositionOnLane());
+                    of.writeAttr(SUMO_ATTR_SPEED, (*veh)->getSpeed());
+                    of.closeTag();
+                }
+                current[(*veh)->getID()] = state;
+            }
+        }
+    }
+    // vehicles which are no longer in the network
+    for (std::map<std::string, VehicleState>::const_iterator it = myLastStates.begin(); it != myLastStates.end(); ++it) {
+        if (current.find(it->first) == current.end()) {
+            of.openTag(SUMO_TAG_DELETE);
+            of.writeAttr(SUMO_ATTR_ID, it->first);
+            of.closeTag();
+        }
+    }
+    myLastStates.swap(current);
+    of.setPrecision(gPrecision);
+    of.closeTag();
+}
+
+
+void
+MSXMLRawOut::updateDeltaState(const MSEdgeControl& ec, int precision) {
+    const double quantum = pow(10., -precision);
+    myLastStates.clear();
+    const MSEdgeVector& edges = ec.getEdges();
+    for (MSEdgeVector::const_iterator e = edges.begin(); e != edges.end(); ++e) {
+        const std::vector<MSLane*>& lanes = (*e)->getLanes();
+        for (std::vector<MSLane*>::const_iterator lane = lanes.begin(); lane != lanes.end(); ++lane) {
+            std::vector<MSVehicle*> vehs((*lane)->myVehBuffer.begin(), (*lane)->myVehBuffer.end());
+            vehs.insert(vehs.end(), (*lane)->myVehicles.begin(), (*lane)->myVehicles.end());
+            for (std::vector<MSVehicle*>::const_iterator veh = vehs.begin(); veh != vehs.end(); ++veh) {
+                if (!(*veh)->isOnRoad()) {
+                    continue;
+                }
+                VehicleState state;
+                state.lane = *lane;
+                state.pos = floor((*veh)->getPositionOnLane() / quantum + 0.5) * quantum;
+                state.speed = floor((*veh)->getSpeed() / quantum + 0.5) * quantum;
+                myLastStates[(*veh)->getID()] = state;
+            }
+        }
+    }
+}
+
+
 void
 MSXMLRawOut::writeTransportable(OutputDevice& of, const MSTransportable* p, SumoXMLTag tag) {
     of.openTag(tag);
@@ -33,6 +33,8 @@
 #include <config.h>
 #endif
 
+#include <map>
+#include <string>
 #include <utils/common/SUMOTime.h>
 
 
@@ -63,16 +65,21 @@ public:
     /** @brief Writes the complete network state of the given edges into the given device
      *
      * Opens the current time step, goes through the edges and writes each using
-     *  writeEdge.
+     *  writeEdge. In delta mode only vehicles which changed their lane or their
+     *  quantized position or speed are written and complete states (keyframes)
+     *  are only written with the given period.
      *
      * @param[in] of The output device to use
      * @param[in] ec The EdgeControl which holds the edges to write
      * @param[in] timestep The current time step
      * @param[in] precision The output precision
+     * @param[in] delta Whether only changed vehicles shall be written
+     * @param[in] keyframePeriod The period for writing complete states in delta mode
      * @exception IOError If an error on writing occurs (!!! not yet implemented)
      */
     static void write(OutputDevice& of, const MSEdgeControl& ec,
-                      SUMOTime timestep, int precision);
+                      SUMOTime timestep, int precision,
+                      bool delta = false, SUMOTime keyframePeriod = 0);
 
 
     /** @brief Writes the dump of the given vehicle into the given device
@@ -112,6 +119,36 @@ private:
     /// @brief write transportable
     static void writeTransportable(OutputDevice& of, const MSTransportable* p, SumoXMLTag tag);
 
+    /** @brief Writes only the vehicles which changed since the previous step
+     *
+     * Vehicles which left the network since the previous step are written as
+     *  delete elements. The recorded states are updated as a side effect.
+     *
+     * @param[in] of The output device to use
+     * @param[in] ec The EdgeControl which holds the edges to write
+     * @param[in] timestep The current time step
+     * @param[in] precision The output precision (also used for quantizing the comparison)
+     */
+    static void writeDelta(OutputDevice& of, const MSEdgeControl& ec,
+                           SUMOTime timestep, int precision);
+
+    /// @brief Records the current vehicle states as the baseline for the next delta
+    static void updateDeltaState(const MSEdgeControl& ec, int precision);
+
+private:
+    /// @brief A vehicle state at the time of the last write (delta mode)
+    struct VehicleState {
+        const MSLane* lane;
+        double pos;
+        double speed;
+    };
+
+    /// @brief The vehicle states written last (delta mode)
+    static std::map<std::string, VehicleState> myLastStates;
+
+    /// @brief The time of the last keyframe in delta mode (-1 means none was written)
+    static SUMOTime myLastKeyframe;
+
 private:
     /// @brief Invalidated copy constructor.
     MSXMLRawOut(const MSXMLRawOut&);
@@ -48,10 +48,10 @@ PedestrianState* MSPModel_Remote::add(MSPerson* person, MSPerson::MSPersonStage_
 
     PState* state = new PState(person, stage);
 
-    hybridsim::Agent req;
+    hybridsim::Agent* req = myAgentsToTransfer.add_agents();
     int id = myLastId++;
     remoteIdPStateMapping[id] = state;
-    req.set_id(id);
+    req->set_id(id);
 
     MSLane* departureLane = getFirstPedestrianLane(*(stage->getRoute().begin()));
     double departureOffsetAlongLane = stage->getDepartPos();
@@ -61,14 +61,14 @@ PedestrianState* MSPModel_Remote::add(MSPerson* person, MSPerson::MSPersonStage_
     departureOffsetAlongLane += offset;
 
     Position departurePos = departureLane->getShape().positionAtOffset(departureOffsetAlongLane);
-    hybridsim::Coordinate* departureCoordinate = req.mutable_enterlocation();
+    hybridsim::Coordinate* departureCoordinate = req->mutable_enterlocation();
     departureCoordinate->set_x(departurePos.x());
     departureCoordinate->set_y(departurePos.y());
 
     MSLane* arrivalLane = getFirstPedestrianLane(*(stage->getRoute().end() - 1));
     double arrivalOffsetAlongLange = stage->getArrivalPos();
     Position arrivalPos = arrivalLane->getShape().positionAtOffset(arrivalOffsetAlongLange);
-    hybridsim::Coordinate* arrivalCoordinate = req.mutable_leavelocation();
+    hybridsim::Coordinate* arrivalCoordinate = req->mutable_leavelocation();
     arrivalCoordinate->set_x(arrivalPos.x());
     arrivalCoordinate->set_y(arrivalPos.y());
 
@@ -96,24 +96,15 @@ PedestrianState* MSPModel_Remote::add(MSPerson* person, MSPerson::MSPersonStage_
 
         int frId = dir == FORWARD ? std::get<0>(transitions) : std::get<1>(transitions);
         int toId = dir == FORWARD ? std::get<1>(transitions) : std::get<0>(transitions);
-        hybridsim::Destination* destFr = req.add_dests();
+        hybridsim::Destination* destFr = req->add_dests();
         destFr->set_id(frId);
-        hybridsim::Destination* destTo = req.add_dests();
+        hybridsim::Destination* destTo = req->add_dests();
         destTo->set_id(toId);
         prv = edge;
     }
 
-    hybridsim::Boolean rpl;
-    ClientContext context;
-    Status st = myHybridsimStub->transferAgent(&context, req, &rpl);
-    if (!st.ok()) {
-        ProcessError("Person: " + person->getID() + " could not be transferred to remote simulation");
-    }
-    if (!rpl.val()) {
-        //TODO not yet implemented
-        ProcessError("Remote simulation declined to accept person: " + person->getID() + ".");
-    }
-
+    // the agent is transferred together with all other agents departing in
+    // this step in one batched call at the beginning of execute()
     return state;
 }
 
@@ -132,6 +123,21 @@ MSPModel_Remote::~MSPModel_Remote() {
 
 SUMOTime MSPModel_Remote::execute(SUMOTime time) {
 
+    //0. transfer all agents that started their walk since the last step
+    if (myAgentsToTransfer.agents_size() > 0) {
+        hybridsim::Boolean rpl0;
+        ClientContext context0;
+        Status st0 = myHybridsimStub->transferAgents(&context0, myAgentsToTransfer, &rpl0);
+        if (!st0.ok()) {
+            ProcessError("Could not transfer " + toString(myAgentsToTransfer.agents_size()) + " agents to remote simulation");
+        }
+        if (!rpl0.val()) {
+            //TODO not yet implemented
+            ProcessError("Remote simulation declined to accept the transferred persons.");
+        }
+        myAgentsToTransfer.clear_agents();
+    }
+
     hybridsim::LeftClosedRightOpenTimeInterval interval;
     interval.set_fromtimeincluding(time / DELTA_T);
     interval.set_totimeexcluding((time + DELTA_T) / DELTA_T);
@@ -93,6 +93,8 @@ private:
     std::map<int, const MSEdge*> transitionsEdgesMapping;
     int myLastId = 0;
     int myLastTransitionId = 0;
+    // agents that started their walk since the last step, transferred in one batch
+    hybridsim::Agents myAgentsToTransfer;
 
 
     MSLane* getFirstPedestrianLane(const MSEdge* const& edge);
@@ -550,35 +550,34 @@ MSPModel_Striping::getNextWalkingArea(const MSLane* currentLane, const int dir,
 
 
 MSPModel_Striping::Obstacles
-MSPModel_Striping::getNeighboringObstacles(const Pedestrians& pedestrians, int egoIndex, int stripes) {
+MSPModel_Striping::getNeighboringObstacles(const Pedestrians& pedestrians, int egoIndex, int stripes, const std::vector<int>& nextObstacle) {
     const PState& ego = *pedestrians[egoIndex];
     Obstacles obs(stripes, Obstacle(ego.myDir));
     std::vector<bool> haveBlocker(stripes, false);
-    for (int index = egoIndex + 1; index < (int)pedestrians.size(); index++) {
+    for (int index = nextObstacle[egoIndex + 1]; index < (int)pedestrians.size(); index = nextObstacle[index + 1]) {
         const PState& p = *pedestrians[index];
+        assert(!p.myWaitingToEnter);
         if DEBUGCOND(ego) {
             std::cout << SIMTIME << " ped=" << ego.myPerson->getID() << "  checking neighbor " << p.myPerson->getID();
         }
-        if (!p.myWaitingToEnter) {
-            const Obstacle o(p);
-            if DEBUGCOND(ego) {
-                std::cout << " dist=" << ego.distanceTo(o) << std::endl;
-            }
-            if (ego.distanceTo(o) == DIST_BEHIND) {
-                break;
-            }
-            if (ego.distanceTo(o) == DIST_OVERLAP) {
-                obs[p.stripe()] = o;
-                obs[p.otherStripe()] = o;
-                haveBlocker[p.stripe()] = true;
-                haveBlocker[p.otherStripe()] = true;
-            }
-            if (!haveBlocker[p.stripe()]) {
-                obs[p.stripe()] = o;
-            }
-            if (!haveBlocker[p.otherStripe()]) {
-                obs[p.otherStripe()] = o;
-            }
+        const Obstacle o(p);
+        if DEBUGCOND(ego) {
+            std::cout << " dist=" << ego.distanceTo(o) << std::endl;
+        }
+        if (ego.distanceTo(o) == DIST_BEHIND) {
+            break;
+        }
+        if (ego.distanceTo(o) == DIST_OVERLAP) {
+            obs[p.stripe()] = o;
+            obs[p.otherStripe()] = o;
+            haveBlocker[p.stripe()] = true;
+            haveBlocker[p.otherStripe()] = true;
+        }
+        if (!haveBlocker[p.stripe()]) {
+            obs[p.stripe()] = o;
+        }
+        if (!haveBlocker[p.otherStripe()]) {
+            obs[p.otherStripe()] = o;
         }
     }
     if DEBUGCOND(ego) {
@@ -835,6 +834,14 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
     Obstacles obs(stripes, Obstacle(dir)); // continously updated
     NextLanesObstacles nextLanesObs; // continously updated
     sort(pedestrians.begin(), pedestrians.end(), by_xpos_sorter(dir));
+    // index of the next pedestrian (in sort order) that can act as an obstacle.
+    // Without this table every neighbor scan would have to step over all
+    // myWaitingToEnter pedestrians individually which is quadratic in crowds
+    // where most pedestrians are still waiting
+    std::vector<int> nextObstacle(pedestrians.size() + 1, (int)pedestrians.size());
+    for (int i = (int)pedestrians.size() - 1; i >= 0; i--) {
+        nextObstacle[i] = pedestrians[i]->myWaitingToEnter ? nextObstacle[i + 1] : i;
+    }
 
     Obstacles crossingVehs(stripes, Obstacle(dir));
     bool hasCrossingVehObs = false;
@@ -886,7 +893,7 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
             std::cout << SIMTIME << " ped=" << p.myPerson->getID() << "  obsWithNext=";
             DEBUG_PRINT(currentObs);
         }
-        p.mergeObstacles(currentObs, getNeighboringObstacles(pedestrians, ii, stripes));
+        p.mergeObstacles(currentObs, getNeighboringObstacles(pedestrians, ii, stripes, nextObstacle));
         if DEBUGCOND(p) {
             std::cout << SIMTIME << " ped=" << p.myPerson->getID() << "  obsWithNeigh=";
             DEBUG_PRINT(currentObs);
@@ -424,7 +424,7 @@ private:
     /// @brief return the maximum number of pedestrians walking side by side
     static int numStripes(const MSLane* lane);
 
-    static Obstacles getNeighboringObstacles(const Pedestrians& pedestrians, int egoIndex, int stripes);
+    static Obstacles getNeighboringObstacles(const Pedestrians& pedestrians, int egoIndex, int stripes, const std::vector<int>& nextObstacle);
 
     const Obstacles& getNextLaneObstacles(NextLanesObstacles& nextLanesObs, const MSLane* lane, const MSLane* nextLane, int stripes,
                                           int nextDir, double currentLength, int currentDir);
@@ -31,6 +31,7 @@
 #include <config.h>
 #endif
 
+#include <algorithm>
 #include <cassert>
 #include <utility>
 #include <vector>
@@ -110,6 +111,31 @@ MSActuatedTrafficLightLogic::init(NLDetectorBuilder& nb) {
             maxDetectorGap = MAX2(maxDetectorGap, length - ilpos);
         }
     }
+    // collect the induct loops the gap control of each phase has to check so
+    //  that trySwitch does not have to walk the state string and the lane map
+    //  on every decision
+    myInductLoopsForPhase.clear();
+    for (int step = 0; step < (int)myPhases.size(); step++) {
+        std::vector<MSInductLoop*> loops;
+        if (myPhases[step]->isGreenPhase()) {
+            const std::string& state = myPhases[step]->getState();
+            for (int pos = 0; pos < (int)state.size(); pos++) {
+                if (state[pos] == LINKSTATE_TL_GREEN_MAJOR || state[pos] == LINKSTATE_TL_GREEN_MINOR) {
+                    const LaneVector& lanes = getLanesAt(pos);
+                    for (i = lanes.begin(); i != lanes.end(); i++) {
+                        InductLoopMap::const_iterator it = myInductLoops.find(*i);
+                        if (it != myInductLoops.end()) {
+                            MSInductLoop* loop = static_cast<MSInductLoop*>(it->second);
+                            if (std::find(loops.begin(), loops.end(), loop) == loops.end()) {
+                                loops.push_back(loop);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        myInductLoopsForPhase.push_back(loops);
+    }
     // warn if the minGap is insufficient to clear vehicles between stop line and detector
     SUMOTime minMinDur = getMinimumMinDuration();
     if (floor(floor(maxDetectorGap / DEFAULT_LENGTH_WITH_GAP) * myPassingTime) > STEPS2TIME(minMinDur)) {
@@ -190,21 +216,14 @@ MSActuatedTrafficLightLogic::gapControl() {
     }
 
     // now the gapcontrol starts
-    const std::string& state = getCurrentPhaseDef().getState();
-    for (int i = 0; i < (int) state.size(); i++)  {
-        if (state[i] == LINKSTATE_TL_GREEN_MAJOR || state[i] == LINKSTATE_TL_GREEN_MINOR) {
-            const std::vector<MSLane*>& lanes = getLanesAt(i);
-            for (LaneVector::const_iterator j = lanes.begin(); j != lanes.end(); j++) {
-                if (myInductLoops.find(*j) == myInductLoops.end()) {
-                    continue;
-                }
-                if (!MSGlobals::gUseMesoSim) { // why not check outside the loop? (Leo)
-                    const double actualGap = static_cast<MSInductLoop*>(myInductLoops.find(*j)->second)->getTimeSinceLastDetection();
-                    if (actualGap < myMaxGap) {
-                        result = MIN2(result, actualGap);
-                    }
-                }
-            }
+    if (MSGlobals::gUseMesoSim) {
+        return result;
+    }
+    const std::vector<MSInductLoop*>& loops = myInductLoopsForPhase[myStep];
+    for (std::vector<MSInductLoop*>::const_iterator j = loops.begin(); j != loops.end(); ++j) {
+        const double actualGap = (*j)->getTimeSinceLastDetection();
+        if (actualGap < myMaxGap) {
+            result = MIN2(result, actualGap);
         }
     }
     return result;
@@ -123,6 +123,9 @@ protected:
     /// A map from lanes to induct loops lying on them
     InductLoopMap myInductLoops;
 
+    /// The induct loops relevant for gap control of each green phase (by phase index)
+    std::vector<std::vector<MSInductLoop*> > myInductLoopsForPhase;
+
     /// The maximum gap to check in seconds
     double myMaxGap;
 
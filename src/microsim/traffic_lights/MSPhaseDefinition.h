@@ -40,6 +40,7 @@
 #endif
 
 #include <bitset>
+#include <set>
 #include <string>
 #include <vector>
 #include <utils/common/MsgHandler.h>
@@ -89,8 +90,8 @@ public:
     SUMOTime myLastSwitch;
 
 private:
-    /// @brief The phase definition
-    std::string state;
+    /// @brief The phase definition (points into the shared state pool)
+    const std::string* state;
 
     /*
     * The type of this phase
@@ -107,12 +108,23 @@ private:
      */
     LaneIdVector targetLaneSet;
 
+    /** @brief Returns the pooled instance of the given state
+     *
+     * Large networks contain thousands of logics sharing few distinct states
+     * (identical junction layouts, repeated states within one cycle), so all
+     * phase definitions point into a single shared table.
+     */
+    static const std::string* intern(const std::string& stateArg) {
+        static std::set<std::string> pool;
+        return &*pool.insert(stateArg).first;
+    }
+
     void init(SUMOTime durationArg, SUMOTime minDurationArg, SUMOTime maxDurationArg, const std::string& stateArg) {
         this->duration = durationArg;
         this->minDuration = minDurationArg < 0 ? durationArg : minDurationArg;
         this->maxDuration = (maxDurationArg < 0 || maxDurationArg < minDurationArg) ? durationArg : maxDurationArg;
         // assert(this->minDuration <= this->maxDuration); // not ensured by the previous lines
-        this->state = stateArg;
+        this->state = intern(stateArg);
         this->myLastSwitch = string2time(OptionsCont::getOptions().getString("begin")); // SUMOTime-option
         //For SOTL phases
         //this->phaseType = phaseTypeArg;
@@ -245,7 +257,7 @@ public:
      * @return The state in this phase
      */
     const std::string& getState() const {
-        return state;
+        return *state;
     }
 
     const LaneIdVector& getTargetLaneSet() const throw() {
@@ -260,10 +272,10 @@ public:
      * @return Whether this phase is a "pure green" phase
      */
     bool isGreenPhase() const {
-        if (state.find_first_of("gG") == std::string::npos) {
+        if (state->find_first_of("gG") == std::string::npos) {
             return false;
         }
-        if (state.find_first_of("yY") != std::string::npos) {
+        if (state->find_first_of("yY") != std::string::npos) {
             return false;
         }
         return true;
@@ -275,7 +287,7 @@ public:
      * @return The state of the signal at the given position
      */
     LinkState getSignalState(int pos) const {
-        return (LinkState) state[pos];
+        return (LinkState)(*state)[pos];
     }
 
 
@@ -286,6 +298,7 @@ public:
      * @return Whether the given phase definition differs
      */
     bool operator!=(const MSPhaseDefinition& pd) {
+        // pooled states make pointer inequality equivalent to string inequality
         return state != pd.state;
     }
 
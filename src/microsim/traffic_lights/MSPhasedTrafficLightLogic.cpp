@@ -198,6 +198,13 @@ MSPhasedTrafficLightLogic::changeStepAndDuration(MSTLLogicControl& tlcontrol,
 }
 
 
+void
+MSPhasedTrafficLightLogic::resetToBegin(MSTLLogicControl& tlcontrol) {
+    myStep = 0;
+    MSTrafficLightLogic::resetToBegin(tlcontrol);
+}
+
+
 /****************************************************************************/
 void
 MSPhasedTrafficLightLogic::setPhases(const Phases& phases, int step) {
@@ -169,6 +169,11 @@ public:
      */
     void changeStepAndDuration(MSTLLogicControl& tlcontrol, SUMOTime simStep,
                                int step, SUMOTime stepDuration);
+
+    /** @brief Restarts the program at its first phase for a simulation rewound to its begin time
+     * @see MSTrafficLightLogic::resetToBegin
+     */
+    void resetToBegin(MSTLLogicControl& tlcontrol);
     /// @}
 
     /** @brief Replaces the phases and set the phase index
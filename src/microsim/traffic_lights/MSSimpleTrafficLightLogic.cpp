@@ -201,6 +201,13 @@ MSSimpleTrafficLightLogic::changeStepAndDuration(MSTLLogicControl& tlcontrol,
 }
 
 
+void
+MSSimpleTrafficLightLogic::resetToBegin(MSTLLogicControl& tlcontrol) {
+    myStep = 0;
+    MSTrafficLightLogic::resetToBegin(tlcontrol);
+}
+
+
 void
 MSSimpleTrafficLightLogic::setPhases(const Phases& phases, int step) {
     assert(step < (int)phases.size());
@@ -119,6 +119,7 @@ MSTLLogicControl::TLSLogicVariants::addLogic(const std::string& programID,
     // add to the list of logic
     myVariants[programID] = logic;
     if (myVariants.size() == 1 || isNewDefault) {
+        logic->invalidateAppliedState();
         logic->setTrafficLightSignals(MSNet::getInstance()->getCurrentTimeStep());
         executeOnSwitchActions();
     }
@@ -206,8 +207,15 @@ MSTLLogicControl::TLSLogicVariants::getActive() const {
 
 void
 MSTLLogicControl::TLSLogicVariants::switchTo(MSTLLogicControl& tlc, const std::string& programID) {
+    MSTrafficLightLogic* const logic = getLogicInstantiatingOff(tlc, programID);
+    if (logic == myCurrentProgram) {
+        // switching to the active program changes nothing
+        return;
+    }
     // set the found wished sub-program as this tls' current one
-    myCurrentProgram = getLogicInstantiatingOff(tlc, programID);
+    myCurrentProgram = logic;
+    // the links carry the states of the previous program
+    myCurrentProgram->invalidateAppliedState();
     myCurrentProgram->setTrafficLightSignals(MSNet::getInstance()->getCurrentTimeStep());
     executeOnSwitchActions();
 }
@@ -364,6 +364,15 @@ public:
     void check2Switch(SUMOTime step);
 
 
+    /** @brief Returns whether any WAUT switching procedure is in progress
+     *
+     * While one is running, check2Switch must be called in every step.
+     */
+    bool hasPendingSwitch() const {
+        return !myCurrentlySwitched.empty();
+    }
+
+
     /** @brief return the complete phase definition for a named traffic lights logic
      *
      * The phase definition will be the current of the currently active program of
@@ -109,7 +109,8 @@ MSTrafficLightLogic::MSTrafficLightLogic(MSTLLogicControl& tlcontrol, const std:
     Named(id), Parameterised(parameters),
     myProgramID(programID),
     myCurrentDurationIncrement(-1),
-    myDefaultCycleTime(0) {
+    myDefaultCycleTime(0),
+    myFirstSwitchTime(delay) {
     mySwitchCommand = new SwitchCommand(tlcontrol, this, delay);
     MSNet::getInstance()->getBeginOfTimestepEvents()->addEvent(mySwitchCommand, delay);
 }
@@ -176,6 +177,14 @@ MSTrafficLightLogic::~MSTrafficLightLogic() {
 }
 
 
+void
+MSTrafficLightLogic::resetToBegin(MSTLLogicControl& tlcontrol) {
+    mySwitchCommand->deschedule(this);
+    mySwitchCommand = new SwitchCommand(tlcontrol, this, myFirstSwitchTime);
+    MSNet::getInstance()->getBeginOfTimestepEvents()->addEvent(mySwitchCommand, myFirstSwitchTime);
+}
+
+
 // ----------- Handling of controlled links
 void
 MSTrafficLightLogic::addLink(MSLink* link, MSLane* lane, int pos) {
@@ -219,14 +228,19 @@ bool
 MSTrafficLightLogic::setTrafficLightSignals(SUMOTime t) const {
     // get the current traffic light signal combination
     const std::string& state = getCurrentPhaseDef().getState();
-    // go through the links
+    // go through the links, touching only the signal groups whose state changed
+    //  since the last application (none of them on quiet steps)
     for (int i = 0; i < (int)myLinks.size(); i++) {
-        const LinkVector& currGroup = myLinks[i];
         LinkState ls = (LinkState) state[i];
+        if (i < (int)myLastStateApplied.size() && (LinkState) myLastStateApplied[i] == ls) {
+            continue;
+        }
+        const LinkVector& currGroup = myLinks[i];
         for (LinkVector::const_iterator j = currGroup.begin(); j != currGroup.end(); j++) {
             (*j)->setTLState(ls, t);
         }
     }
+    myLastStateApplied = state;
     return true;
 }
 
@@ -240,6 +254,7 @@ MSTrafficLightLogic::resetLinkStates(const std::map<MSLink*, LinkState>& vals) c
             (*i2)->setTLState(vals.find(*i2)->second, MSNet::getInstance()->getCurrentTimeStep());
         }
     }
+    invalidateAppliedState();
 }
 
 
@@ -159,6 +159,17 @@ public:
      * @see MSLink::setTLState
      */
     bool setTrafficLightSignals(SUMOTime t) const;
+
+
+    /** @brief Discards the record of the last applied state
+     *
+     * Must be called whenever the controlled links may have been set by
+     *  another program (i.e. on program switches) so that the next call to
+     *  setTrafficLightSignals touches all links again
+     */
+    void invalidateAppliedState() const {
+        myLastStateApplied.clear();
+    }
     /// @}
 
 
@@ -334,6 +345,17 @@ public:
     virtual void changeStepAndDuration(MSTLLogicControl& tlcontrol,
                                        SUMOTime simStep, int step, SUMOTime stepDuration) = 0;
 
+
+    /** @brief Restarts the program for a simulation rewound to its begin time
+     *
+     * The pending switch command is descheduled (it stays as an inert entry
+     *  in the event control until its old execution time comes around
+     *  again) and a fresh one is scheduled at the first switch time given
+     *  on construction. Subclasses with a phase index also rewind it.
+     * @param[in] tlcontrol The responsible traffic lights control
+     */
+    virtual void resetToBegin(MSTLLogicControl& tlcontrol);
+
     /// @}
 
 
@@ -419,9 +441,15 @@ protected:
     /// @brief The current switch command
     SwitchCommand* mySwitchCommand;
 
+    /// @brief The state last applied to the links (empty if links may have foreign states)
+    mutable std::string myLastStateApplied;
+
     /// @brief The cycle time (without changes)
     SUMOTime myDefaultCycleTime;
 
+    /// @brief The time the first switch command was scheduled at (kept for resetToBegin)
+    SUMOTime myFirstSwitchTime;
+
     /// @brief An empty lane vector
     static const LaneVector myEmptyLaneVector;
 
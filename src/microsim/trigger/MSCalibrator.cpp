@@ -331,7 +331,10 @@ MSCalibrator::execute(SUMOTime currentTime) {
             // keep calibrator alive for gui but do not call again
             return TIME2STEPS(86400);
         }
-        return myFrequency;
+        // sleep until one period before the next interval begins instead of
+        //  polling; the extra wakeup keeps the collection window of the first
+        //  active call at one period as before
+        return MAX2(myFrequency, myCurrentStateInterval->begin - currentTime - myFrequency);
     }
     // we are active
     if (!myDidSpeedAdaption && myCurrentStateInterval->v >= 0) {
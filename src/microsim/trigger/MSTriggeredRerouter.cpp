@@ -81,7 +81,8 @@ MSTriggeredRerouter::MSTriggeredRerouter(const std::string& id,
     myProbability(prob),
     myUserProbability(prob),
     myAmInUserMode(false),
-    myTimeThreshold(timeThreshold) {
+    myTimeThreshold(timeThreshold),
+    myRouteCacheTime(-1) {
     // build actors
     for (MSEdgeVector::const_iterator j = edges.begin(); j != edges.end(); ++j) {
         if (MSGlobals::gUseMesoSim) {
@@ -470,11 +471,36 @@ MSTriggeredRerouter::notifyEnter(SUMOVehicle& veh, MSMoveReminder::Notification
     // we have a new destination, let's replace the vehicle route (if it is affected)
     if (rerouteDef->closed.size() == 0 || destUnreachable || veh.getRoute().containsAnyOf(rerouteDef->closed)) {
         ConstMSEdgeVector edges;
-        SUMOAbstractRouter<MSEdge, SUMOVehicle>& router = hasReroutingDevice
-                ? MSDevice_Routing::getRouterTT(rerouteDef->closed)
-                : MSNet::getInstance()->getRouterTT(rerouteDef->closed);
-        router.compute(
-            veh.getEdge(), newEdge, &veh, MSNet::getInstance()->getCurrentTimeStep(), edges);
+        // vehicles piling up at a closure often share origin, destination and
+        //  type; their routes are identical until the weights change, so the
+        //  result is shared within the step. Sharing is off when per-vehicle
+        //  weights exist or the weights are randomized per query.
+        const bool mayShare = !MSEdgeWeightsStorage::hasWeights()
+                              && OptionsCont::getOptions().getFloat("weights.random-factor") == 1.;
+        RouteCacheKey key;
+        key.def = rerouteDef;
+        key.origin = veh.getEdge();
+        key.dest = newEdge;
+        key.type = &veh.getVehicleType();
+        key.speedFactor = veh.getChosenSpeedFactor();
+        key.usesDevice = hasReroutingDevice;
+        if (time != myRouteCacheTime) {
+            myRouteCache.clear();
+            myRouteCacheTime = time;
+        }
+        std::map<RouteCacheKey, ConstMSEdgeVector>::const_iterator rc = mayShare ? myRouteCache.find(key) : myRouteCache.end();
+        if (rc != myRouteCache.end()) {
+            edges = (*rc).second;
+        } else {
+            SUMOAbstractRouter<MSEdge, SUMOVehicle>& router = hasReroutingDevice
+                    ? MSDevice_Routing::getRouterTT(rerouteDef->closed)
+                    : MSNet::getInstance()->getRouterTT(rerouteDef->closed);
+            router.compute(
+                veh.getEdge(), newEdge, &veh, MSNet::getInstance()->getCurrentTimeStep(), edges);
+            if (mayShare) {
+                myRouteCache[key] = edges;
+            }
+        }
         const bool useNewRoute = veh.replaceRouteEdges(edges);
 #ifdef DEBUG_REROUTER
         if (DEBUGCOND) std::cout << "   rerouting:  newEdge=" << newEdge->getID() << " useNewRoute=" << useNewRoute << " newArrivalPos=" << newArrivalPos << " numClosed=" << rerouteDef->closed.size()
@@ -34,6 +34,7 @@
 
 #include <string>
 #include <vector>
+#include <map>
 #include <utils/common/Command.h>
 #include <microsim/MSMoveReminder.h>
 #include "MSTrigger.h"
@@ -47,6 +48,7 @@
 class MSNet;
 class MSLane;
 class MSRoute;
+class MSVehicleType;
 class SUMOVehicle;
 
 
@@ -240,6 +242,47 @@ protected:
     //@}
 
 
+    /// @brief Key of a shareable rerouting result
+    struct RouteCacheKey {
+        /// @brief The matched rerouting interval (determines the closed edges)
+        const RerouteInterval* def;
+        /// @brief The edge the vehicle is on
+        const MSEdge* origin;
+        /// @brief The new destination
+        const MSEdge* dest;
+        /// @brief The vehicle type (determines permissions and maximum speed)
+        const MSVehicleType* type;
+        /// @brief The vehicle's chosen speed factor
+        double speedFactor;
+        /// @brief Whether the rerouting device's router computed the route
+        bool usesDevice;
+
+        bool operator<(const RouteCacheKey& o) const {
+            if (def != o.def) {
+                return def < o.def;
+            }
+            if (origin != o.origin) {
+                return origin < o.origin;
+            }
+            if (dest != o.dest) {
+                return dest < o.dest;
+            }
+            if (type != o.type) {
+                return type < o.type;
+            }
+            if (speedFactor != o.speedFactor) {
+                return speedFactor < o.speedFactor;
+            }
+            return usesDevice < o.usesDevice;
+        }
+    };
+
+    /// @brief Routes computed in the current step, shared by vehicles with equal keys
+    std::map<RouteCacheKey, ConstMSEdgeVector> myRouteCache;
+
+    /// @brief The time step myRouteCache belongs to (weights change between steps)
+    SUMOTime myRouteCacheTime;
+
     /// @brief special destination values
     static MSEdge mySpecialDest_keepDestination;
     static MSEdge mySpecialDest_terminateRoute;
@@ -847,6 +847,12 @@ NBEdge::reduceGeometry(const double minDist) {
 }
 
 
+void
+NBEdge::simplifyGeometry(const double maxError) {
+    myGeom = myGeom.simplified(maxError);
+}
+
+
 void
 NBEdge::checkGeometry(const double maxAngle, const double minRadius, bool fix) {
     if (myGeom.size() < 3) {
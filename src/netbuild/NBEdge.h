@@ -697,6 +697,11 @@ public:
      */
     void reduceGeometry(const double minDist);
 
+    /** @brief Removes geometry points which displace the shape by no more than the given error (Douglas-Peucker)
+     * @param[in] maxError The maximum lateral error introduced by removing a point
+     */
+    void simplifyGeometry(const double maxError);
+
     /** @brief Check the angles of successive geometry segments
      * @param[in] maxAngle The maximum angle allowed
      * @param[in] minRadius The minimum turning radius allowed at the start and end
@@ -39,6 +39,7 @@
 #include <utils/geom/GeomHelper.h>
 #include <utils/geom/GeoConvHelper.h>
 #include <utils/common/MsgHandler.h>
+#include <utils/common/StdDefs.h>
 #include <utils/common/ToString.h>
 #include <utils/common/TplConvert.h>
 #include <utils/common/IDSupplier.h>
@@ -54,6 +55,34 @@
 #include "NBTrafficLightLogicCont.h"
 #include "NBDistrictCont.h"
 #include "NBTypeCont.h"
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+
+
+// ===========================================================================
+// helper class definitions
+// ===========================================================================
+/// @brief computes the shape of a batch of edges on a worker thread
+class EdgeShapeTask : public FXWorkerThread::Task {
+public:
+    EdgeShapeTask(const std::vector<NBEdge*>& edges) :
+        myTaskEdges(edges) {}
+
+    void run(FXWorkerThread* /* context */) {
+        for (NBEdge* const edge : myTaskEdges) {
+            edge->computeEdgeShape();
+        }
+    }
+
+private:
+    /// @brief The edges to process
+    const std::vector<NBEdge*>& myTaskEdges;
+
+private:
+    /// @brief Invalidated assignment operator.
+    EdgeShapeTask& operator=(const EdgeShapeTask&);
+};
+#endif
 
 
 // ===========================================================================
@@ -593,6 +622,19 @@ NBEdgeCont::reduceGeometries(const double minDist) {
 }
 
 
+void
+NBEdgeCont::simplifyGeometries(const double maxError) {
+    int before = 0;
+    int after = 0;
+    for (EdgeCont::iterator i = myEdges.begin(); i != myEdges.end(); ++i) {
+        before += (int)(*i).second->getGeometry().size();
+        (*i).second->simplifyGeometry(maxError);
+        after += (int)(*i).second->getGeometry().size();
+    }
+    WRITE_MESSAGE("Removed " + toString(before - after) + " of " + toString(before) + " geometry points.");
+}
+
+
 void
 NBEdgeCont::checkGeometries(const double maxAngle, const double minRadius, bool fix) {
     if (maxAngle > 0 || minRadius > 0) {
@@ -693,7 +735,26 @@ NBEdgeCont::appendTurnarounds(const std::set<std::string>& ids, bool noTLSContro
 
 
 void
-NBEdgeCont::computeEdgeShapes() {
+NBEdgeCont::computeEdgeShapes(int numThreads) {
+#ifdef HAVE_FOX
+    if (numThreads > 1) {
+        // every edge only writes its own geometry (the node shapes were
+        //  computed before) so the edges can be distributed freely
+        std::vector<std::vector<NBEdge*> > batches(numThreads);
+        int index = 0;
+        for (EdgeCont::iterator i = myEdges.begin(); i != myEdges.end(); i++) {
+            batches[index++ % numThreads].push_back((*i).second);
+        }
+        FXWorkerThread::Pool pool(numThreads);
+        for (const std::vector<NBEdge*>& batch : batches) {
+            pool.add(new EdgeShapeTask(batch));
+        }
+        pool.waitAll();
+        return;
+    }
+#else
+    UNUSED_PARAMETER(numThreads);
+#endif
     for (EdgeCont::iterator i = myEdges.begin(); i != myEdges.end(); i++) {
         (*i).second->computeEdgeShape();
     }
@@ -329,6 +329,13 @@ public:
     void reduceGeometries(const double minDist);
 
 
+    /** @brief Simplifies the edge geometries and reports the point-count reduction
+     * @param[in] maxError The maximum lateral error introduced by the simplification
+     * @see NBEdge::simplifyGeometry
+     */
+    void simplifyGeometries(const double maxError);
+
+
     /** @brief
      * @param[in] maxAngle The maximum geometry angle allowed
      * @param[in] minRadius The minimum turning radius allowed at the start and end
@@ -410,9 +417,10 @@ public:
      *
      * @todo Recheck whether a visitor-pattern should be used herefor
      * @todo Recheck usage
+     * @param[in] numThreads The number of worker threads to use (needs FOX, every edge only writes its own geometry)
      * @see NBEdge::computeEdgeShape
      */
-    void computeEdgeShapes();
+    void computeEdgeShapes(int numThreads = 1);
 
 
     /** @brief Computes the shapes of all lanes of all edges stored in the container
@@ -93,6 +93,9 @@ NBFrame::fillOptions(bool forNetgen) {
     oc.doRegister("numerical-ids", new Option_Bool(false));
     oc.addDescription("numerical-ids", "Processing", "Remaps alphanumerical IDs of nodes and edges to ensure that all IDs are integers");
 
+    oc.doRegister("threads", new Option_Integer(1));
+    oc.addDescription("threads", "Processing", "The number of threads for computing node and edge shapes");
+
     /// @todo not working for netgen
     oc.doRegister("reserved-ids", new Option_FileName());
     oc.addDescription("reserved-ids", "Processing", "Ensures that generated ids do not included any of the typed IDs from FILE (SUMO-GUI selection file format)");
@@ -134,6 +137,9 @@ NBFrame::fillOptions(bool forNetgen) {
         oc.doRegister("geometry.min-dist", new Option_Float(-1));
         oc.addDescription("geometry.min-dist", "Processing", "reduces too similar geometry points");
 
+        oc.doRegister("geometry.simplify", new Option_Float(-1));
+        oc.addDescription("geometry.simplify", "Processing", "Simplify edge geometries (Douglas-Peucker) so that no point is displaced by more than FLOAT m");
+
         oc.doRegister("geometry.max-angle", new Option_Float(99));
         oc.addDescription("geometry.max-angle", "Processing", "Warn about edge geometries with an angle above DEGREES in successive segments");
 
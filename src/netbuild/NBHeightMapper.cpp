@@ -96,19 +96,19 @@ NBHeightMapper::getZ(const Position& geo) const {
             const int xSize = int((myBoundary.xmax() - myBoundary.xmin()) / mySizeOfPixel.x() + .5);
             const double normX = (geo.x() - myBoundary.xmin()) / mySizeOfPixel.x();
             const double normY = (geo.y() - myBoundary.ymax()) / mySizeOfPixel.y();
-            PositionVector corners;
-            corners.push_back(Position(floor(normX) + 0.5, floor(normY) + 0.5, myRaster[(int)normY * xSize + (int)normX]));
-            if (normX - floor(normX) > 0.5) {
-                corners.push_back(Position(floor(normX) + 1.5, floor(normY) + 0.5, myRaster[(int)normY * xSize + (int)normX + 1]));
-            } else {
-                corners.push_back(Position(floor(normX) - 0.5, floor(normY) + 0.5, myRaster[(int)normY * xSize + (int)normX - 1]));
-            }
-            if (normY - floor(normY) > 0.5) {
-                corners.push_back(Position(floor(normX) + 0.5, floor(normY) + 1.5, myRaster[((int)normY + 1) * xSize + (int)normX]));
-            } else {
-                corners.push_back(Position(floor(normX) + 0.5, floor(normY) - 0.5, myRaster[((int)normY - 1) * xSize + (int)normX]));
-            }
-            result = Triangle(corners).getZ(Position(normX, normY));
+            const int fullX = (int)normX;
+            const int fullY = (int)normY;
+            // interpolate on the plane through the center of the hit pixel and
+            //  the centers of the two nearest neighbor pixels (no need to
+            //  instantiate a Triangle for every queried position)
+            const double xOff = normX - floor(normX) > 0.5 ? 1. : -1.;
+            const double yOff = normY - floor(normY) > 0.5 ? 1. : -1.;
+            const double z0 = myRaster[fullY * xSize + fullX];
+            const double zX = myRaster[fullY * xSize + fullX + (int)xOff];
+            const double zY = myRaster[(fullY + (int)yOff) * xSize + fullX];
+            result = z0
+                     + (zX - z0) * xOff * (normX - floor(normX) - 0.5)
+                     + (zY - z0) * yOff * (normY - floor(normY) - 0.5);
         }
         if (result > -1e5 && result < 1e5) {
             return result;
@@ -123,11 +123,11 @@ NBHeightMapper::getZ(const Position& geo) const {
     maxB[1] = (float)geo.y() + 0.00001f;
     QueryResult queryResult;
     int hits = myRTree.Search(minB, maxB, queryResult);
-    Triangles result = queryResult.triangles;
+    const Triangles& result = queryResult.triangles;
     assert(hits == (int)result.size());
     UNUSED_PARAMETER(hits); // only used for assertion
 
-    for (Triangles::iterator it = result.begin(); it != result.end(); it++) {
+    for (Triangles::const_iterator it = result.begin(); it != result.end(); it++) {
         const Triangle* triangle = *it;
         if (triangle->contains(geo)) {
             return triangle->getZ(geo);
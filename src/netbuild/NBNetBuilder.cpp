@@ -47,12 +47,36 @@
 #include <utils/common/UtilExceptions.h>
 #include <utils/common/StringTokenizer.h>
 #include <utils/common/SUMOVehicleClass.h>
+#include <utils/common/StdDefs.h>
 #include <utils/common/SysUtils.h>
 #include <utils/common/ToString.h>
 #include <utils/geom/GeoConvHelper.h>
 #include "NBAlgorithms.h"
 #include "NBAlgorithms_Ramps.h"
 #include "NBHeightMapper.h"
+#ifdef HAVE_FOX
+#include <fx.h>
+#include <utils/common/AbstractMutex.h>
+
+
+// ===========================================================================
+// helper class definitions
+// ===========================================================================
+/// @brief makes the message output thread safe while shapes are computed in parallel
+class NBMessageLock : public AbstractMutex {
+public:
+    void lock() {
+        myMutex.lock();
+    }
+
+    void unlock() {
+        myMutex.unlock();
+    }
+
+private:
+    FXMutex myMutex;
+};
+#endif
 
 
 // ===========================================================================
@@ -68,6 +92,25 @@ NBNetBuilder::NBNetBuilder() :
 NBNetBuilder::~NBNetBuilder() {}
 
 
+int
+NBNetBuilder::getNumThreads(const OptionsCont& oc) {
+#ifdef HAVE_FOX
+    const int numThreads = oc.exists("threads") ? MAX2(1, oc.getInt("threads")) : 1;
+    if (numThreads > 1) {
+        // the parallel computations may emit warnings concurrently
+        static NBMessageLock messageLock;
+        MsgHandler::assignLock(&messageLock);
+    }
+    return numThreads;
+#else
+    if (oc.exists("threads") && oc.getInt("threads") > 1) {
+        WRITE_WARNING("Multi-threaded processing requires the FOX toolkit. Using a single thread.");
+    }
+    return 1;
+#endif
+}
+
+
 void
 NBNetBuilder::applyOptions(OptionsCont& oc) {
     // apply options to type control
@@ -84,6 +127,8 @@ void
 NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurnarounds, bool mayAddOrRemove) {
     GeoConvHelper& geoConvHelper = GeoConvHelper::getProcessing();
 
+    const int numThreads = getNumThreads(oc);
+
     const bool lefthand = oc.getBool("lefthand");
     if (lefthand) {
         mirrorX();
@@ -158,8 +203,8 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
         NBTurningDirectionsComputer::computeTurnDirections(myNodeCont, false);
         NBNodesEdgesSorter::sortNodesEdges(myNodeCont);
         myEdgeCont.computeLaneShapes();
-        myNodeCont.computeNodeShapes();
-        myEdgeCont.computeEdgeShapes();
+        myNodeCont.computeNodeShapes(-1, numThreads);
+        myEdgeCont.computeEdgeShapes(numThreads);
         if (oc.getBool("roundabouts.guess")) {
             myEdgeCont.guessRoundabouts();
         }
@@ -227,6 +272,12 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
         myEdgeCont.reduceGeometries(oc.getFloat("geometry.min-dist"));
         PROGRESS_TIME_MESSAGE(before);
     }
+    if (oc.exists("geometry.simplify") && oc.getFloat("geometry.simplify") >= 0) {
+        before = SysUtils::getCurrentMillis();
+        PROGRESS_BEGIN_MESSAGE("Simplifying geometries");
+        myEdgeCont.simplifyGeometries(oc.getFloat("geometry.simplify"));
+        PROGRESS_TIME_MESSAGE(before);
+    }
     // @note: removing geometry can create similar edges so joinSimilarEdges  must come afterwards
     // @note: likewise splitting can destroy similarities so joinSimilarEdges must come before
     if (mayAddOrRemove &&  oc.getBool("edges.join")) {
@@ -302,15 +353,15 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     before = SysUtils::getCurrentMillis();
     PROGRESS_BEGIN_MESSAGE("Computing node shapes");
     if (oc.exists("geometry.junction-mismatch-threshold")) {
-        myNodeCont.computeNodeShapes(oc.getFloat("geometry.junction-mismatch-threshold"));
+        myNodeCont.computeNodeShapes(oc.getFloat("geometry.junction-mismatch-threshold"), numThreads);
     } else {
-        myNodeCont.computeNodeShapes();
+        myNodeCont.computeNodeShapes(-1, numThreads);
     }
     PROGRESS_TIME_MESSAGE(before);
     //
     before = SysUtils::getCurrentMillis();
     PROGRESS_BEGIN_MESSAGE("Computing edge shapes");
-    myEdgeCont.computeEdgeShapes();
+    myEdgeCont.computeEdgeShapes(numThreads);
     PROGRESS_TIME_MESSAGE(before);
     // resort edges based on the node and edge shapes
     NBNodesEdgesSorter::sortNodesEdges(myNodeCont, true);
@@ -394,7 +445,7 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     //
     before = SysUtils::getCurrentMillis();
     PROGRESS_BEGIN_MESSAGE("Dividing of lanes on approached lanes");
-    myNodeCont.computeLanes2Lanes();
+    myNodeCont.computeLanes2Lanes(numThreads);
     myEdgeCont.sortOutgoingLanesConnections();
     PROGRESS_TIME_MESSAGE(before);
     //
@@ -496,8 +547,8 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
         before = SysUtils::getCurrentMillis();
         PROGRESS_BEGIN_MESSAGE("stretching junctions to smooth geometries");
         myEdgeCont.computeLaneShapes();
-        myNodeCont.computeNodeShapes();
-        myEdgeCont.computeEdgeShapes();
+        myNodeCont.computeNodeShapes(-1, numThreads);
+        myEdgeCont.computeEdgeShapes(numThreads);
         for (std::map<std::string, NBNode*>::const_iterator i = myNodeCont.begin(); i != myNodeCont.end(); ++i) {
             (*i).second->buildInnerEdges();
         }
@@ -549,16 +600,71 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
 }
 
 
-/*
 void
-NBNetBuilder::computeSingleNode(NBNode* node, OptionsCont& oc, const std::set<std::string>& explicitTurnarounds, bool mayAddOrRemove) {
-    // for a single node do the following:
-    // sortEdges
-    // computeLaneShapes
-    // computeNodeShapes
-    // computeEdgeShapes
+NBNetBuilder::computeSingleNode(NBNode* node, OptionsCont& oc, const std::set<std::string>& explicitTurnarounds) {
+    // shapes, connections, right-of-way and tls logic of a node only depend
+    //  on the node itself and its incident edges; the according steps of
+    //  compute() are applied to this neighborhood only
+    const EdgeVector& incoming = node->getIncomingEdges();
+    const EdgeVector& outgoing = node->getOutgoingEdges();
+    EdgeVector incident(incoming);
+    incident.insert(incident.end(), outgoing.begin(), outgoing.end());
+    // GEOMETRY COMPUTATION
+    node->sortEdges(false);
+    for (EdgeVector::iterator it = incident.begin(); it != incident.end(); ++it) {
+        (*it)->computeLaneShapes();
+    }
+    node->computeNodeShape(oc.exists("geometry.junction-mismatch-threshold") ? oc.getFloat("geometry.junction-mismatch-threshold") : -1);
+    for (EdgeVector::iterator it = incident.begin(); it != incident.end(); ++it) {
+        // the shapes of the neighboring nodes are still valid
+        (*it)->computeEdgeShape();
+    }
+    // resort edges based on the node and edge shapes
+    node->sortEdges(true);
+    NBTurningDirectionsComputer::computeTurnDirectionsForNode(node, false);
+    // CONNECTIONS COMPUTATION
+    NBNodeTypeComputer::computeSingleNodeType(node);
+    NBEdgePriorityComputer::computeEdgePrioritiesSingleNode(node);
+    for (EdgeVector::const_iterator it = incoming.begin(); it != incoming.end(); ++it) {
+        if ((*it)->getStep() != NBEdge::LANES2LANES_USER) {
+            // connections which were loaded or set by the user are kept
+            (*it)->invalidateConnections(true);
+            (*it)->computeEdge2Edges(oc.getBool("no-left-connections"));
+            (*it)->computeLanes2Edges();
+        }
+    }
+    node->computeLanes2Lanes();
+    for (EdgeVector::const_iterator it = incoming.begin(); it != incoming.end(); ++it) {
+        (*it)->sortOutgoingConnectionsByAngle();
+        if (!oc.getBool("no-turnarounds")) {
+            (*it)->appendTurnaround(oc.getBool("no-turnarounds.tls"), true);
+        } else if (explicitTurnarounds.count((*it)->getID()) > 0) {
+            (*it)->appendTurnaround(oc.getBool("no-turnarounds.tls"), false);
+        }
+        (*it)->recheckLanes();
+    }
+    if ((oc.getBool("walkingareas") || node->getCrossingsIncludingInvalid().size() > 0)
+            && !oc.getBool("no-internal-links")) {
+        node->buildCrossingsAndWalkingAreas();
+    }
+    // COMPUTING RIGHT-OF-WAY AND TRAFFIC LIGHT PROGRAMS
+    const std::set<NBTrafficLightDefinition*>& tls = node->getControllingTLS();
+    for (std::set<NBTrafficLightDefinition*>::const_iterator it = tls.begin(); it != tls.end(); ++it) {
+        (*it)->setParticipantsInformation();
+        (*it)->setTLControllingInformation();
+    }
+    node->computeLogic(myEdgeCont, oc);
+    for (std::set<NBTrafficLightDefinition*>::const_iterator it = tls.begin(); it != tls.end(); ++it) {
+        myTLLCont.computeSingleLogic(oc, *it);
+    }
+    for (EdgeVector::const_iterator it = incoming.begin(); it != incoming.end(); ++it) {
+        (*it)->sortOutgoingConnectionsByIndex();
+    }
+    // FINISHING INNER EDGES
+    if (!oc.getBool("no-internal-links")) {
+        node->buildInnerEdges();
+    }
 }
-*/
 
 
 void
@@ -141,14 +141,26 @@ public:
      */
     void compute(OptionsCont& oc, const std::set<std::string>& explicitTurnarounds = std::set<std::string>(), bool mayAddOrRemove = true);
 
-    /** @brief Updates the shape for a single Node
+    /** @brief Returns the number of threads to use for building the network
      *
+     * If more than one thread shall be used, the message output is made
+     *  thread safe as a side effect.
      * @param[in] oc Container that contains options for building
-     * @param[in] explicitTurnarounds List of edge ids for which turn-arounds should be added (used by NETEDIT)
-     * @param[in] mayAddOrRemove whether processing steps which cause nodes and edges to be added or removed shall be triggered (used by netedit)
-     * @exception ProcessError (recheck)
+     * @return The value of the "threads" option (1 when built without the FOX toolkit)
+     */
+    static int getNumThreads(const OptionsCont& oc);
+
+    /** @brief Performs the network building steps for a single node and its incident edges
+     *
+     * Shapes, connections, right-of-way and tls logic only depend on the
+     *  node's local neighborhood, so they can be recomputed without
+     *  reprocessing the whole network. Connections which were loaded or set
+     *  by the user are kept.
+     * @param[in] node The node to recompute
+     * @param[in] oc Container that contains options for building
+     * @param[in] explicitTurnarounds List of edge ids for which turn-arounds should be added
      */
-    //void computeSingleNode(NBNode* node, OptionsCont& oc, const std::set<std::string>& explicitTurnarounds = std::set<std::string>(), bool mayAddOrRemove = true);
+    void computeSingleNode(NBNode* node, OptionsCont& oc, const std::set<std::string>& explicitTurnarounds = std::set<std::string>());
 
     /// @name Retrieval of subcontainers
     /// @{
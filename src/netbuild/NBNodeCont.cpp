@@ -58,6 +58,59 @@
 #include "NBNodeCont.h"
 #include "NBPTStopCont.h"
 #include "NBPTLineCont.h"
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+
+
+// ===========================================================================
+// helper class definitions
+// ===========================================================================
+/// @brief computes the shape of a batch of nodes on a worker thread
+class NodeShapeTask : public FXWorkerThread::Task {
+public:
+    NodeShapeTask(const std::vector<NBNode*>& nodes, double mismatchThreshold) :
+        myTaskNodes(nodes), myMismatchThreshold(mismatchThreshold) {}
+
+    void run(FXWorkerThread* /* context */) {
+        for (NBNode* const node : myTaskNodes) {
+            node->computeNodeShape(myMismatchThreshold);
+        }
+    }
+
+private:
+    /// @brief The nodes to process
+    const std::vector<NBNode*>& myTaskNodes;
+
+    /// @brief The warning threshold for shapes which are away from the node position
+    const double myMismatchThreshold;
+
+private:
+    /// @brief Invalidated assignment operator.
+    NodeShapeTask& operator=(const NodeShapeTask&);
+};
+
+
+/// @brief computes the lane-to-lane connections for a batch of nodes on a worker thread
+class Lanes2LanesTask : public FXWorkerThread::Task {
+public:
+    Lanes2LanesTask(const std::vector<NBNode*>& nodes) :
+        myTaskNodes(nodes) {}
+
+    void run(FXWorkerThread* /* context */) {
+        for (NBNode* const node : myTaskNodes) {
+            node->computeLanes2Lanes();
+        }
+    }
+
+private:
+    /// @brief The nodes to process
+    const std::vector<NBNode*>& myTaskNodes;
+
+private:
+    /// @brief Invalidated assignment operator.
+    Lanes2LanesTask& operator=(const Lanes2LanesTask&);
+};
+#endif
 #include "NBParking.h"
 
 
@@ -1135,7 +1188,27 @@ NBNodeCont::setAsTLControlled(NBNode* node, NBTrafficLightLogicCont& tlc,
 
 // -----------
 void
-NBNodeCont::computeLanes2Lanes() {
+NBNodeCont::computeLanes2Lanes(int numThreads) {
+#ifdef HAVE_FOX
+    if (numThreads > 1) {
+        // every node only assigns connections to its own incoming edges and
+        //  each edge is incoming to exactly one node, so the nodes can be
+        //  distributed freely among the workers
+        std::vector<std::vector<NBNode*> > batches(numThreads);
+        int index = 0;
+        for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
+            batches[index++ % numThreads].push_back((*i).second);
+        }
+        FXWorkerThread::Pool pool(numThreads);
+        for (const std::vector<NBNode*>& batch : batches) {
+            pool.add(new Lanes2LanesTask(batch));
+        }
+        pool.waitAll();
+        return;
+    }
+#else
+    UNUSED_PARAMETER(numThreads);
+#endif
     for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
         (*i).second->computeLanes2Lanes();
     }
@@ -1179,7 +1252,26 @@ NBNodeCont::getFreeID() {
 
 
 void
-NBNodeCont::computeNodeShapes(double mismatchThreshold) {
+NBNodeCont::computeNodeShapes(double mismatchThreshold, int numThreads) {
+#ifdef HAVE_FOX
+    if (numThreads > 1) {
+        // every node only writes its own shape so the nodes can be
+        //  distributed freely among the workers
+        std::vector<std::vector<NBNode*> > batches(numThreads);
+        int index = 0;
+        for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
+            batches[index++ % numThreads].push_back((*i).second);
+        }
+        FXWorkerThread::Pool pool(numThreads);
+        for (const std::vector<NBNode*>& batch : batches) {
+            pool.add(new NodeShapeTask(batch, mismatchThreshold));
+        }
+        pool.waitAll();
+        return;
+    }
+#else
+    UNUSED_PARAMETER(numThreads);
+#endif
     for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
         (*i).second->computeNodeShape(mismatchThreshold);
     }
@@ -233,8 +233,10 @@ public:
     /// @brief Renames the node. Throws exception if newID already exists
     void rename(NBNode* node, const std::string& newID);
 
-    /// divides the incoming lanes on outgoing lanes
-    void computeLanes2Lanes();
+    /** @brief divides the incoming lanes on outgoing lanes
+     * @param[in] numThreads The number of worker threads to use (needs FOX, every node only writes its own incoming edges)
+     */
+    void computeLanes2Lanes(int numThreads = 1);
 
     /// build the list of outgoing edges and lanes
     void computeLogics(const NBEdgeCont& ec, OptionsCont& oc);
@@ -252,8 +254,9 @@ public:
 
     /** @brief Compute the junction shape for this node
      * @param[in] mismatchThreshold The threshold for warning about shapes which are away from myPosition
+     * @param[in] numThreads The number of worker threads to use (needs FOX, every node only writes its own shape)
      */
-    void computeNodeShapes(double mismatchThreshold = -1);
+    void computeNodeShapes(double mismatchThreshold = -1, int numThreads = 1);
 
     /** @brief Prints statistics about built nodes
      *
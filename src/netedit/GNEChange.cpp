@@ -50,7 +50,7 @@ GNEChange::~GNEChange() {}
 
 FXuint
 GNEChange::size() const {
-    return 1;
+    return sizeof(GNEChange);
 }
 
 
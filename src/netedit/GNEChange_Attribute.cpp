@@ -42,18 +42,41 @@
 // ===========================================================================
 FXIMPLEMENT_ABSTRACT(GNEChange_Attribute, GNEChange, NULL, 0)
 
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+std::map<std::string, int> GNEChange_Attribute::myValuePool;
+
 // ===========================================================================
 // member method definitions
 // ===========================================================================
 
+const std::string*
+GNEChange_Attribute::ref(const std::string& value) {
+    std::map<std::string, int>::iterator it = myValuePool.insert(std::make_pair(value, 0)).first;
+    it->second++;
+    return &it->first;
+}
+
+
+void
+GNEChange_Attribute::unref(const std::string* value) {
+    std::map<std::string, int>::iterator it = myValuePool.find(*value);
+    assert(it != myValuePool.end());
+    if (--it->second == 0) {
+        myValuePool.erase(it);
+    }
+}
+
+
 GNEChange_Attribute::GNEChange_Attribute(GNEAttributeCarrier* ac,
         SumoXMLAttr key, const std::string& value,
         bool customOrigValue, const std::string& origValue) :
     GNEChange(0, true),
     myAC(ac),
     myKey(key),
-    myOrigValue(customOrigValue ? origValue : ac->getAttribute(key)),
-    myNewValue(value),
+    myOrigValue(ref(customOrigValue ? origValue : ac->getAttribute(key))),
+    myNewValue(ref(value)),
     myAdditional(NULL),
     myShape(NULL) {
     myAC->incRef("GNEChange_Attribute " + toString(myKey));
@@ -65,6 +88,8 @@ GNEChange_Attribute::GNEChange_Attribute(GNEAttributeCarrier* ac,
 
 GNEChange_Attribute::~GNEChange_Attribute() {
     assert(myAC);
+    unref(myOrigValue);
+    unref(myNewValue);
     myAC->decRef("GNEChange_Attribute " + toString(myKey));
     if (myAC->unreferenced()) {
         // show extra information for tests
@@ -90,10 +115,10 @@ void
 GNEChange_Attribute::undo() {
     // show extra information for tests
     if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
-        WRITE_WARNING("Setting previous attribute " + toString(myKey) + " '" + myOrigValue + "' into " + toString(myAC->getTag()) + " '" + myAC->getID() + "'");
+        WRITE_WARNING("Setting previous attribute " + toString(myKey) + " '" + *myOrigValue + "' into " + toString(myAC->getTag()) + " '" + myAC->getID() + "'");
     }
     // set original value
-    myAC->setAttribute(myKey, myOrigValue);
+    myAC->setAttribute(myKey, *myOrigValue);
     // check if additional or shapes has to be saved
     if (myAdditional) {
         myAdditional->getViewNet()->getNet()->requiereSaveAdditionals();
@@ -107,10 +132,10 @@ void
 GNEChange_Attribute::redo() {
     // show extra information for tests
     if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
-        WRITE_WARNING("Setting new attribute " + toString(myKey) + " '" + myNewValue + "' into " + toString(myAC->getTag()) + " '" + myAC->getID() + "'");
+        WRITE_WARNING("Setting new attribute " + toString(myKey) + " '" + *myNewValue + "' into " + toString(myAC->getTag()) + " '" + myAC->getID() + "'");
     }
     // set new value
-    myAC->setAttribute(myKey, myNewValue);
+    myAC->setAttribute(myKey, *myNewValue);
     // check if additional or shapes has to be saved
     if (myAdditional) {
         myAdditional->getViewNet()->getNet()->requiereSaveAdditionals();
@@ -122,10 +147,18 @@ GNEChange_Attribute::redo() {
 
 bool
 GNEChange_Attribute::trueChange() {
+    // pooled values make pointer inequality equivalent to string inequality
     return myOrigValue != myNewValue;
 }
 
 
+FXuint
+GNEChange_Attribute::size() const {
+    // the values live in the shared pool and are not attributed to single changes
+    return sizeof(GNEChange_Attribute);
+}
+
+
 FXString
 GNEChange_Attribute::undoName() const {
     return ("Undo change " + toString(myAC->getTag()) + " attribute").c_str();
@@ -30,6 +30,8 @@
 #endif
 
 #include <fx.h>
+#include <map>
+#include <string>
 #include <utils/foxtools/fxexdefs.h>
 #include <utils/xml/SUMOXMLDefinitions.h>
 #include "GNEChange.h"
@@ -86,6 +88,20 @@ public:
     /// @brief wether original and new value differ
     bool trueChange();
 
+    /// @brief return the actual size of this change in bytes
+    FXuint size() const;
+
+private:
+    /// @brief returns the pooled instance of the given value and increases its reference count
+    static const std::string* ref(const std::string& value);
+
+    /// @brief decreases the reference count of the given pooled value, dropping it at zero
+    static void unref(const std::string* value);
+
+    /// @brief reference-counted pool of attribute values
+    /// (bulk changes on large selections store each distinct value only once)
+    static std::map<std::string, int> myValuePool;
+
 private:
     /**@brief the net to which all operations shall be applied
      * @note we are not responsible for the pointer
@@ -95,11 +111,11 @@ private:
     /// @brief The attribute name
     SumoXMLAttr myKey;
 
-    /// @brief the original value
-    std::string myOrigValue;
+    /// @brief the original value (points into the shared value pool)
+    const std::string* myOrigValue;
 
-    /// @brief the original value
-    std::string myNewValue;
+    /// @brief the new value (points into the shared value pool)
+    const std::string* myNewValue;
 
     /// @brief used if Ac is an additional element
     GNEAdditional* myAdditional;
@@ -856,8 +856,10 @@ GNENet::checkJunctionPosition(const Position& pos) {
 
 void
 GNENet::save(OptionsCont& oc) {
-    // compute without volatile options and update network
-    computeAndUpdate(oc, false);
+    // compute without volatile options and update network (skipped if the network is unchanged since the last computation)
+    if (myNeedRecompute) {
+        computeAndUpdate(oc, false);
+    }
     // write network
     NWFrame::writeNetwork(oc, *myNetBuilder);
 }
@@ -865,16 +867,20 @@ GNENet::save(OptionsCont& oc) {
 
 void
 GNENet::savePlain(OptionsCont& oc) {
-    // compute without volatile options
-    computeAndUpdate(oc, false);
+    // compute without volatile options (skipped if the network is unchanged since the last computation)
+    if (myNeedRecompute) {
+        computeAndUpdate(oc, false);
+    }
     NWWriter_XML::writeNetwork(oc, *myNetBuilder);
 }
 
 
 void
 GNENet::saveJoined(OptionsCont& oc) {
-    // compute without volatile options
-    computeAndUpdate(oc, false);
+    // compute without volatile options (skipped if the network is unchanged since the last computation)
+    if (myNeedRecompute) {
+        computeAndUpdate(oc, false);
+    }
     NWWriter_XML::writeJoinedJunctions(oc, myNetBuilder->getNodeCont());
 }
 
@@ -1290,17 +1296,13 @@ GNENet::computeEverything(GNEApplicationWindow* window, bool force, bool volatil
 
 void
 GNENet::computeJunction(GNEJunction* junction) {
-    // recompute tl-logics
+    // recompute the local neighborhood of the junction (shape, connections,
+    // right-of-way and tl-logics); connections loaded from the network or
+    // set by the user are kept
     OptionsCont& oc = OptionsCont::getOptions();
-    NBTrafficLightLogicCont& tllCont = getTLLogicCont();
-    // iterate over traffic lights definitions
-    for (auto it : junction->getNBNode()->getControllingTLS()) {
-        it->setParticipantsInformation();
-        it->setTLControllingInformation();
-        tllCont.computeSingleLogic(oc, it);
-    }
-
-    // @todo compute connections etc...
+    myNetBuilder->computeSingleNode(junction->getNBNode(), oc);
+    junction->updateGeometry();
+    update();
 }
 
 
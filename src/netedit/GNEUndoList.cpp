@@ -36,6 +36,7 @@
 #include <iostream>
 #include <utils/common/UtilExceptions.h>
 #include <utils/common/MsgHandler.h>
+#include <utils/common/ToString.h>
 #include <utils/options/OptionsCont.h>
 
 #include "GNEUndoList.h"
@@ -91,6 +92,10 @@ void
 GNEUndoList::p_end() {
     myCommandGroups.pop();
     end();
+    if (myCommandGroups.empty()) {
+        // show the memory retained by the undo history in the status bar
+        myParent->setStatusBarText("Undo history: " + toString(size() / 1024) + " kB");
+    }
 }
 
 
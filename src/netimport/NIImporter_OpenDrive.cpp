@@ -34,10 +34,14 @@
 #include <iterator>
 #include <utils/xml/SUMOSAXHandler.h>
 #include <utils/common/UtilExceptions.h>
+#include <utils/common/StdDefs.h>
 #include <utils/common/TplConvert.h>
 #include <utils/common/ToString.h>
 #include <utils/common/StringUtils.h>
 #include <utils/common/MsgHandler.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 #include <utils/iodevices/OutputDevice.h>
 #include <netbuild/NBEdge.h>
 #include <netbuild/NBEdgeCont.h>
@@ -897,56 +901,181 @@ NIImporter_OpenDrive::setNodeSecure(NBNodeCont& nc, OpenDriveEdge& e,
 }
 
 
+/// @brief marks the points between first and last which are needed for staying within maxError (Douglas-Peucker)
+static void
+markEssentialPoints(const PositionVector& geom, int first, int last, double maxError, std::vector<bool>& keep) {
+    if (last - first < 2) {
+        return;
+    }
+    const Position& p1 = geom[first];
+    const Position& p2 = geom[last];
+    const double distIK = p1.distanceTo2D(p2);
+    double maxDist = -1;
+    int maxIndex = -1;
+    for (int i = first + 1; i < last; i++) {
+        const Position& p0 = geom[i];
+        // https://en.wikipedia.org/wiki/Distance_from_a_point_to_a_line#Line_defined_by_two_points
+        const double triangleArea2 = fabs((p2.y() - p1.y()) * p0.x() - (p2.x() - p1.x()) * p0.y() + p2.x() * p1.y() - p2.y() * p1.x());
+        const double dist = distIK > NUMERICAL_EPS ? triangleArea2 / distIK : p0.distanceTo2D(p1);
+        if (dist > maxDist) {
+            maxDist = dist;
+            maxIndex = i;
+        }
+    }
+    if (maxDist > maxError) {
+        keep[maxIndex] = true;
+        markEssentialPoints(geom, first, maxIndex, maxError, keep);
+        markEssentialPoints(geom, maxIndex, last, maxError, keep);
+    }
+}
+
+
+/// @brief removes sampled points which deviate less than maxError from the remaining shape
+static void
+pruneGeometry(PositionVector& geom, double maxError) {
+    if (geom.size() < 3) {
+        return;
+    }
+    std::vector<bool> keep(geom.size(), false);
+    keep.front() = true;
+    keep.back() = true;
+    markEssentialPoints(geom, 0, (int)geom.size() - 1, maxError, keep);
+    PositionVector pruned;
+    for (int i = 0; i < (int)geom.size(); i++) {
+        if (keep[i]) {
+            pruned.push_back(geom[i]);
+        }
+    }
+    geom = pruned;
+}
+
+
+#ifdef HAVE_FOX
+/**
+ * @class DiscretizeGeometriesTask
+ * @brief Discretizes the geometries of a batch of edges within a worker thread
+ */
+class DiscretizeGeometriesTask : public FXWorkerThread::Task {
+public:
+    /** @brief Constructor
+     * @param[in] edges The edges to process
+     * @param[in] resolution The sampling step for curved geometries
+     * @param[in] maxError The maximum lateral error when pruning sampled points or -1 for keeping all points
+     * @param[in] minDist The minimum distance between geometry points or -1 for keeping all points
+     */
+    DiscretizeGeometriesTask(const std::vector<NIImporter_OpenDrive::OpenDriveEdge*>& edges,
+                             const double resolution, const double maxError, const double minDist) :
+        myTaskEdges(edges), myResolution(resolution), myMaxError(maxError), myMinDist(minDist) {}
+
+    void run(FXWorkerThread* /* context */) {
+        for (std::vector<NIImporter_OpenDrive::OpenDriveEdge*>::const_iterator i = myTaskEdges.begin(); i != myTaskEdges.end(); ++i) {
+            NIImporter_OpenDrive::discretizeGeometries(**i, myResolution, myMaxError, myMinDist);
+        }
+    }
+
+private:
+    /// @brief The edges to process
+    const std::vector<NIImporter_OpenDrive::OpenDriveEdge*>& myTaskEdges;
+    /// @brief The sampling step for curved geometries
+    const double myResolution;
+    /// @brief The maximum lateral error when pruning sampled points
+    const double myMaxError;
+    /// @brief The minimum distance between geometry points
+    const double myMinDist;
+
+private:
+    /// @brief invalidated assignment operator
+    DiscretizeGeometriesTask& operator=(const DiscretizeGeometriesTask&);
+};
+#endif
+
+
+void
+NIImporter_OpenDrive::discretizeGeometries(OpenDriveEdge& e, double resolution, double maxError, double minDist) {
+    GeometryType prevType = OPENDRIVE_GT_UNKNOWN;
+    for (std::vector<OpenDriveGeometry>::iterator j = e.geometries.begin(); j != e.geometries.end(); ++j) {
+        OpenDriveGeometry& g = *j;
+        PositionVector geom;
+        switch (g.type) {
+            case OPENDRIVE_GT_UNKNOWN:
+                break;
+            case OPENDRIVE_GT_LINE:
+                geom = geomFromLine(e, g);
+                break;
+            case OPENDRIVE_GT_SPIRAL:
+                geom = geomFromSpiral(e, g, resolution);
+                break;
+            case OPENDRIVE_GT_ARC:
+                geom = geomFromArc(e, g, resolution);
+                break;
+            case OPENDRIVE_GT_POLY3:
+                geom = geomFromPoly(e, g, resolution);
+                break;
+            case OPENDRIVE_GT_PARAMPOLY3:
+                geom = geomFromParamPoly(e, g, resolution);
+                break;
+            default:
+                break;
+        }
+        if (e.geom.size() > 0 && prevType == OPENDRIVE_GT_LINE) {
+            // remove redundant end point of the previous geometry segment
+            // (the start point of the current segment should have the same value)
+            // this avoids geometry errors due to imprecision
+            if (!e.geom.back().almostSame(geom.front())) {
+                const int index = (int)(j - e.geometries.begin());
+                WRITE_WARNING("Mismatched geometry for edge '" + e.id + "' between geometry segments " + toString(index - 1) + " and " + toString(index) + ".");
+            }
+            e.geom.pop_back();
+        }
+        //std::cout << " adding geometry to road=" << e.id << " old=" << e.geom << " new=" << geom << "\n";
+        for (PositionVector::iterator k = geom.begin(); k != geom.end(); ++k) {
+            e.geom.push_back_noDoublePos(*k);
+        }
+        prevType = g.type;
+    }
+    if (maxError > 0) {
+        // straight parts of curved geometries are heavily oversampled by the
+        //  fixed sampling step; drop the points which do not contribute to the
+        //  wished precision
+        pruneGeometry(e.geom, maxError);
+    }
+    if (minDist >= 0) {
+        e.geom.removeDoublePoints(minDist, true);
+    }
+}
+
+
 void
 NIImporter_OpenDrive::computeShapes(std::map<std::string, OpenDriveEdge*>& edges) {
     OptionsCont& oc = OptionsCont::getOptions();
     const double res = oc.getFloat("opendrive.curve-resolution");
+    const double maxError = oc.getFloat("opendrive.geometry.max-error");
+    const double minDist = oc.exists("geometry.min-dist") && !oc.isDefault("geometry.min-dist") ? oc.getFloat("geometry.min-dist") : -1.;
+#ifdef HAVE_FOX
+    const int numThreads = NBNetBuilder::getNumThreads(oc);
+    if (numThreads > 1) {
+        // discretizing the geometry records of an edge only touches this edge
+        std::vector<std::vector<OpenDriveEdge*> > batches(numThreads);
+        int index = 0;
+        for (std::map<std::string, OpenDriveEdge*>::iterator i = edges.begin(); i != edges.end(); ++i) {
+            batches[index++ % numThreads].push_back((*i).second);
+        }
+        FXWorkerThread::Pool pool(numThreads);
+        for (int i = 0; i < numThreads; i++) {
+            pool.add(new DiscretizeGeometriesTask(batches[i], res, maxError, minDist));
+        }
+        pool.waitAll();
+    } else
+#endif
+    {
+        for (std::map<std::string, OpenDriveEdge*>::iterator i = edges.begin(); i != edges.end(); ++i) {
+            discretizeGeometries(*(*i).second, res, maxError, minDist);
+        }
+    }
+    // the projection and the position dependent records are handled serially
+    //  (the projection helper maintains shared state)
     for (std::map<std::string, OpenDriveEdge*>::iterator i = edges.begin(); i != edges.end(); ++i) {
         OpenDriveEdge& e = *(*i).second;
-        GeometryType prevType = OPENDRIVE_GT_UNKNOWN;
-        for (std::vector<OpenDriveGeometry>::iterator j = e.geometries.begin(); j != e.geometries.end(); ++j) {
-            OpenDriveGeometry& g = *j;
-            PositionVector geom;
-            switch (g.type) {
-                case OPENDRIVE_GT_UNKNOWN:
-                    break;
-                case OPENDRIVE_GT_LINE:
-                    geom = geomFromLine(e, g);
-                    break;
-                case OPENDRIVE_GT_SPIRAL:
-                    geom = geomFromSpiral(e, g, res);
-                    break;
-                case OPENDRIVE_GT_ARC:
-                    geom = geomFromArc(e, g, res);
-                    break;
-                case OPENDRIVE_GT_POLY3:
-                    geom = geomFromPoly(e, g, res);
-                    break;
-                case OPENDRIVE_GT_PARAMPOLY3:
-                    geom = geomFromParamPoly(e, g, res);
-                    break;
-                default:
-                    break;
-            }
-            if (e.geom.size() > 0 && prevType == OPENDRIVE_GT_LINE) {
-                // remove redundant end point of the previous geometry segment
-                // (the start point of the current segment should have the same value)
-                // this avoids geometry errors due to imprecision
-                if (!e.geom.back().almostSame(geom.front())) {
-                    const int index = (int)(j - e.geometries.begin());
-                    WRITE_WARNING("Mismatched geometry for edge '" + e.id + "' between geometry segments " + toString(index - 1) + " and " + toString(index) + ".");
-                }
-                e.geom.pop_back();
-            }
-            //std::cout << " adding geometry to road=" << e.id << " old=" << e.geom << " new=" << geom << "\n";
-            for (PositionVector::iterator k = geom.begin(); k != geom.end(); ++k) {
-                e.geom.push_back_noDoublePos(*k);
-            }
-            prevType = g.type;
-        }
-        if (oc.exists("geometry.min-dist") && !oc.isDefault("geometry.min-dist")) {
-            e.geom.removeDoublePoints(oc.getFloat("geometry.min-dist"), true);
-        }
         if (!NBNetBuilder::transformCoordinates(e.geom)) {
             WRITE_ERROR("Unable to project coordinates for edge '" + e.id + "'.");
         }
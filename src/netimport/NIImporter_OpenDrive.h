@@ -574,6 +574,17 @@ protected:
      */
     static void computeShapes(std::map<std::string, OpenDriveEdge*>& edges);
 
+    /** @brief Builds the (not yet projected) polyline of an edge from its geometry records
+     * @param[in, out] e The edge whose polyline shall be built
+     * @param[in] resolution The sampling step for curved geometries
+     * @param[in] maxError The maximum lateral error when pruning sampled points or -1 for keeping all points
+     * @param[in] minDist The minimum distance between geometry points or -1 for keeping all points
+     */
+    static void discretizeGeometries(OpenDriveEdge& e, double resolution, double maxError, double minDist);
+
+    /// @brief discretizes batches of edges within worker threads
+    friend class DiscretizeGeometriesTask;
+
     /** @brief Rechecks lane sections of the given edges
      *
      *
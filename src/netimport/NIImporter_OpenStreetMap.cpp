@@ -135,16 +135,29 @@ NIImporter_OpenStreetMap::load(const OptionsCont& oc, NBNetBuilder& nb) {
         return;
     }
     /* Parse file(s)
-     * Each file is parsed twice: first for nodes, second for edges. */
+     * Each file is parsed three times: first for collecting the ids of
+     * referenced nodes, second for nodes, third for edges. */
     std::vector<std::string> files = oc.getStringVector("osm-files");
-    // load nodes, first
-    NodesHandler nodesHandler(myOSMNodes, myUniqueNodes, oc);
+    // collect the ids of referenced nodes, first
+    //  (most nodes only carry geometry for ways which may get discarded;
+    //   there is no need to keep them in memory)
+    NodeRefsHandler refsHandler(myReferencedNodes);
     for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
-        // nodes
         if (!FileHelpers::isReadable(*file)) {
             WRITE_ERROR("Could not open osm-file '" + *file + "'.");
             return;
         }
+        refsHandler.setFileName(*file);
+        PROGRESS_BEGIN_MESSAGE("Parsing node references from osm-file '" + *file + "'");
+        if (!XMLSubSys::runParser(refsHandler, *file)) {
+            return;
+        }
+        PROGRESS_DONE_MESSAGE();
+    }
+    // load the referenced nodes, then
+    NodesHandler nodesHandler(myOSMNodes, myUniqueNodes, myReferencedNodes, oc);
+    for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
+        // nodes
         nodesHandler.setFileName(*file);
         PROGRESS_BEGIN_MESSAGE("Parsing nodes from osm-file '" + *file + "'");
         if (!XMLSubSys::runParser(nodesHandler, *file)) {
@@ -630,11 +643,48 @@ NIImporter_OpenStreetMap::insertEdge(Edge* e, int index, NBNode* from, NBNode* t
     return newIndex;
 }
 
+// ---------------------------------------------------------------------------
+// definitions of NIImporter_OpenStreetMap::NodeRefsHandler-methods
+// ---------------------------------------------------------------------------
+NIImporter_OpenStreetMap::NodeRefsHandler::NodeRefsHandler(std::unordered_set<long long int>& toFill)
+    :
+    SUMOSAXHandler("osm - file"),
+    myToFill(toFill) {
+}
+
+NIImporter_OpenStreetMap::NodeRefsHandler::~NodeRefsHandler() = default;
+
+void
+NIImporter_OpenStreetMap::NodeRefsHandler::myStartElement(int element, const SUMOSAXAttributes& attrs) {
+    if (element == SUMO_TAG_ND) {
+        bool ok = true;
+        const long long int ref = attrs.get<long
+                                  long
+                                  int>(SUMO_ATTR_REF, 0, ok);
+        if (ok) {
+            myToFill.insert(ref);
+        }
+    } else if (element == SUMO_TAG_MEMBER) {
+        // relations may reference nodes directly (via-nodes, stops, platforms)
+        bool ok = true;
+        std::string memberType = attrs.get<std::string>(SUMO_ATTR_TYPE, 0, ok);
+        if (ok && memberType == "node") {
+            const long long int ref = attrs.get<long
+                                      long
+                                      int>(SUMO_ATTR_REF, 0, ok);
+            if (ok) {
+                myToFill.insert(ref);
+            }
+        }
+    }
+}
+
 // ---------------------------------------------------------------------------
 // definitions of NIImporter_OpenStreetMap::NodesHandler-methods
 // ---------------------------------------------------------------------------
 NIImporter_OpenStreetMap::NodesHandler::NodesHandler(std::map<long long int, NIOSMNode*>& toFill,
         std::set<NIOSMNode*, CompareNodes>& uniqueNodes,
+        const std::unordered_set<long long int>& referencedNodes,
         const OptionsCont& oc)
 
     :
@@ -644,6 +694,7 @@ NIImporter_OpenStreetMap::NodesHandler::NodesHandler(std::map<long long int, NIO
     myIsInValidNodeTag(false),
     myHierarchyLevel(0),
     myUniqueNodes(uniqueNodes),
+    myReferencedNodes(referencedNodes),
     myImportElevation(oc.getBool("osm.elevation")),
     myOptionsCont(oc) {
 }
@@ -674,6 +725,10 @@ NIImporter_OpenStreetMap::NodesHandler::myStartElement(int element, const SUMOSA
             return;
         }
         myLastNodeID = -1;
+        if (myReferencedNodes.count(id) == 0) {
+            // the node is not referenced by any way or relation; no need to keep it
+            return;
+        }
         if (myToFill.find(id) == myToFill.end()) {
             myLastNodeID = id;
             // assume we are loading multiple files...
@@ -35,6 +35,7 @@
 
 #include <string>
 #include <map>
+#include <unordered_set>
 #include <utils/xml/SUMOSAXHandler.h>
 #include <utils/common/UtilExceptions.h>
 #include <utils/common/Parameterised.h>
@@ -217,6 +218,13 @@ private:
 
     class CompareEdges;
 
+    /** @brief the ids of OSM nodes which are referenced by a way or relation
+     *
+     * Filled in a first pass over the input so that geometry-only nodes of
+     *  discarded ways never have to be kept in memory
+     */
+    std::unordered_set<long long int> myReferencedNodes;
+
     /** @brief the map from OSM node ids to actual nodes
      * @note: NIOSMNodes may appear multiple times due to substition
      */
@@ -281,6 +289,55 @@ protected:
     static const double MAXSPEED_UNGIVEN;
     static const long long int INVALID_ID;
 
+    /**
+     * @class NodeRefsHandler
+     * @brief A class which collects the ids of nodes referenced by ways and relations
+     *
+     * Running this handler as a first pass over the input allows the
+     *  NodesHandler to materialize only the (typically small) share of nodes
+     *  which is actually used.
+     */
+    class NodeRefsHandler : public SUMOSAXHandler {
+    public:
+        /** @brief Constructor
+         * @param[in, out] toFill The set of referenced node ids to fill
+         */
+        explicit NodeRefsHandler(std::unordered_set<long long int>& toFill);
+
+
+        /// @brief Destructor
+        ~NodeRefsHandler() override;
+
+
+    protected:
+        /// @name inherited from GenericSAXHandler
+        //@{
+
+        /** @brief Called on the opening of a tag;
+         *
+         * @param[in] element ID of the currently opened element
+         * @param[in] attrs Attributes within the currently opened element
+         * @exception ProcessError If something fails
+         * @see GenericSAXHandler::myStartElement
+         */
+        void myStartElement(int element, const SUMOSAXAttributes& attrs) override;
+        //@}
+
+
+    private:
+        /// @brief The set of referenced node ids to fill
+        std::unordered_set<long long int>& myToFill;
+
+    private:
+        /** @brief invalidated copy constructor */
+        NodeRefsHandler(const NodeRefsHandler& s);
+
+        /** @brief invalidated assignment operator */
+        NodeRefsHandler& operator=(const NodeRefsHandler& s);
+
+    };
+
+
     /**
      * @class NodesHandler
      * @brief A class which extracts OSM-nodes from a parsed OSM-file
@@ -291,10 +348,12 @@ protected:
         /** @brief Contructor
          * @param[in, out] toFill The nodes container to fill
          * @param[in, out] uniqueNodes The nodes container for ensuring uniqueness
+         * @param[in] referencedNodes The ids of nodes which are referenced by a way or relation
          * @param[in] options The options to use
          */
         NodesHandler(std::map<long long int, NIOSMNode*>& toFill, std::set<NIOSMNode*,
                      CompareNodes>& uniqueNodes,
+                     const std::unordered_set<long long int>& referencedNodes,
                      const OptionsCont& cont);
 
 
@@ -343,6 +402,9 @@ protected:
         /// @brief the set of unique nodes (used for duplicate detection/substitution)
         std::set<NIOSMNode*, CompareNodes>& myUniqueNodes;
 
+        /// @brief the ids of nodes which are referenced by a way or relation
+        const std::unordered_set<long long int>& myReferencedNodes;
+
         /// @brief whether elevation data should be imported
         const bool myImportElevation;
 
@@ -45,6 +45,8 @@
 #include <utils/common/FileHelpers.h>
 #include <utils/common/SysUtils.h>
 #include <utils/common/ToString.h>
+#include <utils/iodevices/OutputDevice.h>
+#include <utils/xml/SUMOSAXCopyHandler.h>
 #include <utils/xml/SUMORouteLoaderControl.h>
 #include <utils/xml/SUMORouteLoader.h>
 #include <utils/xml/XMLSubSys.h>
@@ -124,6 +126,17 @@ NLBuilder::~NLBuilder() {}
 
 bool
 NLBuilder::build() {
+    // ask the operating system to read all referenced files ahead so that the
+    //  later loading phases do not pay cold-cache disk latency per file
+    const std::string fileOptions[] = { "net-file", "additional-files", "route-files", "weight-files", "load-state" };
+    for (int i = 0; i < 5; i++) {
+        if (myOptions.isSet(fileOptions[i])) {
+            const std::vector<std::string> files = myOptions.getStringVector(fileOptions[i]);
+            for (std::vector<std::string>::const_iterator f = files.begin(); f != files.end(); ++f) {
+                SysUtils::advisePrefetch(*f);
+            }
+        }
+    }
     // try to build the net
     if (!load("net-file", true)) {
         return false;
@@ -179,11 +192,13 @@ NLBuilder::build() {
         std::vector<std::string> files = myOptions.getStringVector("weight-files");
         for (std::vector<std::string>::iterator i = files.begin(); i != files.end(); ++i) {
             // report about loading when wished
-            WRITE_MESSAGE("Loading weights from '" + *i + "'...");
+            PROGRESS_BEGIN_MESSAGE("Loading weights from '" + *i + "'");
+            long before = SysUtils::getCurrentMillis();
             // parse the file
             if (!XMLSubSys::runParser(handler, *i)) {
                 return false;
             }
+            PROGRESS_TIME_MESSAGE(before);
         }
     }
     // load the previous state if wished
@@ -266,6 +281,16 @@ NLBuilder::init() {
     if (builder.build()) {
         // preload the routes especially for TraCI
         net->loadRoutes();
+        if (oc.getBool("validate")) {
+            // the net and all route input parsed without errors, quit
+            if (MsgHandler::getErrorInstance()->wasInformed()) {
+                delete net;
+                throw ProcessError();
+            }
+            WRITE_MESSAGE("Validation successful.");
+            delete net;
+            return nullptr;
+        }
         return net;
     }
     delete net;
@@ -332,13 +357,40 @@ NLBuilder::load(const std::string& mmlWhat, const bool isNet) {
     }
     std::vector<std::string> files = myOptions.getStringVector(mmlWhat);
     for (std::vector<std::string>::const_iterator fileIt = files.begin(); fileIt != files.end(); ++fileIt) {
-        PROGRESS_BEGIN_MESSAGE("Loading " + mmlWhat + " from '" + *fileIt + "'");
+        std::string file = *fileIt;
+        bool writeCache = false;
+        std::string cacheFile;
+        if (isNet && myOptions.getBool("network.cache")
+                && !(file.length() >= 4 && file.substr(file.length() - 4) == ".sbx")) {
+            // use the binary cache if it is up to date, schedule its creation otherwise
+            cacheFile = file + ".cache.sbx";
+            if (FileHelpers::isReadable(cacheFile)
+                    && FileHelpers::getModifiedTime(cacheFile) >= FileHelpers::getModifiedTime(file)) {
+                file = cacheFile;
+            } else {
+                writeCache = true;
+            }
+        }
+        PROGRESS_BEGIN_MESSAGE("Loading " + mmlWhat + " from '" + file + "'");
         long before = SysUtils::getCurrentMillis();
-        if (!XMLSubSys::runParser(myXMLHandler, *fileIt, isNet)) {
+        if (!XMLSubSys::runParser(myXMLHandler, file, isNet)) {
             WRITE_MESSAGE("Loading of " + mmlWhat + " failed.");
             return false;
         }
         PROGRESS_TIME_MESSAGE(before);
+        if (writeCache) {
+            PROGRESS_BEGIN_MESSAGE("Writing network cache to '" + cacheFile + "'");
+            before = SysUtils::getCurrentMillis();
+            OutputDevice& dev = OutputDevice::getDevice(cacheFile);
+            SUMOSAXCopyHandler copyHandler(dev, file);
+            if (XMLSubSys::runParser(copyHandler, file, isNet)) {
+                dev.close();
+                PROGRESS_TIME_MESSAGE(before);
+            } else {
+                dev.close();
+                WRITE_WARNING("Could not write network cache '" + cacheFile + "'.");
+            }
+        }
     }
     return true;
 }
@@ -358,7 +410,7 @@ NLBuilder::buildRouteLoaderControl(const OptionsCont& oc) {
         }
         // open files for reading
         for (std::vector<std::string>::const_iterator fileIt = files.begin(); fileIt != files.end(); ++fileIt) {
-            loaders->add(new SUMORouteLoader(new MSRouteHandler(*fileIt, false)));
+            loaders->add(new SUMORouteLoader(new MSRouteHandler(*fileIt, false), MSGlobals::gNumSimThreads > 1));
         }
     }
     return loaders;
@@ -99,7 +99,7 @@ void
 NLDetectorBuilder::buildInductLoop(const std::string& id,
                                    const std::string& lane, double pos, SUMOTime splInterval,
                                    const std::string& device, bool friendlyPos,
-                                   const std::string& vTypes) {
+                                   const std::string& vTypes, bool countOnly) {
     checkSampleInterval(splInterval, SUMO_TAG_E1DETECTOR, id);
     // get and check the lane
     MSLane* clane = getLaneChecking(lane, SUMO_TAG_E1DETECTOR, id);
@@ -107,6 +107,14 @@ NLDetectorBuilder::buildInductLoop(const std::string& id,
     pos = getPositionChecking(pos, clane, friendlyPos, id);
     // build the loop
     MSDetectorFileOutput* loop = createInductLoop(id, clane, pos, vTypes);
+    if (countOnly) {
+        MSInductLoop* const il = dynamic_cast<MSInductLoop*>(loop);
+        if (il != 0) {
+            il->setCountOnly(true);
+        } else {
+            WRITE_WARNING("Ignoring 'countOnly' for e1 detector '" + id + "'.");
+        }
+    }
     // add the file output
     myNet.getDetectorControl().add(SUMO_TAG_INDUCTION_LOOP, loop, device, splInterval);
 }
@@ -371,10 +379,10 @@ void
 NLDetectorBuilder::buildRouteProbe(const std::string& id, const std::string& edge,
                                    SUMOTime frequency, SUMOTime begin,
                                    const std::string& device,
-                                   const std::string& vTypes) {
+                                   const std::string& vTypes, int maxRoutes) {
     checkSampleInterval(frequency, SUMO_TAG_ROUTEPROBE, id);
     MSEdge* e = getEdgeChecking(edge, SUMO_TAG_ROUTEPROBE, id);
-    MSRouteProbe* probe = new MSRouteProbe(id, e, id + "_" + toString(begin), id + "_" + toString(begin - frequency), vTypes);
+    MSRouteProbe* probe = new MSRouteProbe(id, e, id + "_" + toString(begin), id + "_" + toString(begin - frequency), vTypes, maxRoutes);
     // add the file output
     myNet.getDetectorControl().add(SUMO_TAG_ROUTEPROBE, probe, device, frequency, begin);
 }
@@ -93,12 +93,13 @@ public:
      * @param[in] device The output device the detector shall write into
      * @param[in] friendlyPos Whether the position information shall be used "friendly" (see user docs)
      * @param[in] vTypes which vehicle types are considered
+     * @param[in] countOnly Whether the loop shall collect per-type passage counts only
      * @exception InvalidArgument If one of the values is invalid
      */
     void buildInductLoop(const std::string& id,
                          const std::string& lane, double pos, SUMOTime splInterval,
                          const std::string& device, bool friendlyPos,
-                         const std::string& vTypes);
+                         const std::string& vTypes, bool countOnly = false);
 
 
     /** @brief Builds an instantenous induction and adds it to the net
@@ -248,12 +249,13 @@ public:
      * @param[in] frequency The reporting frequency
      * @param[in] begin The start of the first reporting interval
      * @param[in] device The output device the detector shall write into
+     * @param[in] maxRoutes The maximum number of routes to track (0 means unlimited)
      * @exception InvalidArgument If one of the values is invalid
      */
     void buildRouteProbe(const std::string& id, const std::string& edge,
                          SUMOTime frequency, SUMOTime begin,
                          const std::string& device,
-                         const std::string& vTypes);
+                         const std::string& vTypes, int maxRoutes = 0);
     /// @}
 
 
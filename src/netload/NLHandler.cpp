@@ -780,13 +780,14 @@ NLHandler::addE1Detector(const SUMOSAXAttributes& attrs) {
     const std::string vTypes = attrs.getOpt<std::string>(SUMO_ATTR_VTYPES, id.c_str(), ok, "");
     const std::string lane = attrs.get<std::string>(SUMO_ATTR_LANE, id.c_str(), ok);
     const std::string file = attrs.get<std::string>(SUMO_ATTR_FILE, id.c_str(), ok);
+    const bool countOnly = attrs.getOpt<bool>(SUMO_ATTR_COUNT_ONLY, id.c_str(), ok, false);
     if (!ok) {
         return;
     }
     try {
         myDetectorBuilder.buildInductLoop(id, lane, position, frequency,
                                           FileHelpers::checkForRelativity(file, getFileName()),
-                                          friendlyPos, vTypes);
+                                          friendlyPos, vTypes, countOnly);
     } catch (InvalidArgument& e) {
         WRITE_ERROR(e.what());
     } catch (IOError& e) {
@@ -850,12 +851,13 @@ NLHandler::addRouteProbeDetector(const SUMOSAXAttributes& attrs) {
     std::string edge = attrs.get<std::string>(SUMO_ATTR_EDGE, id.c_str(), ok);
     std::string file = attrs.get<std::string>(SUMO_ATTR_FILE, id.c_str(), ok);
     const std::string vTypes = attrs.getOpt<std::string>(SUMO_ATTR_VTYPES, id.c_str(), ok, "");
+    const int maxRoutes = attrs.getOpt<int>(SUMO_ATTR_MAX_ROUTES, id.c_str(), ok, 0);
     if (!ok) {
         return;
     }
     try {
         myDetectorBuilder.buildRouteProbe(id, edge, frequency, begin,
-                                          FileHelpers::checkForRelativity(file, getFileName()), vTypes);
+                                          FileHelpers::checkForRelativity(file, getFileName()), vTypes, maxRoutes);
     } catch (InvalidArgument& e) {
         WRITE_ERROR(e.what());
     } catch (IOError& e) {
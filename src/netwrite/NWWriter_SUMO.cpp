@@ -48,6 +48,35 @@
 #include "NWFrame.h"
 #include "NWWriter_SUMO.h"
 
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#include <utils/iodevices/OutputDevice_String.h>
+
+// ===========================================================================
+// thread task declarations
+// ===========================================================================
+/// @brief formats a batch of edges into a string buffer of its own
+class EdgeWriteTask : public FXWorkerThread::Task {
+public:
+    EdgeWriteTask(const std::vector<const NBEdge*>& edges, OutputDevice& into, const bool noNames) :
+        myEdges(edges), myInto(into), myNoNames(noNames) {}
+
+    void run(FXWorkerThread* /* context */) {
+        for (std::vector<const NBEdge*>::const_iterator i = myEdges.begin(); i != myEdges.end(); ++i) {
+            NWWriter_SUMO::writeEdge(myInto, **i, myNoNames);
+        }
+    }
+
+private:
+    const std::vector<const NBEdge*> myEdges;
+    OutputDevice& myInto;
+    const bool myNoNames;
+
+private:
+    /// @brief Invalidated assignment operator.
+    EdgeWriteTask& operator=(const EdgeWriteTask&);
+};
+#endif
 
 
 // ===========================================================================
@@ -106,10 +135,38 @@ NWWriter_SUMO::writeNetwork(const OptionsCont& oc, NBNetBuilder& nb) {
     }
 
     // write edges with lanes and connected edges
-    bool noNames = !oc.getBool("output.street-names");
-    for (std::map<std::string, NBEdge*>::const_iterator i = ec.begin(); i != ec.end(); ++i) {
-        writeEdge(device, *(*i).second, noNames);
+    const bool noNames = !oc.getBool("output.street-names");
+#ifdef HAVE_FOX
+    const int numThreads = oc.exists("threads") ? MAX2(1, oc.getInt("threads")) : 1;
+    if (numThreads > 1 && !device.isBinary() && (int)ec.size() > numThreads) {
+        // format consecutive chunks of edges into buffers of their own in
+        //  parallel and append the buffers to the real device in order;
+        //  a binary device needs its formatter state and is written serially
+        std::vector<const NBEdge*> sortedEdges;
+        for (std::map<std::string, NBEdge*>::const_iterator i = ec.begin(); i != ec.end(); ++i) {
+            sortedEdges.push_back((*i).second);
+        }
+        const int chunkSize = (int)sortedEdges.size() / numThreads + 1;
+        FXWorkerThread::Pool pool(numThreads);
+        std::vector<OutputDevice_String*> buffers;
+        for (int start = 0; start < (int)sortedEdges.size(); start += chunkSize) {
+            const int end = MIN2(start + chunkSize, (int)sortedEdges.size());
+            buffers.push_back(new OutputDevice_String(false, 1));
+            pool.add(new EdgeWriteTask(std::vector<const NBEdge*>(sortedEdges.begin() + start, sortedEdges.begin() + end), *buffers.back(), noNames));
+        }
+        pool.waitAll();
+        for (std::vector<OutputDevice_String*>::const_iterator i = buffers.begin(); i != buffers.end(); ++i) {
+            device.writePreformattedTag((*i)->getString());
+            delete *i;
+        }
+    } else {
+#endif
+        for (std::map<std::string, NBEdge*>::const_iterator i = ec.begin(); i != ec.end(); ++i) {
+            writeEdge(device, *(*i).second, noNames);
+        }
+#ifdef HAVE_FOX
     }
+#endif
     device.lf();
 
     // write tls logics
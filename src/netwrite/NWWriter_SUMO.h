@@ -89,6 +89,14 @@ public:
     /// @brief writes the given prohibitions
     static void writeProhibitions(OutputDevice& into, const NBConnectionProhibits& prohibitions);
 
+    /** @brief Writes an edge (<edge ...) (also used by the parallel output tasks)
+     * @param[in] into The device to write the edge into
+     * @param[in] e The edge to write
+     * @param[in] noNames Whether names shall be ignored
+     * @see writeLane()
+     */
+    static void writeEdge(OutputDevice& into, const NBEdge& e, bool noNames);
+
     /// @brief writes the traffic light logics to the given device
     static void writeTrafficLights(OutputDevice& into, const NBTrafficLightLogicCont& tllCont);
 
@@ -112,15 +120,6 @@ private:
     static bool writeInternalEdges(OutputDevice& into, const NBEdgeCont& ec, const NBNode& n);
 
 
-    /** @brief Writes an edge (<edge ...)
-     * @param[in] into The device to write the edge into
-     * @param[in] e The edge to write
-     * @param[in] noNames Whether names shall be ignored
-     * @see writeLane()
-     */
-    static void writeEdge(OutputDevice& into, const NBEdge& e, bool noNames);
-
-
     /** @brief Writes a lane (<lane ...) of an edge
      * @param[in] into The device to write the edge into
      * @param[in] lID The ID of the lane
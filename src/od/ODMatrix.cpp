@@ -44,13 +44,21 @@
 #include <utils/common/StringTokenizer.h>
 #include <utils/common/SUMOTime.h>
 #include <utils/iodevices/OutputDevice.h>
+#include <utils/common/FileHelpers.h>
 #include <utils/importio/LineReader.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 #include <utils/xml/SUMOSAXHandler.h>
 #include <utils/xml/XMLSubSys.h>
 #include "ODAmitranHandler.h"
 #include "ODMatrix.h"
 
 
+// ===========================================================================
+// static member variables
+// ===========================================================================
+const int ODMatrix::BINARY_MAGIC = 0x4f44424d; // "ODBM"
+
+
 // ===========================================================================
 // method definitions
 // ===========================================================================
@@ -509,6 +517,66 @@ ODMatrix::readO(LineReader& lr, double scale,
 
 
 
+void
+ODMatrix::readB(const std::string& file, double scale) {
+    PROGRESS_BEGIN_MESSAGE("Reading matrix '" + file + "' stored as binary");
+    BinaryInputDevice dev(file);
+    int magic = 0;
+    dev >> magic;
+    if (magic != BINARY_MAGIC) {
+        throw ProcessError("'" + file + "' is not a binary matrix file.");
+    }
+    int version = 0;
+    dev >> version;
+    if (version != 1) {
+        throw ProcessError("'" + file + "' uses the unsupported binary matrix version " + toString(version) + ".");
+    }
+    int numCells = 0;
+    dev >> numCells;
+    for (int i = 0; i < numCells; i++) {
+        std::string origin;
+        std::string destination;
+        std::string vehicleType;
+        double begin;
+        double end;
+        double vehicleNumber;
+        dev >> origin;
+        dev >> destination;
+        dev >> vehicleType;
+        dev >> begin;
+        dev >> end;
+        dev >> vehicleNumber;
+        if (vehicleNumber != 0) {
+            add(vehicleNumber * scale, TIME2STEPS(begin), TIME2STEPS(end), origin, destination, vehicleType);
+        }
+    }
+    PROGRESS_DONE_MESSAGE();
+}
+
+
+void
+ODMatrix::writeBinary(const std::string& file) const {
+    PROGRESS_BEGIN_MESSAGE("Writing matrix to '" + file + "' as binary");
+    std::ofstream strm(file.c_str(), std::ios::binary);
+    if (!strm.good()) {
+        throw ProcessError("Could not open '" + file + "' for writing.");
+    }
+    FileHelpers::writeInt(strm, BINARY_MAGIC);
+    FileHelpers::writeInt(strm, 1);
+    FileHelpers::writeInt(strm, (int)myContainer.size());
+    for (std::vector<ODCell*>::const_iterator i = myContainer.begin(); i != myContainer.end(); ++i) {
+        const ODCell* const c = *i;
+        FileHelpers::writeString(strm, c->origin);
+        FileHelpers::writeString(strm, c->destination);
+        FileHelpers::writeString(strm, c->vehicleType);
+        FileHelpers::writeFloat(strm, STEPS2TIME(c->begin));
+        FileHelpers::writeFloat(strm, STEPS2TIME(c->end));
+        FileHelpers::writeFloat(strm, c->vehicleNumber);
+    }
+    PROGRESS_DONE_MESSAGE();
+}
+
+
 double
 ODMatrix::getNumLoaded() const {
     return myNumLoaded;
@@ -560,6 +628,15 @@ void
 ODMatrix::loadMatrix(OptionsCont& oc) {
     std::vector<std::string> files = oc.getStringVector("od-matrix-files");
     for (std::vector<std::string>::iterator i = files.begin(); i != files.end(); ++i) {
+        // binary matrices are identified by their leading magic number
+        std::ifstream sniff(i->c_str(), std::ios::binary);
+        int magic = 0;
+        sniff.read((char*) &magic, sizeof(int));
+        sniff.close();
+        if (magic == BINARY_MAGIC) {
+            readB(*i, oc.getFloat("scale"));
+            continue;
+        }
         LineReader lr(*i);
         if (!lr.good()) {
             throw ProcessError("Could not open '" + (*i) + "'.");
@@ -228,6 +228,22 @@ public:
     void readV(LineReader& lr, double scale,
                std::string vehType, bool matrixHasVehType);
 
+    /** @brief read a matrix in the binary format written by writeBinary
+     *
+     * @param[in] file The file to read the matrix from
+     * @param[in] scale The factor by which to scale the vehicle numbers
+     */
+    void readB(const std::string& file, double scale);
+
+    /** @brief write the loaded matrix in a compact binary format
+     *
+     * The written file can be loaded in place of the text matrices and
+     *  avoids the cost of tokenizing and parsing numbers on every run.
+     *
+     * @param[in] file The file to write the matrix to
+     */
+    void writeBinary(const std::string& file) const;
+
     /** @brief read a matrix in one of several formats
      *  @todo Describe
      */
@@ -342,6 +358,9 @@ private:
 
 
 private:
+    /// @brief The magic number identifying binary matrix files
+    static const int BINARY_MAGIC;
+
     /// @brief The loaded cells
     std::vector<ODCell*> myContainer;
 
@@ -108,6 +108,9 @@ fillOptions() {
     oc.doRegister("flow-output", new Option_FileName());
     oc.addDescription("flow-output", "Output", "Writes flow definitions into FILE");
 
+    oc.doRegister("matrix-output", new Option_FileName());
+    oc.addDescription("matrix-output", "Output", "Writes the loaded matrix in a compact binary format into FILE (loadable via --od-matrix-files)");
+
     oc.doRegister("flow-output.probability", new Option_Bool(false));
     oc.addDescription("flow-output.probability", "Output", "Writes probabilistic flow instead of evenly spaced flow");
 
@@ -289,6 +292,10 @@ main(int argc, char** argv) {
         }
         // write
         bool haveOutput = false;
+        if (oc.isSet("matrix-output")) {
+            matrix.writeBinary(oc.getString("matrix-output"));
+            haveOutput = true;
+        }
         if (OutputDevice::createDeviceByOption("output-file", "routes", "routes_file.xsd")) {
             matrix.write(string2time(oc.getString("begin")), string2time(oc.getString("end")),
                          OutputDevice::getDeviceByOption("output-file"),
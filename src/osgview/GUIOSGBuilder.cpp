@@ -47,6 +47,7 @@
 #include <osg/Sequence>
 #include <osg/Texture2D>
 #include <osgViewer/Viewer>
+#include <osgUtil/Optimizer>
 #include <osgUtil/Tessellator>
 #include <osg/PositionAttitudeTransform>
 #include <osg/ShadeModel>
@@ -90,17 +91,27 @@ GUIOSGBuilder::buildOSGScene(osg::Node* const tlg, osg::Node* const tly, osg::No
     osgUtil::Tessellator tesselator;
     osg::Group* root = new osg::Group();
     GUINet* net = static_cast<GUINet*>(MSNet::getInstance());
+    // build the static network geometry in a separate group so it can be
+    //  batched; one geode per lane or junction makes the traversal alone
+    //  dominate the frame time on large networks
+    osg::Group* netGroup = new osg::Group();
     // build edges
     const MSEdgeVector& edges = net->getEdgeControl().getEdges();
     for (MSEdgeVector::const_iterator i = edges.begin(); i != edges.end(); ++i) {
         if (!(*i)->isInternal()) {
-            buildOSGEdgeGeometry(**i, *root, tesselator);
+            buildOSGEdgeGeometry(**i, *netGroup, tesselator);
         }
     }
     // build junctions
     for (int index = 0; index < (int)net->myJunctionWrapper.size(); ++index) {
-        buildOSGJunctionGeometry(*net->myJunctionWrapper[index], *root, tesselator);
+        buildOSGJunctionGeometry(*net->myJunctionWrapper[index], *netGroup, tesselator);
     }
+    // merge the geodes and build a spatial hierarchy for culling; the lane
+    //  geometries themselves are left untouched since their color arrays are
+    //  still updated individually
+    osgUtil::Optimizer optimizer;
+    optimizer.optimize(netGroup, osgUtil::Optimizer::MERGE_GEODES | osgUtil::Optimizer::SPATIALIZE_GROUPS);
+    root->addChild(netGroup);
     // build traffic lights
     GUISUMOAbstractView::Decal d;
     const std::vector<std::string> tlids = net->getTLSControl().getAllTLIds();
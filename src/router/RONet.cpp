@@ -52,6 +52,9 @@
 // static member definitions
 // ===========================================================================
 RONet* RONet::myInstance = 0;
+#ifdef HAVE_FOX
+const int RONet::RoutingTask::BATCH_SIZE = 32;
+#endif
 
 
 // ===========================================================================
@@ -547,6 +550,11 @@ RONet::saveAndRemoveRoutesUntil(OptionsCont& options, const RORouterProvider& pr
 #endif
             createBulkRouteRequests(provider, time, removeLoops);
         } else {
+#ifdef HAVE_FOX
+            // routables are dispatched in batches to avoid paying the task
+            //  queue overhead once per vehicle
+            std::vector<RORoutable*> batch;
+#endif
             for (RoutablesMap::const_iterator i = myRoutables.begin(); i != myRoutables.end(); ++i) {
                 if (i->first >= time) {
                     break;
@@ -566,7 +574,10 @@ RONet::saveAndRemoveRoutesUntil(OptionsCont& options, const RORouterProvider& pr
                             if (numThreads < maxNumThreads && myThreadPool.isFull()) {
                                 new WorkerThread(myThreadPool, provider);
                             }
-                            myThreadPool.add(new RoutingTask(routable, removeLoops, myErrorHandler));
+                            batch.push_back(routable);
+                            if ((int)batch.size() == RoutingTask::BATCH_SIZE) {
+                                myThreadPool.add(new RoutingTask(batch, removeLoops, myErrorHandler));
+                            }
                         }
                         continue;
                     }
@@ -574,6 +585,11 @@ RONet::saveAndRemoveRoutesUntil(OptionsCont& options, const RORouterProvider& pr
                     routable->computeRoute(provider, removeLoops, myErrorHandler);
                 }
             }
+#ifdef HAVE_FOX
+            if (!batch.empty()) {
+                myThreadPool.add(new RoutingTask(batch, removeLoops, myErrorHandler));
+            }
+#endif
         }
 #ifdef HAVE_FOX
         myThreadPool.waitAll();
@@ -702,7 +718,9 @@ RONet::setPermissionsFound() {
 // ---------------------------------------------------------------------------
 void
 RONet::RoutingTask::run(FXWorkerThread* context) {
-    myRoutable->computeRoute(*static_cast<WorkerThread*>(context), myRemoveLoops, myErrorHandler);
+    for (RORoutable* const routable : myRoutables) {
+        routable->computeRoute(*static_cast<WorkerThread*>(context), myRemoveLoops, myErrorHandler);
+    }
 }
 #endif
 
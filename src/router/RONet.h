@@ -33,6 +33,7 @@
 #endif
 
 #include <vector>
+#include <unordered_set>
 #include <utils/common/MsgHandler.h>
 #include <utils/common/NamedObjectCont.h>
 #include <utils/distribution/RandomDistributor.h>
@@ -453,11 +454,11 @@ private:
     /// @brief Unique instance of RONet
     static RONet* myInstance;
 
-    /// @brief Known vehicle ids
-    std::set<std::string> myVehIDs;
+    /// @brief Known vehicle ids (only for duplicate detection, ids of written vehicles must stay)
+    std::unordered_set<std::string> myVehIDs;
 
-    /// @brief Known person ids
-    std::set<std::string> myPersonIDs;
+    /// @brief Known person ids (only for duplicate detection, ids of written persons must stay)
+    std::unordered_set<std::string> myPersonIDs;
 
     /// @brief Known nodes
     NamedObjectCont<RONode*> myNodes;
@@ -542,10 +543,18 @@ private:
     class RoutingTask : public FXWorkerThread::Task {
     public:
         RoutingTask(RORoutable* v, const bool removeLoops, MsgHandler* errorHandler)
-            : myRoutable(v), myRemoveLoops(removeLoops), myErrorHandler(errorHandler) {}
+            : myRoutables(1, v), myRemoveLoops(removeLoops), myErrorHandler(errorHandler) {}
+        /// @brief Constructor for a whole batch of routables, empties the given vector
+        RoutingTask(std::vector<RORoutable*>& vs, const bool removeLoops, MsgHandler* errorHandler)
+            : myRemoveLoops(removeLoops), myErrorHandler(errorHandler) {
+            myRoutables.swap(vs);
+        }
         void run(FXWorkerThread* context);
+
+        /// @brief the number of routables to put into one task when not in bulk mode
+        static const int BATCH_SIZE;
     private:
-        RORoutable* const myRoutable;
+        std::vector<RORoutable*> myRoutables;
         const bool myRemoveLoops;
         MsgHandler* const myErrorHandler;
     private:
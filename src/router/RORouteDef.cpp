@@ -32,6 +32,7 @@
 #include <string>
 #include <iterator>
 #include <algorithm>
+#include <cmath>
 #include <utils/common/TplConvert.h>
 #include <utils/common/ToString.h>
 #include <utils/common/Named.h>
@@ -139,6 +140,17 @@ RORouteDef::preComputeCurrentRoute(SUMOAbstractRouter<ROEdge, ROVehicle>& router
             || OptionsCont::getOptions().getBool("remove-loops")) {
         myPrecomputed = myAlternatives[myLastUsed];
     } else {
+        const double threshold = RouteCostCalculator<RORoute, ROEdge, ROVehicle>::getCalculator().skipNewRoutesThreshold();
+        if (threshold > 0.) {
+            // only calculate a new route if the cost of the current one
+            //  changed notably with the new weights
+            const double oldCosts = myAlternatives[myLastUsed]->getCosts();
+            const double newCosts = router.recomputeCosts(myAlternatives[myLastUsed]->getEdgeVector(), &veh, begin);
+            if (oldCosts > 0. && fabs(newCosts - oldCosts) < threshold * oldCosts) {
+                myPrecomputed = myAlternatives[myLastUsed];
+                return;
+            }
+        }
         // build a new route to test whether it is better
         ConstROEdgeVector oldEdges;
         oldEdges.push_back(myAlternatives[0]->getFirst());
@@ -301,11 +313,64 @@ RORouteDef::addAlternative(SUMOAbstractRouter<ROEdge, ROVehicle>& router,
         return;
     }
     // add the route when it's new
+    std::set<const RORoute*> newRoutes;
     if (myNewRoute) {
         myAlternatives.push_back(current);
+        newRoutes.insert(current);
     }
-    // recompute the costs and (when a new route was added) scale the probabilities
-    const double scale = double(myAlternatives.size() - 1) / double(myAlternatives.size());
+    // optionally fill the alternatives set eagerly so the assignment does not
+    //  need one iteration per alternative: each extra route comes from a
+    //  single query which excludes the most expensive edges found so far
+    const int prefill = RouteCostCalculator<RORoute, ROEdge, ROVehicle>::getCalculator().getPrefillAlternatives();
+    if ((int)myAlternatives.size() < prefill) {
+        prohibited_withPermissions<ROEdge, ROVehicle>* const pf = dynamic_cast<prohibited_withPermissions<ROEdge, ROVehicle>*>(&router);
+        if (pf != 0) {
+            std::vector<ROEdge*> prohibited;
+            const ROEdge* const from = myAlternatives[0]->getFirst();
+            const ROEdge* const to = myAlternatives[0]->getLast();
+            const RORoute* last = myAlternatives.back();
+            while ((int)myAlternatives.size() < prefill) {
+                // exclude the most expensive interior edge of the last found route
+                const ConstROEdgeVector& lastEdges = last->getEdgeVector();
+                const ROEdge* vital = 0;
+                double vitalTime = -1.;
+                for (ConstROEdgeVector::const_iterator e = lastEdges.begin() + 1; e + 1 < lastEdges.end(); ++e) {
+                    const double travelTime = (*e)->getTravelTime(veh, STEPS2TIME(begin));
+                    if (travelTime > vitalTime && std::find(prohibited.begin(), prohibited.end(), *e) == prohibited.end()) {
+                        vital = *e;
+                        vitalTime = travelTime;
+                    }
+                }
+                if (vital == 0) {
+                    break;
+                }
+                prohibited.push_back(const_cast<ROEdge*>(vital));
+                pf->prohibit(prohibited);
+                ConstROEdgeVector edges;
+                if (!router.compute(from, to, veh, begin, edges)) {
+                    break;
+                }
+                // the detour may have been found before
+                bool duplicate = false;
+                for (std::vector<RORoute*>::const_iterator i = myAlternatives.begin(); i != myAlternatives.end(); ++i) {
+                    if (edges == (*i)->getEdgeVector()) {
+                        duplicate = true;
+                        break;
+                    }
+                }
+                if (!duplicate) {
+                    RGBColor* col = myAlternatives[0]->getColor() != 0 ? new RGBColor(*myAlternatives[0]->getColor()) : 0;
+                    RORoute* const alt = new RORoute(myID, 0, 1, edges, col, myAlternatives[0]->getStops());
+                    myAlternatives.push_back(alt);
+                    newRoutes.insert(alt);
+                    last = alt;
+                }
+            }
+            pf->prohibit(std::vector<ROEdge*>());
+        }
+    }
+    // recompute the costs and (when new routes were added) scale the probabilities
+    const double scale = double(myAlternatives.size() - newRoutes.size()) / double(myAlternatives.size());
     for (std::vector<RORoute*>::iterator i = myAlternatives.begin(); i != myAlternatives.end(); i++) {
         RORoute* alt = *i;
         // recompute the costs for all routes
@@ -314,8 +379,8 @@ RORouteDef::addAlternative(SUMOAbstractRouter<ROEdge, ROVehicle>& router,
             throw ProcessError("Route '" + current->getID() + "' (vehicle '" + veh->getID() + "') is not valid.");
         }
         assert(myAlternatives.size() != 0);
-        if (myNewRoute) {
-            if (*i == current) {
+        if (!newRoutes.empty()) {
+            if (newRoutes.count(*i) != 0) {
                 // set initial probability and costs
                 alt->setProbability((double)(1.0 / (double) myAlternatives.size()));
                 alt->setCosts(newCosts);
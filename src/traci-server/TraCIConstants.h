@@ -541,6 +541,9 @@
 // current state, using external signal names (get: traffic lights)
 #define TL_EXTERNAL_STATE 0x2e
 
+// complete definition, sent only if changed since the last retrieval (get: traffic lights)
+#define TL_COMPLETE_DEFINITION_RYG_DIFF 0x2f
+
 // outgoing link number (get: lanes)
 #define LANE_LINK_NUMBER 0x30
 
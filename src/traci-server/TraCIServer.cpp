@@ -164,6 +164,12 @@ TraCIServer::TraCIServer(const SUMOTime begin, const int port, const int numClie
 
     if (!myAmEmbedded) {
         try {
+            // @note A shared-memory transport for co-located clients has been
+            //  considered but needs changes to the foreign tcpip library
+            //  (which is synced from the shawn project) and a portable
+            //  synchronization primitive available to all client languages.
+            //  Until then, batching commands into fewer messages is the way
+            //  to reduce the per-command round-trip overhead.
             WRITE_MESSAGE("***Starting server on port " + toString(port) + " ***");
             myServerSocket = new tcpip::Socket(port);
             while ((int)mySockets.size() < numClients) {
@@ -573,6 +579,7 @@ TraCIServer::processCommandsUntilSimStep(SUMOTime step) {
 void
 TraCIServer::cleanup() {
     mySubscriptions.clear();
+    TraCIServerAPI_TrafficLight::clearSentPrograms();
     myTargetTime = string2time(OptionsCont::getOptions().getString("begin"));
     for (myCurrentSocket = mySockets.begin(); myCurrentSocket != mySockets.end(); ++myCurrentSocket) {
         myCurrentSocket->second->targetTime = myTargetTime;
@@ -918,7 +925,7 @@ TraCIServer::postProcessSimulationStep() {
     std::cout << "   Size after writing an int is " << mySubscriptionCache.size() << std::endl;
 #endif
     for (std::vector<Subscription>::iterator i = mySubscriptions.begin(); i != mySubscriptions.end();) {
-        const Subscription& s = *i;
+        Subscription& s = *i;
         if (s.beginTime > t) {
             ++i;
             continue;
@@ -993,7 +1000,7 @@ TraCIServer::writeErrorStatusCmd(int commandId, const std::string& description,
 
 
 void
-TraCIServer::initialiseSubscription(const TraCIServer::Subscription& s) {
+TraCIServer::initialiseSubscription(TraCIServer::Subscription& s) {
     tcpip::Storage writeInto;
     std::string errors;
     if (processSingleSubscription(s, writeInto, errors)) {
@@ -1130,7 +1137,7 @@ TraCIServer::findObjectShape(int domain, const std::string& id, PositionVector&
 }
 
 bool
-TraCIServer::processSingleSubscription(const Subscription& s, tcpip::Storage& writeInto,
+TraCIServer::processSingleSubscription(Subscription& s, tcpip::Storage& writeInto,
                                        std::string& errors) {
     bool ok = true;
     tcpip::Storage outputStorage;
@@ -1144,22 +1151,41 @@ TraCIServer::processSingleSubscription(const Subscription& s, tcpip::Storage& wr
         libsumo::Helper::collectObjectsInRange(s.contextDomain, shape, s.range, objIDs);
     } else {
         objIDs.insert(s.id);
+        if (s.compiledRequests.size() != s.variables.size()) {
+            // render the request messages once; they do not change between steps
+            // but a repeated subscribe command may have extended the variable list
+            s.compiledRequests.clear();
+            std::vector<std::vector<unsigned char> >::const_iterator k = s.parameters.begin();
+            for (std::vector<int>::const_iterator i = s.variables.begin(); i != s.variables.end(); ++i, ++k) {
+                tcpip::Storage request;
+                request.writeUnsignedByte(*i);
+                request.writeString(s.id);
+                request.writePacket(*k);
+                s.compiledRequests.push_back(std::vector<unsigned char>(request.begin(), request.end()));
+            }
+        }
     }
+    const std::map<int, CmdExecutor>::iterator executor = myExecutors.find(getCommandId);
     const int numVars = s.contextVars && s.variables.size() == 1 && s.variables[0] == ID_LIST ? 0 : (int)s.variables.size();
     for (std::set<std::string>::iterator j = objIDs.begin(); j != objIDs.end(); ++j) {
         if (s.contextVars) {
             outputStorage.writeString(*j);
         }
         if (numVars > 0) {
+            int index = 0;
             std::vector<std::vector<unsigned char> >::const_iterator k = s.parameters.begin();
-            for (std::vector<int>::const_iterator i = s.variables.begin(); i != s.variables.end(); ++i, ++k) {
+            for (std::vector<int>::const_iterator i = s.variables.begin(); i != s.variables.end(); ++i, ++k, ++index) {
                 tcpip::Storage message;
-                message.writeUnsignedByte(*i);
-                message.writeString(*j);
-                message.writePacket(*k);
+                if (s.contextVars) {
+                    message.writeUnsignedByte(*i);
+                    message.writeString(*j);
+                    message.writePacket(*k);
+                } else {
+                    message.writePacket(s.compiledRequests[index]);
+                }
                 tcpip::Storage tmpOutput;
-                if (myExecutors.find(getCommandId) != myExecutors.end()) {
-                    ok &= myExecutors[getCommandId](*this, message, tmpOutput);
+                if (executor != myExecutors.end()) {
+                    ok &= executor->second(*this, message, tmpOutput);
                 } else {
                     writeStatusCmd(s.commandId, RTYPE_NOTIMPLEMENTED, "Unsupported command specified", tmpOutput);
                     ok = false;
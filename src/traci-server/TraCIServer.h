@@ -428,6 +428,9 @@ private:
         /// @brief The range of the context
         double range;
 
+        /// @brief The rendered per-variable request messages (only used without context)
+        std::vector<std::vector<unsigned char> > compiledRequests;
+
     };
 
     /// @brief The list of known, still valid subscriptions
@@ -444,9 +447,9 @@ private:
 
 private:
     bool addObjectVariableSubscription(const int commandId, const bool hasContext);
-    void initialiseSubscription(const Subscription& s);
+    void initialiseSubscription(Subscription& s);
     void removeSubscription(int commandId, const std::string& identity, int domain);
-    bool processSingleSubscription(const TraCIServer::Subscription& s, tcpip::Storage& writeInto,
+    bool processSingleSubscription(TraCIServer::Subscription& s, tcpip::Storage& writeInto,
                                    std::string& errors);
 
 
@@ -376,24 +376,7 @@ TraCIServerAPI_Simulation::writeStage(tcpip::Storage& outputStorage, const libsu
 
 std::pair<MSLane*, double>
 TraCIServerAPI_Simulation::convertCartesianToRoadMap(Position pos) {
-    std::pair<MSLane*, double> result;
-    std::vector<std::string> allEdgeIds;
-    double minDistance = std::numeric_limits<double>::max();
-
-    allEdgeIds = MSNet::getInstance()->getEdgeControl().getEdgeNames();
-    for (std::vector<std::string>::iterator itId = allEdgeIds.begin(); itId != allEdgeIds.end(); itId++) {
-        const std::vector<MSLane*>& allLanes = MSEdge::dictionary((*itId))->getLanes();
-        for (std::vector<MSLane*>::const_iterator itLane = allLanes.begin(); itLane != allLanes.end(); itLane++) {
-            const double newDistance = (*itLane)->getShape().distance2D(pos);
-            if (newDistance < minDistance) {
-                minDistance = newDistance;
-                result.first = (*itLane);
-            }
-        }
-    }
-    // @todo this may be a place where 3D is required but 2D is delivered
-    result.second = result.first->getShape().nearest_offset_to_point2D(pos, false);
-    return result;
+    return libsumo::Helper::convertCartesianToRoadMap(pos);
 }
 
 
@@ -457,6 +440,10 @@ TraCIServerAPI_Simulation::commandPositionConversion(TraCIServer& server, tcpip:
         case POSITION_ROADMAP: {
             // convert cartesion position to edge,offset,lane_index
             roadPos = convertCartesianToRoadMap(cartesianPos);
+            if (roadPos.first == 0) {
+                server.writeStatusCmd(commandId, RTYPE_ERR, "Position could not be mapped onto the road network.");
+                return false;
+            }
             // write result that is added to response msg
             outputStorage.writeUnsignedByte(POSITION_ROADMAP);
             outputStorage.writeString(roadPos.first->getEdge().getID());
@@ -41,6 +41,13 @@
 #include "TraCIServerAPI_TrafficLight.h"
 
 
+// ===========================================================================
+// static members
+// ===========================================================================
+// the active program last sent per traffic light for the diff retrieval
+static std::map<std::string, std::string> gSentPrograms;
+
+
 // ===========================================================================
 // method definitions
 // ===========================================================================
@@ -52,6 +59,7 @@ TraCIServerAPI_TrafficLight::processGet(TraCIServer& server, tcpip::Storage& inp
     const std::string id = inputStorage.readString();
     // check variable
     if (variable != ID_LIST && variable != TL_RED_YELLOW_GREEN_STATE && variable != TL_COMPLETE_DEFINITION_RYG
+            && variable != TL_COMPLETE_DEFINITION_RYG_DIFF
             && variable != TL_CONTROLLED_LANES && variable != TL_CONTROLLED_LINKS
             && variable != TL_CURRENT_PHASE && variable != TL_CURRENT_PROGRAM
             && variable != TL_NEXT_SWITCH && variable != TL_PHASE_DURATION && variable != ID_COUNT
@@ -78,6 +86,18 @@ TraCIServerAPI_TrafficLight::processGet(TraCIServer& server, tcpip::Storage& inp
                 tempMsg.writeUnsignedByte(TYPE_STRING);
                 tempMsg.writeString(libsumo::TrafficLight::getRedYellowGreenState(id));
                 break;
+            case TL_COMPLETE_DEFINITION_RYG_DIFF: {
+                const std::string program = libsumo::TrafficLight::getProgram(id);
+                std::map<std::string, std::string>::const_iterator last = gSentPrograms.find(id);
+                if (last != gSentPrograms.end() && (*last).second == program) {
+                    // the program was sent before; the phase index is enough
+                    tempMsg.writeUnsignedByte(TYPE_INTEGER);
+                    tempMsg.writeInt(libsumo::TrafficLight::getPhase(id));
+                    break;
+                }
+                gSentPrograms[id] = program;
+            }
+            // FALLTHROUGH: send the complete definition
             case TL_COMPLETE_DEFINITION_RYG: {
                 std::vector<libsumo::TraCILogic> logics = libsumo::TrafficLight::getCompleteRedYellowGreenDefinition(id);
                 tempMsg.writeUnsignedByte(TYPE_COMPOUND);
@@ -362,6 +382,10 @@ TraCIServerAPI_TrafficLight::processSet(TraCIServer& server, tcpip::Storage& inp
             default:
                 break;
         }
+        if (variable == TL_PROGRAM || variable == TL_RED_YELLOW_GREEN_STATE || variable == TL_COMPLETE_PROGRAM_RYG) {
+            // the definition may have changed; the next diff retrieval must resend it
+            gSentPrograms.erase(id);
+        }
     } catch (libsumo::TraCIException& e) {
         return server.writeErrorStatusCmd(CMD_SET_TL_VARIABLE, e.what(), outputStorage);
     }
@@ -369,6 +393,12 @@ TraCIServerAPI_TrafficLight::processSet(TraCIServer& server, tcpip::Storage& inp
     return true;
 }
 
+
+void
+TraCIServerAPI_TrafficLight::clearSentPrograms() {
+    gSentPrograms.clear();
+}
+
 #endif
 
 
@@ -65,6 +65,14 @@ public:
                            tcpip::Storage& outputStorage);
 
 
+    /** @brief Forgets which definitions have been sent for the diff retrieval
+     *
+     * Called on simulation reload so that the next diff retrieval sends
+     *  the complete definitions again.
+     */
+    static void clearSentPrograms();
+
+
 private:
     /// @brief invalidated copy constructor
     TraCIServerAPI_TrafficLight(const TraCIServerAPI_TrafficLight& s);
@@ -38,6 +38,7 @@
 #include <unistd.h>
 #endif
 #include <fstream>
+#include <sys/stat.h>
 #include "FileHelpers.h"
 #include "StringTokenizer.h"
 #include "MsgHandler.h"
@@ -64,6 +65,16 @@ FileHelpers::isReadable(std::string path) {
 }
 
 
+long long int
+FileHelpers::getModifiedTime(const std::string& path) {
+    struct stat fileInfo;
+    if (stat(path.c_str(), &fileInfo) != 0) {
+        return -1;
+    }
+    return (long long int)fileInfo.st_mtime;
+}
+
+
 // ---------------------------------------------------------------------------
 // file path evaluating functions
 // ---------------------------------------------------------------------------
@@ -56,6 +56,14 @@ public:
      * @return Whether the named file is readable
      */
     static bool isReadable(std::string path);
+
+
+    /** @brief Returns the time of last modification of the given file
+     *
+     * @param[in] path The path of the file to examine
+     * @return The modification time (seconds since the epoch) or -1 if the file is not accessible
+     */
+    static long long int getModifiedTime(const std::string& path);
     //@}
 
 
@@ -0,0 +1,187 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2002-2017 German Aerospace Center (DLR) and others.
+/****************************************************************************/
+//
+//   This program and the accompanying materials
+//   are made available under the terms of the Eclipse Public License v2.0
+//   which accompanies this distribution, and is available at
+//   http://www.eclipse.org/legal/epl-v20.html
+//
+/****************************************************************************/
+/// @file    MemoryArena.h
+/// @date    2017
+/// @version $Id$
+///
+// A bump allocator for short-lived objects together with an stl-allocator
+/****************************************************************************/
+#ifndef MemoryArena_h
+#define MemoryArena_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cstddef>
+#include <vector>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class MemoryArena
+ * @brief A chunked bump allocator for transient objects
+ *
+ * Memory is handed out by advancing a pointer within preallocated chunks and
+ *  is never returned individually; instead the whole arena is reset at a
+ *  well-known point (i.e. the end of a simulation step) while the chunks are
+ *  kept for reuse. This removes malloc/free pressure for containers which
+ *  are rebuilt every step. Objects allocated from the arena must not be kept
+ *  beyond the reset.
+ */
+class MemoryArena {
+public:
+    /** @brief Constructor
+     *
+     * @param[in] chunkSize The size of the chunks to allocate (in bytes)
+     */
+    MemoryArena(const size_t chunkSize = 1 << 16)
+        : myChunkSize(chunkSize), myCurrentChunk(0), myOffset(0) {}
+
+    /// @brief Destructor
+    ~MemoryArena() {
+        reset();
+        for (std::vector<char*>::iterator it = myChunks.begin(); it != myChunks.end(); ++it) {
+            delete[] * it;
+        }
+    }
+
+    /** @brief Returns a pointer to the given number of bytes
+     *
+     * Allocations larger than the chunk size get a dedicated chunk.
+     *
+     * @param[in] size The number of bytes to allocate
+     * @return A pointer to uninitialized memory of the requested size
+     */
+    void* allocate(size_t size) {
+        // keep all allocations suitably aligned
+        size = (size + ALIGNMENT - 1) & ~(size_t)(ALIGNMENT - 1);
+        if (size > myChunkSize) {
+            // oversized request, gets a dedicated chunk which is freed on reset
+            char* const chunk = new char[size];
+            myLargeChunks.push_back(chunk);
+            return chunk;
+        }
+        if (myChunks.empty() || myOffset + size > myChunkSize) {
+            if (myCurrentChunk + 1 < (int)myChunks.size() && !myChunks.empty()) {
+                myCurrentChunk++;
+            } else {
+                myChunks.push_back(new char[myChunkSize]);
+                myCurrentChunk = (int)myChunks.size() - 1;
+            }
+            myOffset = 0;
+        }
+        char* const result = myChunks[myCurrentChunk] + myOffset;
+        myOffset += size;
+        return result;
+    }
+
+    /** @brief Invalidates all allocations, keeping the chunks for reuse
+     */
+    void reset() {
+        for (std::vector<char*>::iterator it = myLargeChunks.begin(); it != myLargeChunks.end(); ++it) {
+            delete[] * it;
+        }
+        myLargeChunks.clear();
+        myCurrentChunk = 0;
+        myOffset = 0;
+    }
+
+private:
+    /// @brief the alignment guaranteed for all allocations
+    static const size_t ALIGNMENT = 16;
+
+    /// @brief the size of a regular chunk
+    const size_t myChunkSize;
+
+    /// @brief the allocated chunks
+    std::vector<char*> myChunks;
+
+    /// @brief dedicated chunks for oversized requests (freed on reset)
+    std::vector<char*> myLargeChunks;
+
+    /// @brief the index of the chunk currently allocated from
+    int myCurrentChunk;
+
+    /// @brief the offset of the first free byte within the current chunk
+    size_t myOffset;
+
+private:
+    /// @brief invalidated copy constructor
+    MemoryArena(const MemoryArena& s);
+
+    /// @brief invalidated assignment operator
+    const MemoryArena& operator=(const MemoryArena& s);
+
+};
+
+
+/**
+ * @class ArenaAllocator
+ * @brief An stl-compatible allocator drawing from a MemoryArena
+ *
+ * Containers using this allocator must not outlive the next reset of the
+ *  underlying arena. deallocate is a no-op by design.
+ */
+template<class T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+
+    /// @brief Constructor
+    ArenaAllocator(MemoryArena& arena) : myArena(&arena) {}
+
+    /// @brief rebinding copy constructor
+    template<class U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : myArena(other.getArena()) {}
+
+    /// @brief allocates space for n objects from the arena
+    T* allocate(size_t n) {
+        return static_cast<T*>(myArena->allocate(n * sizeof(T)));
+    }
+
+    /// @brief no-op, the memory is reclaimed by the arena reset
+    void deallocate(T*, size_t) {}
+
+    /// @brief returns the underlying arena (for rebinding)
+    MemoryArena* getArena() const {
+        return myArena;
+    }
+
+    template<class U>
+    bool operator==(const ArenaAllocator<U>& other) const {
+        return myArena == other.getArena();
+    }
+
+    template<class U>
+    bool operator!=(const ArenaAllocator<U>& other) const {
+        return myArena != other.getArena();
+    }
+
+private:
+    /// @brief the arena to draw memory from
+    MemoryArena* myArena;
+
+};
+
+
+#endif
+
+/****************************************************************************/
@@ -0,0 +1,108 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2002-2017 German Aerospace Center (DLR) and others.
+/****************************************************************************/
+//
+//   This program and the accompanying materials
+//   are made available under the terms of the Eclipse Public License v2.0
+//   which accompanies this distribution, and is available at
+//   http://www.eclipse.org/legal/epl-v20.html
+//
+/****************************************************************************/
+/// @file    ObjectPool.h
+/// @date    2017-11-20
+/// @version $Id$
+///
+// A free list of fixed-size memory blocks for class-level operator new
+/****************************************************************************/
+#ifndef ObjectPool_h
+#define ObjectPool_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cstddef>
+#include <vector>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class ObjectPool
+ * @brief A free list of fixed-size memory blocks for class-level operator new
+ *
+ * Blocks returned via deallocate() are kept for reuse instead of going back
+ *  to the heap, so scenarios with high object turnover (i.e. many short
+ *  vehicle trips) neither churn nor fragment the allocator. The list grows
+ *  up to the peak number of concurrently allocated objects. Only blocks of
+ *  exactly sizeof(T) are managed; requests with other sizes (subclasses)
+ *  fall through to the global heap. Not thread-safe.
+ */
+template<typename T>
+class ObjectPool {
+public:
+    /** @brief Returns a block of the given size, reusing a pooled one if possible
+     *
+     * @param[in] size The requested block size
+     * @return A block of the requested size
+     */
+    static void* allocate(size_t size) {
+        if (size != sizeof(T) || myFreeBlocks.empty()) {
+            return ::operator new(size);
+        }
+        void* const block = myFreeBlocks.back();
+        myFreeBlocks.pop_back();
+        return block;
+    }
+
+
+    /** @brief Keeps the given block for reuse (or frees it if it has a foreign size)
+     *
+     * @param[in] block The block to return
+     * @param[in] size The size the block was allocated with
+     */
+    static void deallocate(void* block, size_t size) {
+        if (size != sizeof(T)) {
+            ::operator delete(block);
+        } else {
+            myFreeBlocks.push_back(block);
+        }
+    }
+
+
+    /// @brief Returns the number of blocks currently kept for reuse
+    static int getFreeBlockCount() {
+        return (int)myFreeBlocks.size();
+    }
+
+
+    /// @brief Returns all pooled blocks to the heap
+    static void clear() {
+        for (std::vector<void*>::iterator i = myFreeBlocks.begin(); i != myFreeBlocks.end(); ++i) {
+            ::operator delete(*i);
+        }
+        myFreeBlocks.clear();
+    }
+
+
+private:
+    /// @brief The blocks available for reuse
+    static std::vector<void*> myFreeBlocks;
+
+};
+
+template<typename T>
+std::vector<void*> ObjectPool<T>::myFreeBlocks;
+
+
+#endif
+
+/****************************************************************************/
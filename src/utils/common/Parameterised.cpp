@@ -50,12 +50,14 @@ Parameterised::Parameterised(const std::map<std::string, std::string>& mapArg)
 void
 Parameterised::setParameter(const std::string& key, const std::string& value) {
     myMap[key] = value;
+    myParsedDoubles.erase(key);
 }
 
 
 void
 Parameterised::unsetParameter(const std::string& key) {
     myMap.erase(key);
+    myParsedDoubles.erase(key);
 }
 
 
@@ -63,6 +65,7 @@ void
 Parameterised::updateParameter(const std::map<std::string, std::string>& mapArg) {
     for (std::map<std::string, std::string>::const_iterator i = mapArg.begin(); i != mapArg.end(); ++i) {
         myMap[(*i).first] = (*i).second;
+        myParsedDoubles.erase((*i).first);
     }
 }
 
@@ -85,9 +88,15 @@ Parameterised::getParameter(const std::string& key, const std::string& defaultVa
 
 double
 Parameterised::getDouble(const std::string& key, const double defaultValue) const {
+    std::map<std::string, double>::const_iterator cached = myParsedDoubles.find(key);
+    if (cached != myParsedDoubles.end()) {
+        return cached->second;
+    }
     std::map<std::string, std::string>::const_iterator i = myMap.find(key);
     if (i != myMap.end()) {
-        return TplConvert::_2double(i->second.c_str());
+        const double value = TplConvert::_2double(i->second.c_str());
+        myParsedDoubles[key] = value;
+        return value;
     }
     return defaultValue;
 }
@@ -96,6 +105,7 @@ Parameterised::getDouble(const std::string& key, const double defaultValue) cons
 void
 Parameterised::clearParameter() {
     myMap.clear();
+    myParsedDoubles.clear();
 }
 
 void
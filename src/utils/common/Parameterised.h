@@ -99,6 +99,10 @@ public:
 
 
     /** @brief Returns the value for a given key converted to a double
+     *
+     * The parsed value is cached so that repeated numeric queries for the
+     *  same key do not parse the string again.
+     *
      * @param[in] key The key to ask for
      * @param[in] defaultValue The default value to return if no value is stored under the key
      * @return The value stored under the key
@@ -125,6 +129,9 @@ private:
     /// @brief The key->value map
     std::map<std::string, std::string> myMap;
 
+    /// @brief Cache of the successfully parsed numeric values (only holds keys queried via getDouble)
+    mutable std::map<std::string, double> myParsedDoubles;
+
 };
 
 
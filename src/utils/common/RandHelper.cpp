@@ -38,6 +38,9 @@
 // static member variables
 // ===========================================================================
 std::mt19937 RandHelper::myRandomNumberGenerator;
+unsigned int RandHelper::myAppliedSeed = 23423;
+std::map<std::string, std::mt19937> RandHelper::myNamedGenerators;
+thread_local std::mt19937* RandHelper::myThreadRNG(0);
 
 
 // ===========================================================================
@@ -64,14 +67,32 @@ RandHelper::initRand(std::mt19937* which, const bool random, const int seed) {
     if (which == 0) {
         which = &myRandomNumberGenerator;
     }
-    if (random) {
-        which->seed((unsigned long)time(0));
-    } else {
-        which->seed(seed);
+    const unsigned int usedSeed = random ? (unsigned int)time(0) : (unsigned int)seed;
+    which->seed(usedSeed);
+    if (which == &myRandomNumberGenerator) {
+        // remember the seed so named streams derive from the same run setup
+        myAppliedSeed = usedSeed;
+        myNamedGenerators.clear();
     }
 }
 
 
+std::mt19937*
+RandHelper::getNamedRNG(const std::string& name) {
+    std::map<std::string, std::mt19937>::iterator it = myNamedGenerators.find(name);
+    if (it == myNamedGenerators.end()) {
+        // FNV-1a hash of the name; stable across platforms so streams are
+        //  bit-identical everywhere for the same seed and name
+        unsigned int hash = 2166136261u;
+        for (std::string::const_iterator c = name.begin(); c != name.end(); ++c) {
+            hash = (hash ^ (unsigned char)*c) * 16777619u;
+        }
+        it = myNamedGenerators.insert(std::make_pair(name, std::mt19937(hash ^ myAppliedSeed))).first;
+    }
+    return &it->second;
+}
+
+
 void
 RandHelper::initRandGlobal(std::mt19937* which) {
     OptionsCont& oc = OptionsCont::getOptions();
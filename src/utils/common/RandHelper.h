@@ -32,6 +32,8 @@
 #endif
 
 #include <cassert>
+#include <map>
+#include <string>
 #include <vector>
 #include <random>
 
@@ -60,10 +62,38 @@ public:
     /// @brief Reads the given random number options and initialises the random number generator in accordance
     static void initRandGlobal(std::mt19937* which = 0);
 
+    /** @brief Returns the random number generator for the given stream name
+     *
+     * The stream is created on first use and seeded from the global seed
+     *  combined with a stable hash of the name, so the sequence it produces
+     *  depends only on the configured seed and the name. Owners (a lane, a
+     *  vehicle id, ...) drawing from their own stream therefore get
+     *  reproducible numbers regardless of the order in which other streams
+     *  are used, which is a prerequisite for parallel execution modes.
+     *
+     * Creating a stream is not thread-safe; streams used from parallel code
+     *  must be requested while still running single-threaded.
+     *
+     * @param[in] name The name of the stream
+     * @return the generator belonging to the named stream
+     */
+    static std::mt19937* getNamedRNG(const std::string& name);
+
+    /** @brief Sets the generator the calling thread uses when none is given explicitly
+     *
+     * Worker threads of parallel phases install their own stream here so
+     *  that no two threads ever advance the same generator.
+     *
+     * @param[in] rng The generator to use (0 restores the global generator)
+     */
+    static void setThreadRNG(std::mt19937* rng) {
+        myThreadRNG = rng;
+    }
+
     /// @brief Returns a random real number in [0, 1)
     static inline double rand(std::mt19937* rng = 0) {
         if (rng == 0) {
-            rng = &myRandomNumberGenerator;
+            rng = defaultRNG();
         }
         return double((*rng)() / 4294967296.0);
     }
@@ -81,7 +111,7 @@ public:
     /// @brief Returns a random integer in [0, maxV-1]
     static inline int rand(int maxV, std::mt19937* rng = 0) {
         if (rng == 0) {
-            rng = &myRandomNumberGenerator;
+            rng = defaultRNG();
         }
         unsigned int usedBits = maxV - 1;
         usedBits |= usedBits >> 1;
@@ -109,7 +139,7 @@ public:
             return rand((int)maxV, rng);
         }
         if (rng == 0) {
-            rng = &myRandomNumberGenerator;
+            rng = defaultRNG();
         }
         unsigned long long int usedBits = maxV - 1;
         usedBits |= usedBits >> 1;
@@ -153,10 +183,25 @@ public:
     }
 
 
+protected:
+    /// @brief Returns the generator for the calling thread when none was given
+    static inline std::mt19937* defaultRNG() {
+        return myThreadRNG != 0 ? myThreadRNG : &myRandomNumberGenerator;
+    }
+
 protected:
     /// @brief the random number generator to use
     static std::mt19937 myRandomNumberGenerator;
 
+    /// @brief the per-thread override for the default generator
+    static thread_local std::mt19937* myThreadRNG;
+
+    /// @brief the seed the global generator was initialised with
+    static unsigned int myAppliedSeed;
+
+    /// @brief the named generators for independent, reproducible streams
+    static std::map<std::string, std::mt19937> myNamedGenerators;
+
 };
 
 #endif
@@ -37,6 +37,7 @@
 // type definitions
 // ===========================================================================
 SUMOTime DELTA_T = 1000;
+double TS = 1.;
 
 
 // ===========================================================================
@@ -47,8 +47,9 @@ typedef long long int SUMOTime;
 // the step length in ms
 extern SUMOTime DELTA_T;
 
-// the step length in seconds as double
-#define TS (static_cast<double>(DELTA_T/1000.))
+// the step length in seconds as double (cached whenever DELTA_T is set since
+// the conversion from ms is on the hot path of the movement model)
+extern double TS;
 
 // x*deltaT
 #define SPEED2DIST(x) ((x)*TS)
@@ -27,10 +27,14 @@
 #endif
 
 #include <stdlib.h>
+#include <utils/common/StdDefs.h>
 #include "SysUtils.h"
 
 #ifndef WIN32
 #include <sys/time.h>
+#include <sys/resource.h>
+#include <fcntl.h>
+#include <unistd.h>
 #else
 #define NOMINMAX
 #include <windows.h>
@@ -58,6 +62,58 @@ SysUtils::getCurrentMillis() {
 }
 
 
+long long
+SysUtils::getCurrentMicros() {
+#ifndef WIN32
+    timeval current;
+    gettimeofday(&current, 0);
+    return (long long) current.tv_sec * 1000000LL + (long long) current.tv_usec;
+#else
+    LARGE_INTEGER val, val2;
+    BOOL check = QueryPerformanceCounter(&val);
+    check = QueryPerformanceFrequency(&val2);
+    return (long long)(val.QuadPart * 1000000 / val2.QuadPart);
+#endif
+}
+
+
+long
+SysUtils::getPeakMemoryKBytes() {
+#ifndef WIN32
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+#ifdef __APPLE__
+    // ru_maxrss is given in bytes on OS X
+    return (long)(usage.ru_maxrss / 1024);
+#else
+    return (long)usage.ru_maxrss;
+#endif
+#else
+    // would need GetProcessMemoryInfo (psapi)
+    return -1;
+#endif
+}
+
+
+void
+SysUtils::advisePrefetch(const std::string& file) {
+#ifndef WIN32
+    const int fd = open(file.c_str(), O_RDONLY);
+    if (fd >= 0) {
+#ifdef POSIX_FADV_WILLNEED
+        posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+#endif
+        close(fd);
+    }
+#else
+    // no read-ahead advice available
+    UNUSED_PARAMETER(file);
+#endif
+}
+
+
 #ifdef _MSC_VER
 long
 SysUtils::getWindowsTicks() {
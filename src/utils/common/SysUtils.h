@@ -45,6 +45,30 @@ public:
     static long getCurrentMillis();
 
 
+    /** @brief Returns the current time in microseconds
+     *
+     * Used where millisecond resolution is too coarse (e.g. timing the
+     *  phases of a single simulation step)
+     * @return Current time
+     */
+    static long long getCurrentMicros();
+
+
+    /** @brief Returns the peak resident set size of this process in kibibytes
+     * @return The peak RSS or -1 if it cannot be determined on this platform
+     */
+    static long getPeakMemoryKBytes();
+
+
+    /** @brief Advises the operating system to read the given file into the page cache
+     *
+     * The read-ahead proceeds asynchronously in the kernel; a no-op on
+     *  platforms without posix_fadvise
+     * @param[in] file The file to prefetch
+     */
+    static void advisePrefetch(const std::string& file);
+
+
 #ifdef _MSC_VER
     /** @brief Returns the CPU ticks (windows only)
      *
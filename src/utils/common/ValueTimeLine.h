@@ -25,7 +25,8 @@
 // ===========================================================================
 // included modules
 // ===========================================================================
-#include <map>
+#include <vector>
+#include <algorithm>
 #include <cassert>
 #include <utility>
 #include <utils/common/SUMOTime.h>
@@ -47,6 +48,10 @@
  * with assigned values. The container is sorted by the first value of the
  * time-range while being filled. Every new inserted time range
  * may overwrite or split one or multiple earlier intervals.
+ *
+ * The entries are kept in a contiguous sorted vector so that one instance
+ * per edge stays affordable even for large networks; retrieval is a plain
+ * binary search over the flat array.
  */
 template<typename T>
 class ValueTimeLine {
@@ -69,26 +74,24 @@ public:
         assert(begin >= 0);
         assert(begin < end);
         // inserting strictly before the first or after the last interval (includes empty case)
-        if (myValues.upper_bound(begin) == myValues.end() ||
-                myValues.upper_bound(end) == myValues.begin()) {
-            myValues[begin] = std::make_pair(true, value);
-            myValues[end] = std::make_pair(false, value);
+        if (std::upper_bound(myValues.begin(), myValues.end(), begin, TimeComparator()) == myValues.end() ||
+                std::upper_bound(myValues.begin(), myValues.end(), end, TimeComparator()) == myValues.begin()) {
+            set(begin, std::make_pair(true, value));
+            set(end, std::make_pair(false, value));
             return;
         }
         // our end already has a value
-        typename TimedValueMap::iterator endIt = myValues.find(end);
-        if (endIt != myValues.end()) {
-            myValues.erase(myValues.upper_bound(begin), endIt);
-            myValues[begin] = std::make_pair(true, value);
+        typename TimedValueVector::iterator endIt = std::lower_bound(myValues.begin(), myValues.end(), end, TimeComparator());
+        if (endIt != myValues.end() && endIt->first == end) {
+            myValues.erase(std::upper_bound(myValues.begin(), myValues.end(), begin, TimeComparator()), endIt);
+            set(begin, std::make_pair(true, value));
             return;
         }
         // we have at least one entry strictly before our end
-        endIt = myValues.lower_bound(end);
-        --endIt;
-        ValidValue oldEndValue = endIt->second;
-        myValues.erase(myValues.upper_bound(begin), myValues.lower_bound(end));
-        myValues[begin] = std::make_pair(true, value);
-        myValues[end] = oldEndValue;
+        const ValidValue oldEndValue = (endIt - 1)->second;
+        myValues.erase(std::upper_bound(myValues.begin(), myValues.end(), begin, TimeComparator()), endIt);
+        set(begin, std::make_pair(true, value));
+        set(end, oldEndValue);
     }
 
     /** @brief Returns the value for the given time.
@@ -101,7 +104,7 @@ public:
      */
     T getValue(double time) const {
         assert(myValues.size() != 0);
-        typename TimedValueMap::const_iterator it = myValues.upper_bound(time);
+        typename TimedValueVector::const_iterator it = std::upper_bound(myValues.begin(), myValues.end(), time, TimeComparator());
         assert(it != myValues.begin());
         --it;
         return it->second.second;
@@ -118,7 +121,7 @@ public:
      * @return whether a valid value was set
      */
     bool describesTime(double time) const {
-        typename TimedValueMap::const_iterator afterIt = myValues.upper_bound(time);
+        typename TimedValueVector::const_iterator afterIt = std::upper_bound(myValues.begin(), myValues.end(), time, TimeComparator());
         if (afterIt == myValues.begin()) {
             return false;
         }
@@ -137,8 +140,8 @@ public:
      * @return the split point
      */
     double getSplitTime(double low, double high) const {
-        typename TimedValueMap::const_iterator afterLow = myValues.upper_bound(low);
-        typename TimedValueMap::const_iterator afterHigh = myValues.upper_bound(high);
+        typename TimedValueVector::const_iterator afterLow = std::upper_bound(myValues.begin(), myValues.end(), low, TimeComparator());
+        typename TimedValueVector::const_iterator afterHigh = std::upper_bound(myValues.begin(), myValues.end(), high, TimeComparator());
         --afterHigh;
         if (afterLow == afterHigh) {
             return afterLow->first;
@@ -152,30 +155,57 @@ public:
      * @param[in] extendOverBoundaries whether the first/last value should be valid for later / earlier times as well
      */
     void fillGaps(T value, bool extendOverBoundaries = false) {
-        for (typename TimedValueMap::iterator it = myValues.begin(); it != myValues.end(); ++it) {
+        for (typename TimedValueVector::iterator it = myValues.begin(); it != myValues.end(); ++it) {
             if (!it->second.first) {
                 it->second.second = value;
             }
         }
         if (extendOverBoundaries && !myValues.empty()) {
-            typename TimedValueMap::iterator it = --myValues.end();
+            typename TimedValueVector::iterator it = myValues.end() - 1;
             if (!it->second.first) {
                 myValues.erase(it, myValues.end());
             }
             value = myValues.begin()->second.second;
         }
-        myValues[-1] = std::make_pair(false, value);
+        set(-1, std::make_pair(false, value));
     }
 
 private:
     /// @brief Value of time line, indicating validity.
     typedef std::pair<bool, T> ValidValue;
 
-    /// @brief Sorted map from start of intervals to values.
-    typedef std::map<double, ValidValue> TimedValueMap;
+    /// @brief Sorted vector of interval begins and values.
+    typedef std::vector<std::pair<double, ValidValue> > TimedValueVector;
+
+    /// @brief Comparing entries and time points against each other
+    struct TimeComparator {
+        bool operator()(const std::pair<double, ValidValue>& entry, double time) const {
+            return entry.first < time;
+        }
+        bool operator()(double time, const std::pair<double, ValidValue>& entry) const {
+            return time < entry.first;
+        }
+    };
+
+    /** @brief Inserts a value at the given time, overwriting an existing entry.
+     *
+     * This mimics insertion into the former map representation; loading
+     *  weights in ascending time order amounts to appending at the back.
+     *
+     * @param[in] time the entry time
+     * @param[in] value the value to store together with its validity
+     */
+    void set(double time, const ValidValue& value) {
+        typename TimedValueVector::iterator it = std::lower_bound(myValues.begin(), myValues.end(), time, TimeComparator());
+        if (it != myValues.end() && it->first == time) {
+            it->second = value;
+        } else {
+            myValues.insert(it, std::make_pair(time, value));
+        }
+    }
 
     /// @brief The list of time periods (with values)
-    TimedValueMap myValues;
+    TimedValueVector myValues;
 
 };
 
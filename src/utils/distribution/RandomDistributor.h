@@ -33,6 +33,8 @@
 
 #include <cassert>
 #include <limits>
+#include <vector>
+#include <algorithm>
 #include <utils/common/RandHelper.h>
 #include <utils/common/UtilExceptions.h>
 
@@ -77,6 +79,7 @@ public:
     bool add(T val, double prob, bool checkDuplicates = true) {
         assert(prob >= 0);
         myProb += prob;
+        myCumulated.clear();
         if (checkDuplicates) {
             for (int i = 0; i < (int)myVals.size(); i++) {
                 if (val == myVals[i]) {
@@ -101,14 +104,22 @@ public:
         if (myProb == 0) {
             throw OutOfBoundsException();
         }
-        double prob = RandHelper::rand(myProb, which);
-        for (int i = 0; i < (int)myVals.size(); i++) {
-            if (prob < myProbs[i]) {
-                return myVals[i];
+        if (myCumulated.size() != myProbs.size()) {
+            // (re)build the cumulated probabilities; add() invalidates them
+            myCumulated.clear();
+            double sum = 0;
+            for (int i = 0; i < (int)myProbs.size(); i++) {
+                sum += myProbs[i];
+                myCumulated.push_back(sum);
             }
-            prob -= myProbs[i];
         }
-        return myVals.back();
+        const double prob = RandHelper::rand(myProb, which);
+        const int index = (int)(std::upper_bound(myCumulated.begin(), myCumulated.end(), prob) - myCumulated.begin());
+        if (index == (int)myVals.size()) {
+            // rounding may let the draw exceed the last cumulated entry
+            return myVals.back();
+        }
+        return myVals[index];
     }
 
     /** @brief Return the sum of the probabilites assigned to the members.
@@ -126,6 +137,7 @@ public:
         myProb = 0;
         myVals.clear();
         myProbs.clear();
+        myCumulated.clear();
     }
 
     /** @brief Returns the members of the distribution.
@@ -157,6 +169,8 @@ private:
     std::vector<T> myVals;
     /// @brief the corresponding probabilities
     std::vector<double> myProbs;
+    /// @brief the cumulated probabilities, built lazily on the first draw
+    mutable std::vector<double> myCumulated;
 
 };
 
@@ -66,36 +66,40 @@ HelpersEnergy::compute(const SUMOEmissionClass /* c */, const PollutantsInterfac
 
     const double lastV = v - ACCEL2SPEED(a);
     const double mass = param->find(SUMO_ATTR_VEHICLEMASS)->second;
+    // the distance driven in this step enters all distance-based loss terms
+    const double dist = SPEED2DIST(v);
+    // kinetic energy difference of vehicle and internal rotating elements
+    const double speedSqDiff = v * v - lastV * lastV;
 
-    // calculate potential energy difference
-    double energyDiff = mass * 9.81 * sin(DEG2RAD(slope)) * SPEED2DIST(v);
+    // calculate potential energy difference (skipping the sine on level roads)
+    double energyDiff = slope == 0. ? 0. : mass * 9.81 * sin(DEG2RAD(slope)) * dist;
 
     // kinetic energy difference of vehicle
-    energyDiff += 0.5 * mass * (v * v - lastV * lastV);
+    energyDiff += 0.5 * mass * speedSqDiff;
 
     // add rotational energy diff of internal rotating elements
-    energyDiff += param->find(SUMO_ATTR_INTERNALMOMENTOFINERTIA)->second * (v * v - lastV * lastV);
+    energyDiff += param->find(SUMO_ATTR_INTERNALMOMENTOFINERTIA)->second * speedSqDiff;
 
     // Energy loss through Air resistance [Ws]
     // Calculate energy losses:
     // EnergyLoss,Air = 1/2 * rho_air [kg/m^3] * myFrontSurfaceArea [m^2] * myAirDragCoefficient [-] * v_Veh^2 [m/s] * s [m]
     //                    ... with rho_air [kg/m^3] = 1,2041 kg/m^3 (at T = 20C)
     //                    ... with s [m] = v_Veh [m/s] * TS [s]
-    energyDiff += 0.5 * 1.2041 * param->find(SUMO_ATTR_FRONTSURFACEAREA)->second * param->find(SUMO_ATTR_AIRDRAGCOEFFICIENT)->second * v * v * SPEED2DIST(v);
+    energyDiff += 0.5 * 1.2041 * param->find(SUMO_ATTR_FRONTSURFACEAREA)->second * param->find(SUMO_ATTR_AIRDRAGCOEFFICIENT)->second * v * v * dist;
 
     // Energy loss through Roll resistance [Ws]
     //                    ... (fabs(veh.getSpeed())>=0.01) = 0, if vehicle isn't moving
     // EnergyLoss,Tire = c_R [-] * F_N [N] * s [m]
     //                    ... with c_R = ~0.012    (car tire on asphalt)
     //                    ... with F_N [N] = myMass [kg] * g [m/s^2]
-    energyDiff += param->find(SUMO_ATTR_ROLLDRAGCOEFFICIENT)->second * 9.81 * mass * SPEED2DIST(v);
+    energyDiff += param->find(SUMO_ATTR_ROLLDRAGCOEFFICIENT)->second * 9.81 * mass * dist;
 
     // Energy loss through friction by radial force [Ws]
     // If angle of vehicle was changed
     const double angleDiff = param->find(SUMO_ATTR_ANGLE)->second;
     if (angleDiff != 0.) {
         // Compute new radio
-        double radius = SPEED2DIST(v) / fabs(angleDiff);
+        double radius = dist / fabs(angleDiff);
 
         // Check if radius is in the interval [0.0001 - 10000] (To avoid overflow and division by zero)
         if (radius < 0.0001) {
@@ -92,6 +92,51 @@ public:
     }
 
 
+    /** @brief Computes the amounts of all emitted pollutants in one pass
+     *
+     * The speed powers and the slope angle are shared by all six pollutant
+     *  functions, so they are computed once here and the parameter rows are
+     *  evaluated in a vectorizable loop instead of calling compute per pollutant.
+     *
+     * @param[in] c emission class for the function parameters to use
+     * @param[in] v The vehicle's current velocity
+     * @param[in] a The vehicle's current acceleration
+     * @param[in] slope The road's slope at vehicle's position [deg]
+     * @return The amounts emitted by the given emission class when moving with the given velocity and acceleration [mg/s or ml/s]
+     */
+    inline PollutantsInterface::Emissions computeAll(const SUMOEmissionClass c, const double v, const double a, const double slope, const std::map<int, double>* param) const {
+        UNUSED_PARAMETER(slope);
+        UNUSED_PARAMETER(param);
+        if (c == PollutantsInterface::ZERO_EMISSIONS) {
+            return PollutantsInterface::Emissions();
+        }
+        const int index = (c & ~PollutantsInterface::HEAVY_BIT) - 1;
+        const double kmh = v * 3.6;
+        const double kmh2 = kmh * kmh;
+        const double kmh3 = kmh2 * kmh;
+        double amounts[6];
+        if (index >= 42) {
+            const double* f = myFunctionParameter[index - 42];
+            for (int e = 0; e < 6; e++, f += 6) {
+                amounts[e] = MAX2((f[0] + f[3] * kmh + f[4] * kmh2 + f[5] * kmh3) / 3.6, 0.);
+            }
+        } else {
+            if (a < 0.) {
+                return PollutantsInterface::Emissions();
+            }
+            const double alpha = asin(a / 9.81) * 180. / M_PI;
+            const double alphaKmh = alpha * kmh;
+            const double alpha2Kmh = alpha * alphaKmh;
+            const double* f = myFunctionParameter[index];
+            for (int e = 0; e < 6; e++, f += 6) {
+                amounts[e] = MAX2((f[0] + f[1] * alphaKmh + f[2] * alpha2Kmh + f[3] * kmh + f[4] * kmh2 + f[5] * kmh3) / 3.6, 0.);
+            }
+        }
+        return PollutantsInterface::Emissions(amounts[PollutantsInterface::CO2], amounts[PollutantsInterface::CO], amounts[PollutantsInterface::HC],
+                                              amounts[PollutantsInterface::FUEL] / 790., amounts[PollutantsInterface::NO_X], amounts[PollutantsInterface::PM_X]);
+    }
+
+
 private:
     /// @brief The function parameter
     static double myFunctionParameter[42][36];
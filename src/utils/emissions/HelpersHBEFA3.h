@@ -124,6 +124,40 @@ public:
     }
 
 
+    /** @brief Computes the amounts of all emitted pollutants in one pass
+     *
+     * The speed and acceleration products are shared by all six pollutant
+     *  functions, so they are computed once here and the parameter rows are
+     *  evaluated in a vectorizable loop instead of calling compute per pollutant.
+     *
+     * @param[in] c emission class for the function parameters to use
+     * @param[in] v The vehicle's current velocity
+     * @param[in] a The vehicle's current acceleration
+     * @param[in] slope The road's slope at vehicle's position [deg]
+     * @return The amounts emitted by the given emission class when moving with the given velocity and acceleration [mg/s or ml/s]
+     */
+    inline PollutantsInterface::Emissions computeAll(const SUMOEmissionClass c, const double v, const double a, const double slope, const std::map<int, double>* param) const {
+        UNUSED_PARAMETER(slope);
+        UNUSED_PARAMETER(param);
+        if (c == HBEFA3_BASE || a < 0.) {
+            return PollutantsInterface::Emissions();
+        }
+        const int index = (c & ~PollutantsInterface::HEAVY_BIT) - HBEFA3_BASE - 1;
+        const double av = a * v;
+        const double aav = a * av;
+        const double v2 = v * v;
+        const double v3 = v2 * v;
+        double amounts[6];
+        for (int e = 0; e < 6; e++) {
+            const double* f = myFunctionParameter[index][e];
+            amounts[e] = MAX2((f[0] + f[1] * av + f[2] * aav + f[3] * v + f[4] * v2 + f[5] * v3) / 3.6, 0.);
+        }
+        const double fuelScale = getFuel(c) == "Diesel" ? 836. : 742.;
+        return PollutantsInterface::Emissions(amounts[PollutantsInterface::CO2], amounts[PollutantsInterface::CO], amounts[PollutantsInterface::HC],
+                                              amounts[PollutantsInterface::FUEL] / fuelScale, amounts[PollutantsInterface::NO_X], amounts[PollutantsInterface::PM_X]);
+    }
+
+
 private:
     /// @brief The function parameter
     static double myFunctionParameter[45][6][6];
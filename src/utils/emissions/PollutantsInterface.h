@@ -232,6 +232,24 @@ public:
          */
         virtual double compute(const SUMOEmissionClass c, const EmissionType e, const double v, const double a, const double slope, const std::map<int, double>* param) const = 0;
 
+        /** @brief Returns the amounts of all emitted pollutants given the vehicle type and state (in mg/s or ml/s for fuel)
+         *
+         * The default implementation computes each pollutant separately; models
+         *  whose per-pollutant functions share common subterms should override
+         *  this to evaluate all of them in a single pass.
+         *
+         * @param[in] c The vehicle emission class
+         * @param[in] v The vehicle's current velocity
+         * @param[in] a The vehicle's current acceleration
+         * @param[in] slope The road's slope at vehicle's position [deg]
+         * @return The amounts emitted by the given emission class when moving with the given velocity and acceleration [mg/s or ml/s]
+         */
+        virtual Emissions computeAll(const SUMOEmissionClass c, const double v, const double a, const double slope, const std::map<int, double>* param) const {
+            return Emissions(compute(c, CO2, v, a, slope, param), compute(c, CO, v, a, slope, param), compute(c, HC, v, a, slope, param),
+                             compute(c, FUEL, v, a, slope, param), compute(c, NO_X, v, a, slope, param), compute(c, PM_X, v, a, slope, param),
+                             compute(c, ELEC, v, a, slope, param));
+        }
+
         /** @brief Returns the adapted acceleration value, useful for comparing with external PHEMlight references.
          * Default implementation returns always the input accel.
          * @param[in] c the emission class
@@ -34,11 +34,49 @@
 #include <vector>
 #include <fx.h>
 #include <FXThread.h>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+#include <utils/common/StdDefs.h>
 
 
 // ===========================================================================
 // class definitions
 // ===========================================================================
+/**
+ * @class FXConditionalLock
+ * @brief A scoped lock which only locks on demand
+ *
+ * Spares the locking overhead when the code also runs single threaded.
+ */
+class FXConditionalLock {
+public:
+    /// @brief Constructor, locks the mutex if the given condition is true
+    FXConditionalLock(FXMutex& mutex, const bool condition)
+        : myMutex(mutex), myCondition(condition) {
+        if (condition) {
+            mutex.lock();
+        }
+    }
+
+    /// @brief Destructor, unlocks the mutex if it was locked
+    ~FXConditionalLock() {
+        if (myCondition) {
+            myMutex.unlock();
+        }
+    }
+
+private:
+    FXMutex& myMutex;
+    const bool myCondition;
+
+private:
+    /// @brief Invalidated assignment operator
+    FXConditionalLock& operator=(const FXConditionalLock&);
+};
+
+
 /**
  * @class FXWorkerThread
  * @brief A thread repeatingly calculating incoming tasks
@@ -219,11 +257,14 @@ public:
 public:
     /** @brief Constructor
      *
-     * Adds the thread to the given pool and starts it.
+     * Adds the thread to the given pool and starts it. If a logical
+     *  processor index is given, the thread pins itself to that processor
+     *  (modulo the processor count) before running the first task.
      *
      * @param[in] pool the pool for this thread
+     * @param[in] cpu the logical processor to pin this thread to (-1 for no pinning)
      */
-    FXWorkerThread(Pool& pool): FXThread(), myPool(pool), myStopped(false), myCounter(0) {
+    FXWorkerThread(Pool& pool, int cpu = -1): FXThread(), myPool(pool), myRequestedCpu(cpu), myStopped(false), myCounter(0) {
         pool.addWorker(this);
         start();
     }
@@ -254,6 +295,9 @@ public:
      * @return always 0
      */
     FXint run() {
+        if (myRequestedCpu >= 0) {
+            pinSelfToCpu(myRequestedCpu);
+        }
         while (!myStopped) {
             myMutex.lock();
             while (!myStopped && myTasks.empty()) {
@@ -287,9 +331,31 @@ public:
         join();
     }
 
+private:
+    /** @brief Pins the calling thread to the given logical processor (best effort)
+     *
+     * On platforms without a known affinity interface this is a no-op.
+     *
+     * @param[in] cpu the logical processor index (wraps around at the processor count)
+     */
+    static void pinSelfToCpu(int cpu) {
+#if defined(__linux__)
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpu % CPU_SETSIZE, &cpuSet);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+#elif defined(WIN32)
+        SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << (cpu % (8 * sizeof(DWORD_PTR))));
+#else
+        UNUSED_PARAMETER(cpu);
+#endif
+    }
+
 private:
     /// @brief the pool for this thread
     Pool& myPool;
+    /// @brief the logical processor this thread pins itself to (-1 for none)
+    const int myRequestedCpu;
     /// @brief the mutex for the task list
     FXMutex myMutex;
     /// @brief the semaphore when waiting for new tasks
@@ -33,6 +33,7 @@
 #include <cmath>
 #include <cassert>
 #include <climits>
+#include <vector>
 #include <utils/common/MsgHandler.h>
 #include <utils/common/ToString.h>
 #include <utils/geom/GeomHelper.h>
@@ -324,6 +325,46 @@ GeoConvHelper::x2cartesian(Position& from, bool includeInBoundary) {
 }
 
 
+bool
+GeoConvHelper::x2cartesian(PositionVector& cont, bool includeInBoundary) {
+    bool ok = true;
+#ifdef HAVE_PROJ
+    if (myInverseProjection != 0 && cont.size() > 1) {
+        // the per-point method would issue one transformation call per
+        //  position; hand the whole shape to proj at once instead
+        std::vector<double> xCoords(cont.size());
+        std::vector<double> yCoords(cont.size());
+        for (int i = 0; i < (int)cont.size(); ++i) {
+            if (includeInBoundary) {
+                myOrigBoundary.add(cont[i]);
+            }
+            xCoords[i] = cont[i].x();
+            yCoords[i] = cont[i].y();
+        }
+        if (pj_transform(myInverseProjection, myGeoProjection, (long)cont.size(), 1, &xCoords[0], &yCoords[0], NULL)) {
+            WRITE_WARNING("Could not transform shape of " + toString(cont.size()) + " points starting at (" + toString(cont[0].x()) + "," + toString(cont[0].y()) + ")");
+        }
+        for (int i = 0; i < (int)cont.size(); ++i) {
+            cont[i].set(double(xCoords[i] * RAD_TO_DEG), double(yCoords[i] * RAD_TO_DEG));
+            if (x2cartesian_const(cont[i])) {
+                if (includeInBoundary) {
+                    myConvBoundary.add(cont[i]);
+                }
+            } else {
+                ok = false;
+            }
+        }
+        return ok;
+    }
+#endif
+    // the projection may still need lazy initialisation from the first point
+    for (int i = 0; i < (int)cont.size(); ++i) {
+        ok &= x2cartesian(cont[i], includeInBoundary);
+    }
+    return ok;
+}
+
+
 bool
 GeoConvHelper::x2cartesian_const(Position& from) const {
     double x = from.x() * myGeoScale;
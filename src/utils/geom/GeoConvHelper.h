@@ -120,6 +120,11 @@ public:
      */
     bool x2cartesian(Position& from, bool includeInBoundary = true);
 
+    /**@brief Converts all coordinates of the given shape into cartesian coordinates
+     * @note shapes from projected input are transformed with a single projection call
+     */
+    bool x2cartesian(PositionVector& cont, bool includeInBoundary = true);
+
     /// @brief Converts the given coordinate into a cartesian using the previous initialisation
     bool x2cartesian_const(Position& from) const;
 
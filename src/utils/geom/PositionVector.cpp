@@ -737,9 +737,34 @@ PositionVector::nearest_offset_to_point2D(const Position& p, bool perpendicular)
     double nearestPos = GeomHelper::INVALID_OFFSET;
     double seen = 0;
     for (const_iterator i = begin(); i != end() - 1; i++) {
-        const double pos =
-            GeomHelper::nearest_offset_on_line_to_point2D(*i, *(i + 1), p, perpendicular);
-        const double dist = pos == GeomHelper::INVALID_OFFSET ? minDist : p.distanceTo2D(positionAtOffset2D(*i, *(i + 1), pos));
+        // the projection is inlined here to avoid temporary Positions and
+        //  redundant square roots in this hot loop
+        const double dx = (*(i + 1)).x() - (*i).x();
+        const double dy = (*(i + 1)).y() - (*i).y();
+        const double length2 = dx * dx + dy * dy;
+        const double length = sqrt(length2);
+        double pos = 0.;
+        double relPos = 0.;
+        if (length2 != 0.) {
+            const double u = ((p.x() - (*i).x()) * dx + (p.y() - (*i).y()) * dy) / length2;
+            if (u < 0. || u > 1.) {
+                if (perpendicular) {
+                    pos = GeomHelper::INVALID_OFFSET;
+                } else if (u > 1.) {
+                    pos = length;
+                    relPos = 1.;
+                }
+            } else {
+                pos = u * length;
+                relPos = u;
+            }
+        }
+        double dist = minDist;
+        if (pos != GeomHelper::INVALID_OFFSET) {
+            const double distX = p.x() - ((*i).x() + relPos * dx);
+            const double distY = p.y() - ((*i).y() + relPos * dy);
+            dist = sqrt(distX * distX + distY * distY);
+        }
         if (dist < minDist) {
             nearestPos = pos + seen;
             minDist = dist;
@@ -758,7 +783,7 @@ PositionVector::nearest_offset_to_point2D(const Position& p, bool perpendicular)
                 }
             }
         }
-        seen += (*i).distanceTo2D(*(i + 1));
+        seen += length;
     }
     return nearestPos;
 }
@@ -1289,6 +1314,51 @@ PositionVector::simplified() const {
 }
 
 
+PositionVector
+PositionVector::simplified(const double maxError) const {
+    if (size() < 3) {
+        return *this;
+    }
+    std::vector<bool> keep(size(), false);
+    keep.front() = true;
+    keep.back() = true;
+    std::vector<std::pair<int, int> > toCheck;
+    toCheck.push_back(std::make_pair(0, (int)size() - 1));
+    while (!toCheck.empty()) {
+        const int first = toCheck.back().first;
+        const int last = toCheck.back().second;
+        toCheck.pop_back();
+        const Position& p1 = (*this)[first];
+        const Position& p2 = (*this)[last];
+        double maxDist = 0.;
+        int maxIndex = -1;
+        for (int i = first + 1; i < last; i++) {
+            const Position& p0 = (*this)[i];
+            // distance to the segment (not the infinite line) so that the
+            // error bound also holds for points beyond the segment ends
+            const double offset = GeomHelper::nearest_offset_on_line_to_point2D(p1, p2, p0, false);
+            const double dist = p0.distanceTo2D(positionAtOffset2D(p1, p2, offset));
+            if (dist > maxDist) {
+                maxDist = dist;
+                maxIndex = i;
+            }
+        }
+        if (maxDist > maxError) {
+            keep[maxIndex] = true;
+            toCheck.push_back(std::make_pair(first, maxIndex));
+            toCheck.push_back(std::make_pair(maxIndex, last));
+        }
+    }
+    PositionVector result;
+    for (int i = 0; i < (int)size(); i++) {
+        if (keep[i]) {
+            result.push_back((*this)[i]);
+        }
+    }
+    return result;
+}
+
+
 PositionVector
 PositionVector::getOrthogonal(const Position& p, double extend, bool before, double length) const {
     PositionVector result;
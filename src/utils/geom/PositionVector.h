@@ -367,6 +367,12 @@ public:
     /// @brief return the same shape with intermediate colinear points removed
     PositionVector simplified() const;
 
+    /** @brief return a Douglas-Peucker simplification of the shape
+     * @param[in] maxError The maximum distance between the result and the original shape
+     * @note the first and the last point are always kept
+     */
+    PositionVector simplified(const double maxError) const;
+
     /** @brief return orthogonal through p (extending this vector if necessary)
      * @param[in] p The point through which to draw the orthogonal
      * @param[in] extend how long to extend this vector for finding an orthogonal
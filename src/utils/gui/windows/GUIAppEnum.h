@@ -96,6 +96,8 @@ enum {
     MID_STOP,
     /// @brief Perform a single simulation step
     MID_STEP,
+    /// @brief Run the simulation at full speed up to a given time
+    MID_SKIPTO,
     /// @}
 
 
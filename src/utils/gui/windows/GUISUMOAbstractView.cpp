@@ -116,6 +116,73 @@ FXDEFMAP(GUISUMOAbstractView) GUISUMOAbstractViewMap[] = {
 FXIMPLEMENT_ABSTRACT(GUISUMOAbstractView, FXGLCanvas, GUISUMOAbstractViewMap, ARRAYNUMBER(GUISUMOAbstractViewMap))
 
 
+/* -------------------------------------------------------------------------
+ * snapshot helpers
+ * ----------------------------------------------------------------------- */
+/// @brief mirrors the pixel rows vertically (OpenGL reads them bottom-up)
+static void
+mirrorRows(FXColor* buf, const int width, const int height) {
+    FXColor* paa = buf;
+    FXColor* pbb = buf + width * (height - 1);
+    do {
+        FXColor* pa = paa;
+        paa += width;
+        FXColor* pb = pbb;
+        pbb -= width;
+        do {
+            FXColor t = *pa;
+            *pa++ = *pb;
+            *pb++ = t;
+        } while (pa < paa);
+    } while (paa < pbb);
+}
+
+
+/**
+ * @class SnapshotWriteTask
+ * @brief Writes a snapshot image to disk on a worker thread
+ *
+ * The task owns the pixel buffer; errors are collected for the caller who
+ *  inspects them after waiting for the pool.
+ */
+class SnapshotWriteTask : public FXWorkerThread::Task {
+public:
+    SnapshotWriteTask(const std::string& file, FXColor* buf, int width, int height,
+                      std::vector<std::string>& errors)
+        : myFile(file), myBuf(buf), myWidth(width), myHeight(height), myErrors(errors) {}
+
+    ~SnapshotWriteTask() {
+        FXFREE(&myBuf);
+    }
+
+    void run(FXWorkerThread* /* context */) {
+        mirrorRows(myBuf, myWidth, myHeight);
+        try {
+            if (!MFXImageHelper::saveImage(myFile, myWidth, myHeight, myBuf)) {
+                myErrors.push_back("Could not save '" + myFile + "'.");
+            }
+        } catch (InvalidArgument& e) {
+            myErrors.push_back("Could not save '" + myFile + "'.\n" + e.what());
+        }
+    }
+
+private:
+    /// @brief The destination file
+    const std::string myFile;
+    /// @brief The owned pixel buffer
+    FXColor* myBuf;
+    /// @brief The image dimensions
+    const int myWidth;
+    const int myHeight;
+    /// @brief Where to report errors
+    std::vector<std::string>& myErrors;
+
+private:
+    /// @brief Invalidated assignment operator.
+    SnapshotWriteTask& operator=(const SnapshotWriteTask&);
+};
+
+
 /* -------------------------------------------------------------------------
  * GUISUMOAbstractView - methods
  * ----------------------------------------------------------------------- */
@@ -150,6 +217,8 @@ GUISUMOAbstractView::GUISUMOAbstractView(FXComposite* p, GUIMainWindow& app, GUI
 
 
 GUISUMOAbstractView::~GUISUMOAbstractView() {
+    // finish a pending background snapshot write
+    mySnapshotWriters.waitAll();
     gSchemeStorage.setDefault(myVisualizationSettings->name);
     gSchemeStorage.saveViewport(myChanger->getXPos(), myChanger->getYPos(), myChanger->getZPos());
     delete myPopup;
@@ -841,6 +910,12 @@ GUISUMOAbstractView::addSnapshot(SUMOTime time, const std::string& file) {
 std::string
 GUISUMOAbstractView::makeSnapshot(const std::string& destFile) {
     std::string errorMessage;
+    // wait for a previously queued image write and report its errors
+    mySnapshotWriters.waitAll();
+    for (std::vector<std::string>::const_iterator i = mySnapshotWriterErrors.begin(); i != mySnapshotWriterErrors.end(); ++i) {
+        WRITE_WARNING(*i);
+    }
+    mySnapshotWriterErrors.clear();
     FXString ext = FXPath::extension(destFile.c_str());
     const bool useGL2PS = ext == "ps" || ext == "eps" || ext == "pdf" || ext == "svg" || ext == "tex" || ext == "pgf";
 #ifdef HAVE_FFMPEG
@@ -946,40 +1021,26 @@ GUISUMOAbstractView::makeSnapshot(const std::string& destFile) {
         glReadPixels(0, 0, getWidth(), getHeight(), GL_RGBA, GL_UNSIGNED_BYTE, (GLvoid*)buf);
         makeNonCurrent();
         update();
-        // mirror
-        int mwidth = getWidth();
-        int mheight = getHeight();
-        FXColor* paa = buf;
-        FXColor* pbb = buf + mwidth * (mheight - 1);
-        do {
-            FXColor* pa = paa;
-            paa += mwidth;
-            FXColor* pb = pbb;
-            pbb -= mwidth;
-            do {
-                FXColor t = *pa;
-                *pa++ = *pb;
-                *pb++ = t;
-            } while (pa < paa);
-        } while (paa < pbb);
-        try {
 #ifdef HAVE_FFMPEG
-            if (useVideo) {
-                try {
-                    saveFrame(destFile, buf);
-                    errorMessage = "video";
-                } catch (std::runtime_error& err) {
-                    errorMessage = err.what();
-                }
-            } else
+        if (useVideo) {
+            mirrorRows(buf, getWidth(), getHeight());
+            try {
+                saveFrame(destFile, buf);
+                errorMessage = "video";
+            } catch (std::runtime_error& err) {
+                errorMessage = err.what();
+            }
+            FXFREE(&buf);
+        } else {
 #endif
-                if (!MFXImageHelper::saveImage(destFile, getWidth(), getHeight(), buf)) {
-                    errorMessage = "Could not save '" + destFile + "'.";
-                }
-        } catch (InvalidArgument& e) {
-            errorMessage = "Could not save '" + destFile + "'.\n" + e.what();
+            // write the image in the background so the simulation can continue
+            if (mySnapshotWriters.size() == 0) {
+                new FXWorkerThread(mySnapshotWriters);
+            }
+            mySnapshotWriters.add(new SnapshotWriteTask(destFile, buf, getWidth(), getHeight(), mySnapshotWriterErrors));
+#ifdef HAVE_FFMPEG
         }
-        FXFREE(&buf);
+#endif
     }
     return errorMessage;
 }
@@ -46,6 +46,7 @@
 #endif
 
 #include <utils/foxtools/MFXMutex.h>
+#include <utils/foxtools/FXWorkerThread.h>
 #include <utils/geom/Boundary.h>
 #include <utils/geom/Position.h>
 #include <utils/common/RGBColor.h>
@@ -445,6 +446,12 @@ protected:
     MFXMutex mySnapshotsLock;
     FXMutex* myApplicationSnapshotsLock;
 
+    ///@brief The pool (a single worker) writing snapshot images in the background
+    FXWorkerThread::Pool mySnapshotWriters;
+
+    ///@brief Errors from the background snapshot writer (only accessed while no write is pending)
+    std::vector<std::string> mySnapshotWriterErrors;
+
     ///@brief poly draw lock
     mutable MFXMutex myPolyDrawLock;
 
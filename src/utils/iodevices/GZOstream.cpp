@@ -0,0 +1,113 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2004-2017 German Aerospace Center (DLR) and others.
+/****************************************************************************/
+//
+//   This program and the accompanying materials
+//   are made available under the terms of the Eclipse Public License v2.0
+//   which accompanies this distribution, and is available at
+//   http://www.eclipse.org/legal/epl-v20.html
+//
+/****************************************************************************/
+/// @file    GZOstream.cpp
+/// @author  Michael Behrisch
+/// @date    2017-09-01
+/// @version $Id$
+///
+// An output stream which writes gzip compressed files via zlib
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#ifdef HAVE_ZLIB
+
+#include "GZOstream.h"
+
+
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+#define GZ_BUFFER_SIZE 65536
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+// ---------------------------------------------------------------------------
+// GZOstreamBuf - methods
+// ---------------------------------------------------------------------------
+GZOstreamBuf::GZOstreamBuf(const std::string& fullName)
+    : myFile(gzopen(fullName.c_str(), "wb")), myBuffer(GZ_BUFFER_SIZE) {
+    setp(&myBuffer.front(), &myBuffer.front() + myBuffer.size());
+}
+
+
+GZOstreamBuf::~GZOstreamBuf() {
+    if (myFile != 0) {
+        writeBuffer();
+        gzclose(myFile);
+    }
+}
+
+
+GZOstreamBuf::int_type
+GZOstreamBuf::overflow(int_type c) {
+    if (!writeBuffer()) {
+        return traits_type::eof();
+    }
+    if (c != traits_type::eof()) {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+    }
+    return c;
+}
+
+
+int
+GZOstreamBuf::sync() {
+    return writeBuffer() ? 0 : -1;
+}
+
+
+bool
+GZOstreamBuf::writeBuffer() {
+    if (myFile == 0) {
+        return false;
+    }
+    const int numChars = (int)(pptr() - pbase());
+    if (numChars > 0) {
+        if (gzwrite(myFile, pbase(), numChars) != numChars) {
+            return false;
+        }
+        pbump(-numChars);
+    }
+    return true;
+}
+
+
+// ---------------------------------------------------------------------------
+// GZOstream - methods
+// ---------------------------------------------------------------------------
+GZOstream::GZOstream(const std::string& fullName)
+    : std::ostream(0), myBuffer(fullName) {
+    rdbuf(&myBuffer);
+    if (!myBuffer.good()) {
+        setstate(std::ios::failbit);
+    }
+}
+
+
+GZOstream::~GZOstream() {
+}
+
+#endif // HAVE_ZLIB
+
+/****************************************************************************/
@@ -0,0 +1,138 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2004-2017 German Aerospace Center (DLR) and others.
+/****************************************************************************/
+//
+//   This program and the accompanying materials
+//   are made available under the terms of the Eclipse Public License v2.0
+//   which accompanies this distribution, and is available at
+//   http://www.eclipse.org/legal/epl-v20.html
+//
+/****************************************************************************/
+/// @file    GZOstream.h
+/// @author  Michael Behrisch
+/// @date    2017-09-01
+/// @version $Id$
+///
+// An output stream which writes gzip compressed files via zlib
+/****************************************************************************/
+#ifndef GZOstream_h
+#define GZOstream_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#ifdef HAVE_ZLIB
+
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class GZOstreamBuf
+ * @brief A stream buffer which deflates its content into a gzip file
+ *
+ * Characters are collected in an internal buffer and handed to zlib in
+ *  large chunks so the per-character stream overhead stays negligible.
+ */
+class GZOstreamBuf : public std::streambuf {
+public:
+    /** @brief Constructor, opens the file for compressed writing
+     * @param[in] fullName The name of the file to write
+     */
+    GZOstreamBuf(const std::string& fullName);
+
+    /// @brief Destructor, flushes the remaining content and closes the file
+    ~GZOstreamBuf();
+
+    /** @brief Returns whether the file could be opened
+     * @return whether the file is writable
+     */
+    bool good() const {
+        return myFile != 0;
+    }
+
+protected:
+    /// @name Methods that override/implement std::streambuf-methods
+    /// @{
+
+    /** @brief Writes the buffer and the overflowing character to the file
+     * @param[in] c The character which did not fit into the buffer
+     * @return the given character on success, EOF otherwise
+     */
+    int_type overflow(int_type c);
+
+    /** @brief Writes pending buffer content to the file
+     * @return 0 on success, -1 otherwise
+     */
+    int sync();
+    /// @}
+
+private:
+    /// @brief Compresses and writes the buffered characters
+    bool writeBuffer();
+
+private:
+    /// @brief The zlib file handle (0 if the file could not be opened)
+    gzFile myFile;
+
+    /// @brief The buffer collecting characters between deflate calls
+    std::vector<char> myBuffer;
+
+private:
+    /// @brief Invalidated copy constructor.
+    GZOstreamBuf(const GZOstreamBuf&);
+
+    /// @brief Invalidated assignment operator.
+    GZOstreamBuf& operator=(const GZOstreamBuf&);
+
+};
+
+
+/**
+ * @class GZOstream
+ * @brief An output stream writing a gzip compressed file
+ */
+class GZOstream : public std::ostream {
+public:
+    /** @brief Constructor, opens the file for compressed writing
+     *
+     * The failbit is set if the file could not be opened.
+     * @param[in] fullName The name of the file to write
+     */
+    GZOstream(const std::string& fullName);
+
+    /// @brief Destructor
+    ~GZOstream();
+
+private:
+    /// @brief The stream buffer performing the compression
+    GZOstreamBuf myBuffer;
+
+private:
+    /// @brief Invalidated copy constructor.
+    GZOstream(const GZOstream&);
+
+    /// @brief Invalidated assignment operator.
+    GZOstream& operator=(const GZOstream&);
+
+};
+
+#endif // HAVE_ZLIB
+
+#endif
+
+/****************************************************************************/
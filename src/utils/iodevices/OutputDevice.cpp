@@ -58,7 +58,7 @@ std::map<std::string, OutputDevice*> OutputDevice::myOutputDevices;
 // static method definitions
 // ===========================================================================
 OutputDevice&
-OutputDevice::getDevice(const std::string& name) {
+OutputDevice::getDevice(const std::string& name, const bool forceBinary) {
     // check whether the device has already been aqcuired
     if (myOutputDevices.find(name) != myOutputDevices.end()) {
         return *myOutputDevices[name];
@@ -95,7 +95,7 @@ OutputDevice::getDevice(const std::string& name) {
             }
             name2 = FileHelpers::prependToLastPathComponent(prefix, name);
         }
-        dev = new OutputDevice_File(name2, len > 4 && name.substr(len - 4) == ".sbx");
+        dev = new OutputDevice_File(name2, forceBinary || (len > 4 && name.substr(len - 4) == ".sbx"));
     }
     dev->setPrecision();
     dev->getOStream() << std::setiosflags(std::ios::fixed);
@@ -111,7 +111,11 @@ OutputDevice::createDeviceByOption(const std::string& optionName,
     if (!OptionsCont::getOptions().isSet(optionName)) {
         return false;
     }
-    OutputDevice& dev = OutputDevice::getDevice(OptionsCont::getOptions().getString(optionName));
+    // high-volume outputs may select the binary format explicitly via "<output>.format"
+    const std::string formatOption = optionName + ".format";
+    const bool forceBinary = OptionsCont::getOptions().exists(formatOption)
+                             && OptionsCont::getOptions().getString(formatOption) == "binary";
+    OutputDevice& dev = OutputDevice::getDevice(OptionsCont::getOptions().getString(optionName), forceBinary);
     if (rootElement != "") {
         dev.writeXMLHeader(rootElement, schemaFile);
     }
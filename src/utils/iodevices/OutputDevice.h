@@ -80,10 +80,11 @@ public:
      * If there already is a device with the same name this one is returned.
      *
      * @param[in] name The description of the output name/port/whatever
+     * @param[in] forceBinary Whether the binary formatter shall be used independent of the file extension
      * @return The corresponding (built or existing) device
      * @exception IOError If the output could not be built for any reason (error message is supplied)
      */
-    static OutputDevice& getDevice(const std::string& name);
+    static OutputDevice& getDevice(const std::string& name, const bool forceBinary = false);
 
 
     /** @brief Creates the device using the output definition stored in the named option
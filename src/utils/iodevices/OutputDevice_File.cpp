@@ -33,6 +33,8 @@
 #include <cstring>
 #include <cerrno>
 #include <utils/common/UtilExceptions.h>
+#include <utils/common/MsgHandler.h>
+#include "GZOstream.h"
 #include "OutputDevice_File.h"
 
 
@@ -46,7 +48,16 @@ OutputDevice_File::OutputDevice_File(const std::string& fullName, const bool bin
         myFileStream = new std::ofstream("NUL");
     } else
 #endif
+    if (!binary && fullName.length() > 3 && fullName.substr(fullName.length() - 3) == ".gz") {
+#ifdef HAVE_ZLIB
+        myFileStream = new GZOstream(fullName);
+#else
+        WRITE_WARNING("Gzip compression is not available (compile with zlib), writing uncompressed output to '" + fullName + "'.");
+        myFileStream = new std::ofstream(fullName.c_str(), std::ios_base::out);
+#endif
+    } else {
         myFileStream = new std::ofstream(fullName.c_str(), binary ? std::ios::binary : std::ios_base::out);
+    }
     if (!myFileStream->good()) {
         delete myFileStream;
         throw IOError("Could not build output file '" + fullName + "' (" + std::strerror(errno) + ").");
@@ -55,7 +66,6 @@ OutputDevice_File::OutputDevice_File(const std::string& fullName, const bool bin
 
 
 OutputDevice_File::~OutputDevice_File() {
-    myFileStream->close();
     delete myFileStream;
 }
 
@@ -41,14 +41,17 @@
  * @class OutputDevice_File
  * @brief An output device that encapsulates an ofstream
  *
+ * If the file name ends with ".gz" and zlib support is compiled in, the
+ *  output is transparently gzip compressed.
+ *
  * Please note that the device gots responsible for the stream and deletes
  *  it (it should not be deleted elsewhere).
  */
 class OutputDevice_File : public OutputDevice {
 public:
     /** @brief Constructor
-     * @param[in] strm The output stream to used
-     * @exception IOError Should not be thrown by this implementation
+     * @param[in] fullName The name of the file to write
+     * @exception IOError If the file could not be opened
      */
     OutputDevice_File(const std::string& fullName, const bool binary);
 
@@ -69,8 +72,8 @@ protected:
 
 
 private:
-    /// The wrapped ofstream
-    std::ofstream* myFileStream;
+    /// The wrapped stream (an ofstream or a compressing GZOstream)
+    std::ostream* myFileStream;
 
 };
 
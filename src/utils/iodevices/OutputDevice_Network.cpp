@@ -46,7 +46,12 @@
 // method definitions
 // ==========================================================================
 OutputDevice_Network::OutputDevice_Network(const std::string& host,
-        const int port) {
+        const int port)
+#ifdef HAVE_FOX
+    // a single sender thread keeps the messages in order
+    : mySenderPool(1), myPendingSends(0)
+#endif
+{
     mySocket = new tcpip::Socket(host, port);
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -74,6 +79,9 @@ OutputDevice_Network::OutputDevice_Network(const std::string& host,
 
 
 OutputDevice_Network::~OutputDevice_Network() {
+#ifdef HAVE_FOX
+    mySenderPool.waitAll();
+#endif
     mySocket->close();
     delete mySocket;
 }
@@ -90,13 +98,44 @@ OutputDevice_Network::postWriteHook() {
     std::string toSend = myMessage.str();
     std::vector<unsigned char> msg;
     msg.insert(msg.end(), toSend.begin(), toSend.end());
+#ifdef HAVE_FOX
+    {
+        FXMutexLock locker(myErrorMutex);
+        if (myAsyncError != "") {
+            throw IOError(myAsyncError);
+        }
+    }
+    mySenderPool.add(new SendTask(*this, msg));
+    if (++myPendingSends == 64) {
+        // block until the receiver caught up so the queue stays bounded
+        //  (this also reclaims the finished tasks)
+        mySenderPool.waitAll();
+        myPendingSends = 0;
+    }
+#else
     try {
         mySocket->send(msg);
     } catch (tcpip::SocketException& e) {
         throw IOError(toString(e.what()));
     }
+#endif
     myMessage.str("");
 }
 
 
+#ifdef HAVE_FOX
+void
+OutputDevice_Network::SendTask::run(FXWorkerThread* /* context */) {
+    try {
+        myDevice.mySocket->send(myMessage);
+    } catch (tcpip::SocketException& e) {
+        FXMutexLock locker(myDevice.myErrorMutex);
+        if (myDevice.myAsyncError == "") {
+            myDevice.myAsyncError = toString(e.what());
+        }
+    }
+}
+#endif
+
+
 /****************************************************************************/
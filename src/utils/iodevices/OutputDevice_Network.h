@@ -35,7 +35,11 @@
 #include "foreign/tcpip/storage.h"
 #include "OutputDevice.h"
 #include <utils/common/UtilExceptions.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 #include <string>
+#include <vector>
 #include <iostream>
 #include <sstream>
 
@@ -51,6 +55,10 @@
  *  project (shawn.sf.net) located in src/foreign/tcpip/socket.h. It uses
  *  an internal storage for the messages, which is sent via the socket when
  *  "postWriteHook" is called.
+ *
+ * If threading support is available, the messages are handed to a dedicated
+ *  sender thread so that a slow receiver does not stall the simulation; the
+ *  queue is drained (blocking) every few messages to bound its size.
  * @see postWriteHook
  */
 class OutputDevice_Network : public OutputDevice {
@@ -92,6 +100,30 @@ protected:
     virtual void postWriteHook();
     /// @}
 
+private:
+#ifdef HAVE_FOX
+    /**
+     * @class SendTask
+     * @brief Sends one message on the sender thread
+     *
+     * Exceptions cannot leave the thread; they are stored in the device
+     *  and rethrown on the next write from the simulation thread.
+     */
+    class SendTask : public FXWorkerThread::Task {
+    public:
+        SendTask(OutputDevice_Network& device, const std::vector<unsigned char>& message)
+            : myDevice(device), myMessage(message) {}
+        void run(FXWorkerThread* context);
+    private:
+        OutputDevice_Network& myDevice;
+        const std::vector<unsigned char> myMessage;
+    private:
+        /// @brief Invalidated assignment operator.
+        SendTask& operator=(const SendTask&);
+    };
+    friend class SendTask;
+#endif
+
 private:
     /// @brief packet buffer
     std::ostringstream myMessage;
@@ -99,6 +131,20 @@ private:
     /// @brief the socket to transfer the data
     tcpip::Socket* mySocket;
 
+#ifdef HAVE_FOX
+    /// @brief the pool holding the single sender thread (keeps the send order)
+    FXWorkerThread::Pool mySenderPool;
+
+    /// @brief the number of messages handed to the sender since the last drain
+    int myPendingSends;
+
+    /// @brief protects myAsyncError
+    FXMutex myErrorMutex;
+#endif
+
+    /// @brief an error reported by the sender thread, rethrown on the next write
+    std::string myAsyncError;
+
 };
 
 
@@ -30,6 +30,7 @@
 #include <config.h>
 #endif
 
+#include <cstdio>
 #include "OutputFormatter.h"
 
 
@@ -141,6 +142,38 @@ public:
     }
 
 
+    /** @brief writes a named double attribute without dynamic allocations
+     *
+     * Fast path for the high-volume exports (fcd-output, netstate-dump,
+     *  emission-output): the value is formatted into a reusable buffer
+     *  instead of building a temporary string via an ostringstream.
+     */
+    static void writeAttr(std::ostream& into, const SumoXMLAttr attr, const double val) {
+        static thread_local char buf[64];
+        const std::string& name = SUMOXMLDefinitions::Attrs.getString(attr);
+        const int len = snprintf(buf, sizeof(buf), " %s=\"%.*f\"", name.c_str(), (int)into.precision(), val);
+        if (len > 0 && len < (int)sizeof(buf)) {
+            into.write(buf, len);
+        } else {
+            // value did not fit the buffer, fall back to the generic path
+            into << " " << name << "=\"" << toString(val, into.precision()) << "\"";
+        }
+    }
+
+
+    /** @brief writes a named int attribute without dynamic allocations */
+    static void writeAttr(std::ostream& into, const SumoXMLAttr attr, const int val) {
+        static thread_local char buf[64];
+        const std::string& name = SUMOXMLDefinitions::Attrs.getString(attr);
+        const int len = snprintf(buf, sizeof(buf), " %s=\"%d\"", name.c_str(), val);
+        if (len > 0 && len < (int)sizeof(buf)) {
+            into.write(buf, len);
+        } else {
+            into << " " << name << "=\"" << val << "\"";
+        }
+    }
+
+
 private:
     /// @brief The stack of begun xml elements
     std::vector<std::string> myXMLStack;
@@ -181,10 +181,10 @@ ShapeHandler::addPoly(const SUMOSAXAttributes& attrs, const bool ignorePruning,
     if (attrs.getOpt<bool>(SUMO_ATTR_GEO, id.c_str(), ok, false)) {
         geo = true;
         bool success = true;
-        for (int i = 0; i < (int)shape.size(); i++) {
-            if (useProcessing) {
-                success &= GeoConvHelper::getProcessing().x2cartesian(shape[i]);
-            } else {
+        if (useProcessing) {
+            success = GeoConvHelper::getProcessing().x2cartesian(shape);
+        } else {
+            for (int i = 0; i < (int)shape.size(); i++) {
                 success &= GeoConvHelper::getFinal().x2cartesian_const(shape[i]);
             }
         }
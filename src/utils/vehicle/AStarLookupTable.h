@@ -103,7 +103,8 @@ private:
 template<class E, class V>
 class LandmarkLookupTable : public AbstractLookupTable<E, V> {
 public:
-    LandmarkLookupTable(const std::string& filename, const std::vector<E*>& edges, SUMOAbstractRouter<E, V>* router, const V* defaultVehicle, const std::string& outfile, const int maxNumThreads) {
+    LandmarkLookupTable(const std::string& filename, const std::vector<E*>& edges, SUMOAbstractRouter<E, V>* router, const V* defaultVehicle, const std::string& outfile, const int maxNumThreads,
+                        const std::vector<const E*>& selection = std::vector<const E*>()) {
         myFirstNonInternal = -1;
         std::map<std::string, int> numericID;
         for (E* e : edges) {
@@ -114,10 +115,6 @@ public:
                 numericID[e->getID()] = e->getNumericalID() - myFirstNonInternal;
             }
         }
-        std::ifstream strm(filename.c_str());
-        if (!strm.good()) {
-            throw ProcessError("Could not load landmark-lookup-table from '" + filename + "'.");
-        }
         std::ofstream* ostrm = 0;
         if (!outfile.empty()) {
             ostrm = new std::ofstream(outfile.c_str());
@@ -125,33 +122,47 @@ public:
                 throw ProcessError("Could not open file '" + outfile + "' for writing.");
             }
         }
-        std::string line;
         int numLandMarks = 0;
-        while (std::getline(strm, line)) {
-            if (line == "") {
-                break;
+        for (const E* const lm : selection) {
+            myLandmarks[lm->getID()] = numLandMarks++;
+            myFromLandmarkDists.push_back(std::vector<double>(0));
+            myToLandmarkDists.push_back(std::vector<double>(0));
+            if (ostrm != 0) {
+                (*ostrm) << lm->getID() << "\n";
+            }
+        }
+        if (!filename.empty()) {
+            std::ifstream strm(filename.c_str());
+            if (!strm.good()) {
+                throw ProcessError("Could not load landmark-lookup-table from '" + filename + "'.");
             }
-            //std::cout << "'" << line << "'" << "\n";
-            StringTokenizer st(line);
-            if (st.size() == 1) {
-                const std::string lm = st.get(0);
-                myLandmarks[lm] = numLandMarks++;
-                myFromLandmarkDists.push_back(std::vector<double>(0));
-                myToLandmarkDists.push_back(std::vector<double>(0));
-                if (ostrm != 0) {
-                    (*ostrm) << lm << "\n";
+            std::string line;
+            while (std::getline(strm, line)) {
+                if (line == "") {
+                    break;
                 }
-            } else {
-                assert(st.size() == 4);
-                const std::string lm = st.get(0);
-                const std::string edge = st.get(1);
-                if (numericID[edge] != (int)myFromLandmarkDists[myLandmarks[lm]].size()) {
-                    WRITE_WARNING("Unknown or unordered edge '" + edge + "' in landmark file.");
+                //std::cout << "'" << line << "'" << "\n";
+                StringTokenizer st(line);
+                if (st.size() == 1) {
+                    const std::string lm = st.get(0);
+                    myLandmarks[lm] = numLandMarks++;
+                    myFromLandmarkDists.push_back(std::vector<double>(0));
+                    myToLandmarkDists.push_back(std::vector<double>(0));
+                    if (ostrm != 0) {
+                        (*ostrm) << lm << "\n";
+                    }
+                } else {
+                    assert(st.size() == 4);
+                    const std::string lm = st.get(0);
+                    const std::string edge = st.get(1);
+                    if (numericID[edge] != (int)myFromLandmarkDists[myLandmarks[lm]].size()) {
+                        WRITE_WARNING("Unknown or unordered edge '" + edge + "' in landmark file.");
+                    }
+                    const double distFrom = TplConvert::_2double(st.get(2).c_str());
+                    const double distTo = TplConvert::_2double(st.get(3).c_str());
+                    myFromLandmarkDists[myLandmarks[lm]].push_back(distFrom);
+                    myToLandmarkDists[myLandmarks[lm]].push_back(distTo);
                 }
-                const double distFrom = TplConvert::_2double(st.get(2).c_str());
-                const double distTo = TplConvert::_2double(st.get(3).c_str());
-                myFromLandmarkDists[myLandmarks[lm]].push_back(distFrom);
-                myToLandmarkDists[myLandmarks[lm]].push_back(distTo);
             }
         }
         if (myLandmarks.empty()) {
@@ -280,6 +291,61 @@ public:
         delete ostrm;
     }
 
+
+    /** @brief Selects the given number of landmark edges with a farthest-point heuristic
+     *
+     * The first landmark is the edge which is geometrically farthest from an
+     *  arbitrary seed and thus lies near the network boundary; every further
+     *  landmark maximizes the minimum distance to the ones chosen before.
+     *  Internal edges and edges without predecessors or successors (such as
+     *  taz connectors) are skipped since no meaningful distances exist for them.
+     */
+    static std::vector<const E*> selectLandmarks(const std::vector<E*>& edges, const int numLandmarks) {
+        std::vector<const E*> candidates;
+        for (const E* const e : edges) {
+            if (!e->isInternal() && e->getPredecessors().size() > 0 && e->getSuccessors().size() > 0) {
+                candidates.push_back(e);
+            }
+        }
+        std::vector<const E*> result;
+        if (candidates.empty() || numLandmarks <= 0) {
+            return result;
+        }
+        int nextIndex = 0;
+        double farthest = -1.;
+        for (int i = 0; i < (int)candidates.size(); i++) {
+            const double dist = candidates.front()->getDistanceTo(candidates[i]);
+            if (dist > farthest) {
+                farthest = dist;
+                nextIndex = i;
+            }
+        }
+        std::vector<double> minDist(candidates.size(), std::numeric_limits<double>::max());
+        std::vector<bool> taken(candidates.size(), false);
+        while ((int)result.size() < numLandmarks) {
+            taken[nextIndex] = true;
+            result.push_back(candidates[nextIndex]);
+            const E* const last = candidates[nextIndex];
+            nextIndex = -1;
+            farthest = -1.;
+            for (int i = 0; i < (int)candidates.size(); i++) {
+                if (taken[i]) {
+                    continue;
+                }
+                minDist[i] = MIN2(minDist[i], last->getDistanceTo(candidates[i]));
+                if (minDist[i] > farthest) {
+                    farthest = minDist[i];
+                    nextIndex = i;
+                }
+            }
+            if (nextIndex < 0) {
+                break;
+            }
+        }
+        return result;
+    }
+
+
     double lowerBound(const E* from, const E* to, double speed, double speedFactor, double fromEffort, double toEffort) const {
         double result = from->getDistanceTo(to) / speed;
 #ifdef ASTAR_DEBUG_LOOKUPTABLE
@@ -0,0 +1,383 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2017 German Aerospace Center (DLR) and others.
+/****************************************************************************/
+//
+//   This program and the accompanying materials
+//   are made available under the terms of the Eclipse Public License v2.0
+//   which accompanies this distribution, and is available at
+//   http://www.eclipse.org/legal/epl-v20.html
+//
+/****************************************************************************/
+/// @file    BidiDijkstraRouter.h
+/// @author  Jakob Erdmann
+/// @author  Michael Behrisch
+/// @date    Aug 2017
+/// @version $Id$
+///
+// Bidirectional Dijkstra shortest path algorithm using travel time or other values
+/****************************************************************************/
+#ifndef BidiDijkstraRouter_h
+#define BidiDijkstraRouter_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cassert>
+#include <string>
+#include <functional>
+#include <vector>
+#include <set>
+#include <limits>
+#include <algorithm>
+#include <iterator>
+#include <utils/common/ToString.h>
+#include <utils/common/MsgHandler.h>
+#include <utils/common/StdDefs.h>
+#include "SUMOAbstractRouter.h"
+
+//#define BidiDijkstraRouter_DEBUG_QUERY
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class BidiDijkstraRouter
+ * @brief Computes the shortest path through a network by searching from the
+ *  origin and the destination simultaneously.
+ *
+ * The template parameters are:
+ * @param E The edge class to use (MSEdge/ROEdge)
+ * @param V The vehicle class to use (MSVehicle/ROVehicle)
+ * @param PF The prohibition function to use (prohibited_withPermissions/noProhibitions)
+ *
+ * The interface matches DijkstraRouter but point-to-point queries typically
+ *  settle far fewer edges because the search stops where the two frontiers
+ *  meet. Unlike the CH routers no preprocessing is needed so weight changes
+ *  take effect immediately.
+ *
+ * The backward search evaluates edge efforts at the departure time (the same
+ *  fixed-time approximation the CH routers use), so with time-dependent
+ *  weights the result may deviate slightly from the unidirectional routers.
+ * A destination edge is always required and bulk mode brings no speedup
+ *  (each query restarts both searches).
+ */
+template<class E, class V, class PF>
+class BidiDijkstraRouter : public SUMOAbstractRouter<E, V>, public PF {
+
+public:
+    typedef double(* Operation)(const E* const, const V* const, double);
+
+    /**
+     * @class EdgeInfo
+     * A definition about a route's edge with the effort needed to reach it and
+     *  the information about the previous edge.
+     */
+    class EdgeInfo {
+    public:
+        /// Constructor
+        EdgeInfo(const E* const e)
+            : edge(e), effort(std::numeric_limits<double>::max()), leaveTime(0), prev(0), visited(false) {}
+
+        /// The current edge
+        const E* const edge;
+
+        /// Effort to reach the edge
+        double effort;
+
+        /// The time the vehicle leaves the edge (only maintained by the forward search)
+        double leaveTime;
+
+        /// The previous edge (the following edge for the backward search)
+        const EdgeInfo* prev;
+
+        /// Whether the edge was already settled
+        bool visited;
+
+        inline void reset() {
+            effort = std::numeric_limits<double>::max();
+            visited = false;
+        }
+
+    private:
+        /// @brief Invalidated assignment operator
+        EdgeInfo& operator=(const EdgeInfo& s) = delete;
+
+    };
+
+    /**
+     * @class EdgeInfoByEffortComparator
+     * Class to compare (and so sort) nodes by their effort
+     */
+    class EdgeInfoByEffortComparator {
+    public:
+        /// Comparing method
+        bool operator()(const EdgeInfo* nod1, const EdgeInfo* nod2) const {
+            if (nod1->effort == nod2->effort) {
+                return nod1->edge->getNumericalID() > nod2->edge->getNumericalID();
+            }
+            return nod1->effort > nod2->effort;
+        }
+    };
+
+
+    /// Constructor
+    BidiDijkstraRouter(const std::vector<E*>& edges, bool unbuildIsWarning, Operation effortOperation, Operation ttOperation = nullptr) :
+        SUMOAbstractRouter<E, V>(effortOperation, "BidiDijkstraRouter"), myTTOperation(ttOperation),
+        myErrorMsgHandler(unbuildIsWarning ?  MsgHandler::getWarningInstance() : MsgHandler::getErrorInstance()) {
+        for (typename std::vector<E*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
+            myFwdInfos.push_back(EdgeInfo(*i));
+            myBwdInfos.push_back(EdgeInfo(*i));
+        }
+    }
+
+    /// Destructor
+    virtual ~BidiDijkstraRouter() { }
+
+    virtual SUMOAbstractRouter<E, V>* clone() {
+        return new BidiDijkstraRouter<E, V, PF>(myFwdInfos, myErrorMsgHandler == MsgHandler::getWarningInstance(), this->myOperation, myTTOperation);
+    }
+
+    inline double getTravelTime(const E* const e, const V* const v, const double t, const double effort) const {
+        return myTTOperation == nullptr ? effort : (*myTTOperation)(e, v, t);
+    }
+
+    void init() {
+        for (typename std::vector<EdgeInfo*>::iterator i = myFwdFrontier.begin(); i != myFwdFrontier.end(); i++) {
+            (*i)->reset();
+        }
+        myFwdFrontier.clear();
+        for (typename std::vector<EdgeInfo*>::iterator i = myBwdFrontier.begin(); i != myBwdFrontier.end(); i++) {
+            (*i)->reset();
+        }
+        myBwdFrontier.clear();
+        for (typename std::vector<EdgeInfo*>::iterator i = myFound.begin(); i != myFound.end(); i++) {
+            (*i)->reset();
+        }
+        myFound.clear();
+    }
+
+
+    /** @brief Builds the route between the given edges using the minimum effort at the given time
+        The definition of the effort depends on the wished routing scheme */
+    virtual bool compute(const E* from, const E* to, const V* const vehicle,
+                         SUMOTime msTime, std::vector<const E*>& into) {
+        assert(from != 0 && to != 0);
+        // check whether from and to can be used
+        if (PF::operator()(from, vehicle)) {
+            myErrorMsgHandler->inform("Vehicle '" + vehicle->getID() + "' is not allowed on source edge '" + from->getID() + "'.");
+            return false;
+        }
+        if (PF::operator()(to, vehicle)) {
+            myErrorMsgHandler->inform("Vehicle '" + vehicle->getID() + "' is not allowed on destination edge '" + to->getID() + "'.");
+            return false;
+        }
+        this->startQuery();
+#ifdef BidiDijkstraRouter_DEBUG_QUERY
+        std::cout << "DEBUG: starting bidirectional search for '" << vehicle->getID() << "' time: " << STEPS2TIME(msTime) << "\n";
+#endif
+        const SUMOVehicleClass vClass = vehicle == 0 ? SVC_IGNORING : vehicle->getVClass();
+        const double departTime = STEPS2TIME(msTime);
+        init();
+        // seed the forward search (effort excludes the edge itself, as in DijkstraRouter)
+        EdgeInfo* const fromInfo = &(myFwdInfos[from->getNumericalID()]);
+        fromInfo->effort = 0;
+        fromInfo->prev = 0;
+        fromInfo->leaveTime = departTime;
+        myFwdFrontier.push_back(fromInfo);
+        // seed the backward search (effort includes the edge itself so that a
+        //  meeting edge's own effort is counted exactly once)
+        EdgeInfo* const toInfo = &(myBwdInfos[to->getNumericalID()]);
+        toInfo->effort = this->getEffort(to, vehicle, departTime);
+        toInfo->prev = 0;
+        myBwdFrontier.push_back(toInfo);
+        // the best complete path found so far, identified by its meeting edge
+        double bestEffort = std::numeric_limits<double>::max();
+        const EdgeInfo* bestFwd = 0;
+        const EdgeInfo* bestBwd = 0;
+        if (from == to) {
+            bestEffort = toInfo->effort;
+            bestFwd = fromInfo;
+            bestBwd = toInfo;
+        }
+        int num_visited = 0;
+        while (!myFwdFrontier.empty() || !myBwdFrontier.empty()) {
+            const double fwdTop = myFwdFrontier.empty() ? std::numeric_limits<double>::max() : myFwdFrontier.front()->effort;
+            const double bwdTop = myBwdFrontier.empty() ? std::numeric_limits<double>::max() : myBwdFrontier.front()->effort;
+            // no meeting edge settled later on can beat the best known path
+            if (bestEffort < std::numeric_limits<double>::max()
+                    && (myFwdFrontier.empty() || myBwdFrontier.empty() || fwdTop + bwdTop >= bestEffort)) {
+                break;
+            }
+            num_visited += 1;
+            if (fwdTop <= bwdTop) {
+                // settle the next edge of the forward search
+                EdgeInfo* const minimumInfo = myFwdFrontier.front();
+                const E* const minEdge = minimumInfo->edge;
+                pop_heap(myFwdFrontier.begin(), myFwdFrontier.end(), myComparator);
+                myFwdFrontier.pop_back();
+                myFound.push_back(minimumInfo);
+                minimumInfo->visited = true;
+                const double effortDelta = this->getEffort(minEdge, vehicle, minimumInfo->leaveTime);
+                const double effort = minimumInfo->effort + effortDelta;
+                const double leaveTime = minimumInfo->leaveTime + getTravelTime(minEdge, vehicle, minimumInfo->leaveTime, effortDelta);
+                const std::vector<E*>& successors = minEdge->getSuccessors(vClass);
+                for (typename std::vector<E*>::const_iterator it = successors.begin(); it != successors.end(); ++it) {
+                    const E* const follower = *it;
+                    EdgeInfo* const followerInfo = &(myFwdInfos[follower->getNumericalID()]);
+                    if (PF::operator()(follower, vehicle)) {
+                        continue;
+                    }
+                    const double oldEffort = followerInfo->effort;
+                    if (!followerInfo->visited && effort < oldEffort) {
+                        followerInfo->effort = effort;
+                        followerInfo->leaveTime = leaveTime;
+                        followerInfo->prev = minimumInfo;
+                        if (oldEffort == std::numeric_limits<double>::max()) {
+                            myFwdFrontier.push_back(followerInfo);
+                            push_heap(myFwdFrontier.begin(), myFwdFrontier.end(), myComparator);
+                        } else {
+                            push_heap(myFwdFrontier.begin(),
+                                      find(myFwdFrontier.begin(), myFwdFrontier.end(), followerInfo) + 1,
+                                      myComparator);
+                        }
+                        // check whether the backward search already reached this edge
+                        const EdgeInfo& other = myBwdInfos[follower->getNumericalID()];
+                        if (other.effort != std::numeric_limits<double>::max() && effort + other.effort < bestEffort) {
+                            bestEffort = effort + other.effort;
+                            bestFwd = followerInfo;
+                            bestBwd = &other;
+                        }
+                    }
+                }
+            } else {
+                // settle the next edge of the backward search; all efforts are
+                //  evaluated at the departure time
+                EdgeInfo* const minimumInfo = myBwdFrontier.front();
+                const E* const minEdge = minimumInfo->edge;
+                pop_heap(myBwdFrontier.begin(), myBwdFrontier.end(), myComparator);
+                myBwdFrontier.pop_back();
+                myFound.push_back(minimumInfo);
+                minimumInfo->visited = true;
+                const std::vector<E*>& predecessors = minEdge->getPredecessors();
+                for (typename std::vector<E*>::const_iterator it = predecessors.begin(); it != predecessors.end(); ++it) {
+                    const E* const approaching = *it;
+                    EdgeInfo* const approachingInfo = &(myBwdInfos[approaching->getNumericalID()]);
+                    if (PF::operator()(approaching, vehicle)) {
+                        continue;
+                    }
+                    // the predecessor list is not filtered by vehicle class
+                    const std::vector<E*>& allowed = approaching->getSuccessors(vClass);
+                    if (std::find(allowed.begin(), allowed.end(), minEdge) == allowed.end()) {
+                        continue;
+                    }
+                    const double effort = minimumInfo->effort + this->getEffort(approaching, vehicle, departTime);
+                    const double oldEffort = approachingInfo->effort;
+                    if (!approachingInfo->visited && effort < oldEffort) {
+                        approachingInfo->effort = effort;
+                        approachingInfo->prev = minimumInfo;
+                        if (oldEffort == std::numeric_limits<double>::max()) {
+                            myBwdFrontier.push_back(approachingInfo);
+                            push_heap(myBwdFrontier.begin(), myBwdFrontier.end(), myComparator);
+                        } else {
+                            push_heap(myBwdFrontier.begin(),
+                                      find(myBwdFrontier.begin(), myBwdFrontier.end(), approachingInfo) + 1,
+                                      myComparator);
+                        }
+                        // check whether the forward search already reached this edge
+                        const EdgeInfo& other = myFwdInfos[approaching->getNumericalID()];
+                        if (other.effort != std::numeric_limits<double>::max() && effort + other.effort < bestEffort) {
+                            bestEffort = effort + other.effort;
+                            bestFwd = &other;
+                            bestBwd = approachingInfo;
+                        }
+                    }
+                }
+            }
+        }
+        this->endQuery(num_visited);
+        if (bestFwd != 0) {
+            buildPath(bestFwd, bestBwd, into);
+#ifdef BidiDijkstraRouter_DEBUG_QUERY
+            std::cout << "visited " + toString(num_visited) + " edges (final path length=" + toString(into.size()) + ")\n";
+#endif
+            return true;
+        }
+        myErrorMsgHandler->inform("No connection between edge '" + from->getID() + "' and edge '" + to->getID() + "' found.");
+        return false;
+    }
+
+
+    double recomputeCosts(const std::vector<const E*>& edges, const V* const v, SUMOTime msTime) const {
+        double costs = 0;
+        double t = STEPS2TIME(msTime);
+        for (const E* const e : edges) {
+            if (PF::operator()(e, v)) {
+                return -1;
+            }
+            const double effortDelta = this->getEffort(e, v, t);
+            costs += effortDelta;
+            t += getTravelTime(e, v, t, effortDelta);
+        }
+        return costs;
+    }
+
+    /// Builds the path by walking both halves away from the meeting edge
+    void buildPath(const EdgeInfo* fwdMeet, const EdgeInfo* bwdMeet, std::vector<const E*>& edges) {
+        std::vector<const E*> tmp;
+        while (fwdMeet != 0) {
+            tmp.push_back(fwdMeet->edge);
+            fwdMeet = fwdMeet->prev;
+        }
+        std::copy(tmp.rbegin(), tmp.rend(), std::back_inserter(edges));
+        // the meeting edge itself was already added by the forward half
+        bwdMeet = bwdMeet->prev;
+        while (bwdMeet != 0) {
+            edges.push_back(bwdMeet->edge);
+            bwdMeet = bwdMeet->prev;
+        }
+    }
+
+private:
+    BidiDijkstraRouter(const std::vector<EdgeInfo>& edgeInfos, bool unbuildIsWarning, Operation effortOperation, Operation ttOperation) :
+        SUMOAbstractRouter<E, V>(effortOperation, "BidiDijkstraRouter"), myTTOperation(ttOperation),
+        myErrorMsgHandler(unbuildIsWarning ? MsgHandler::getWarningInstance() : MsgHandler::getErrorInstance()) {
+        for (const EdgeInfo& ei : edgeInfos) {
+            myFwdInfos.push_back(EdgeInfo(ei.edge));
+            myBwdInfos.push_back(EdgeInfo(ei.edge));
+        }
+    }
+
+private:
+    /// @brief The object's operation to perform for travel times
+    Operation myTTOperation;
+
+    /// The container of edge information for the search from the origin
+    std::vector<EdgeInfo> myFwdInfos;
+    /// The container of edge information for the search from the destination
+    std::vector<EdgeInfo> myBwdInfos;
+
+    /// A container for reusage of the min edge heap of the forward search
+    std::vector<EdgeInfo*> myFwdFrontier;
+    /// A container for reusage of the min edge heap of the backward search
+    std::vector<EdgeInfo*> myBwdFrontier;
+    /// @brief list of visited Edges (for resetting)
+    std::vector<EdgeInfo*> myFound;
+
+    EdgeInfoByEffortComparator myComparator;
+
+    /// @brief the handler for routing errors
+    MsgHandler* const myErrorMsgHandler;
+};
+
+
+#endif
+
+/****************************************************************************/
@@ -39,7 +39,11 @@
 #include <algorithm>
 #include <iterator>
 #include <deque>
+#include <fstream>
 #include <utils/common/SysUtils.h>
+#include <utils/common/FileHelpers.h>
+#include <utils/common/UtilExceptions.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 #include <utils/common/MsgHandler.h>
 #include <utils/common/StdDefs.h>
 #include <utils/vehicle/SUMOAbstractRouter.h>
@@ -274,6 +278,7 @@ public:
         myBackwardSearch(edges, false),
         myHierarchyBuilder(new CHBuilder<E, V>(edges, unbuildIsWarning, svc, validatePermissions)),
         myHierarchy(0),
+        myHierarchyOutput(""),
         myWeightPeriod(weightPeriod),
         myValidUntil(0),
         mySVC(svc) {
@@ -292,6 +297,7 @@ public:
         myBackwardSearch(edges, false),
         myHierarchyBuilder(0),
         myHierarchy(hierarchy),
+        myHierarchyOutput(""),
         myWeightPeriod(weightPeriod),
         myValidUntil(0),
         mySVC(svc) {
@@ -416,6 +422,9 @@ public:
         if (myHierarchyBuilder != 0) {
             delete myHierarchy;
             myHierarchy = myHierarchyBuilder->buildContractionHierarchy(time, vehicle, this);
+            if (myHierarchyOutput != "") {
+                saveHierarchy(myHierarchyOutput);
+            }
         }
         // declare new validUntil (prevent overflow)
         if (myWeightPeriod < std::numeric_limits<int>::max()) {
@@ -425,7 +434,115 @@ public:
         }
     }
 
+    /// @brief Lets the router save the hierarchy to the given file whenever it was (re)built
+    void setHierarchyOutput(const std::string& filename) {
+        myHierarchyOutput = filename;
+    }
+
+    /** @brief Saves the current hierarchy to a binary file
+     *
+     * Edges are referenced by their numerical ids so the file is only valid
+     *  for the network it was built from; the edge count and the vehicle class
+     *  are stored for validation on loading. With multiple weight periods only
+     *  the hierarchy of the period built last is kept.
+     *
+     * @param[in] filename The name of the file to write
+     * @exception ProcessError If the file could not be written
+     */
+    void saveHierarchy(const std::string& filename) const {
+        if (myHierarchy == 0) {
+            throw ProcessError("No contraction hierarchy to save to '" + filename + "'.");
+        }
+        std::ofstream strm(filename.c_str(), std::ios::binary);
+        if (!strm.good()) {
+            throw ProcessError("Could not save hierarchy to '" + filename + "'.");
+        }
+        FileHelpers::writeInt(strm, (int)myEdges.size());
+        FileHelpers::writeInt(strm, (int)mySVC);
+        FileHelpers::writeInt(strm, (int)myHierarchy->shortcuts.size());
+        for (typename CHBuilder<E, V>::ShortcutVia::const_iterator it = myHierarchy->shortcuts.begin(); it != myHierarchy->shortcuts.end(); ++it) {
+            FileHelpers::writeInt(strm, it->first.first->getNumericalID());
+            FileHelpers::writeInt(strm, it->first.second->getNumericalID());
+            FileHelpers::writeInt(strm, it->second->getNumericalID());
+        }
+        writeUplinks(strm, myHierarchy->forwardUplinks);
+        writeUplinks(strm, myHierarchy->backwardUplinks);
+    }
+
+    /** @brief Loads a hierarchy saved with saveHierarchy
+     *
+     * The result may be passed to the cloning constructor; it is never freed.
+     *
+     * @param[in] filename The name of the file to read
+     * @param[in] edges The edges of the network the hierarchy was built from
+     * @param[in] svc The vehicle class the hierarchy was built for
+     * @return The loaded hierarchy
+     * @exception ProcessError If the file could not be read or does not match the network
+     */
+    static const typename CHBuilder<E, V>::Hierarchy* loadHierarchy(const std::string& filename, const std::vector<E*>& edges, const SUMOVehicleClass svc) {
+        BinaryInputDevice dev(filename);
+        if (!dev.good()) {
+            throw ProcessError("Could not load hierarchy from '" + filename + "'.");
+        }
+        int numEdges;
+        int fileSVC;
+        dev >> numEdges;
+        dev >> fileSVC;
+        if (numEdges != (int)edges.size()) {
+            throw ProcessError("The hierarchy in '" + filename + "' was built for a different network.");
+        }
+        if (fileSVC != (int)svc) {
+            throw ProcessError("The hierarchy in '" + filename + "' was built for a different vehicle class.");
+        }
+        typename CHBuilder<E, V>::Hierarchy* const result = new typename CHBuilder<E, V>::Hierarchy();
+        int numShortcuts;
+        dev >> numShortcuts;
+        for (int i = 0; i < numShortcuts; i++) {
+            int from;
+            int to;
+            int via;
+            dev >> from;
+            dev >> to;
+            dev >> via;
+            result->shortcuts[typename CHBuilder<E, V>::ConstEdgePair(edges[from], edges[to])] = edges[via];
+        }
+        readUplinks(dev, numEdges, result->forwardUplinks);
+        readUplinks(dev, numEdges, result->backwardUplinks);
+        return result;
+    }
+
 private:
+    /// @brief writes the uplinks of all edges to the given binary stream
+    static void writeUplinks(std::ostream& strm, const std::vector<std::vector<typename CHBuilder<E, V>::Connection> >& uplinks) {
+        for (int i = 0; i < (int)uplinks.size(); i++) {
+            FileHelpers::writeInt(strm, (int)uplinks[i].size());
+            for (typename std::vector<typename CHBuilder<E, V>::Connection>::const_iterator it = uplinks[i].begin(); it != uplinks[i].end(); ++it) {
+                FileHelpers::writeInt(strm, it->target);
+                FileHelpers::writeFloat(strm, it->cost);
+                FileHelpers::writeInt(strm, (int)it->permissions);
+            }
+        }
+    }
+
+    /// @brief reads the uplinks of the given number of edges from the given device
+    static void readUplinks(BinaryInputDevice& dev, const int numEdges, std::vector<std::vector<typename CHBuilder<E, V>::Connection> >& into) {
+        typedef typename CHBuilder<E, V>::Connection Connection;
+        for (int i = 0; i < numEdges; i++) {
+            int numUplinks;
+            dev >> numUplinks;
+            into.push_back(std::vector<Connection>());
+            for (int j = 0; j < numUplinks; j++) {
+                int target;
+                double cost;
+                int permissions;
+                dev >> target;
+                dev >> cost;
+                dev >> permissions;
+                into.back().push_back(Connection(target, cost, permissions));
+            }
+        }
+    }
+
     // retrieve the via edge for a shortcut
     const E* getVia(const E* forwardFrom, const E* forwardTo) const {
         typename CHBuilder<E, V>::ConstEdgePair forward(forwardFrom, forwardTo);
@@ -452,6 +569,9 @@ private:
     CHBuilder<E, V>* myHierarchyBuilder;
     const typename CHBuilder<E, V>::Hierarchy* myHierarchy;
 
+    /// @brief the file to save the hierarchy to after building (if set)
+    std::string myHierarchyOutput;
+
     /// @brief the validity duration of one weight interval
     const SUMOTime myWeightPeriod;
 
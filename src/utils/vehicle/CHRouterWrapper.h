@@ -130,8 +130,10 @@ public:
             // create new router for the given permissions and maximum speed
             // XXX a new router may also be needed if vehicles differ in speed factor
             for (int i = 0; i < numIntervals; i++) {
+                // use the effort operation given to the wrapper so adapted
+                //  weights (e.g. from MSDevice_Routing) drive the hierarchy
                 myRouters[svc].push_back(new CHRouterType(
-                                             myEdges, myIgnoreErrors, &E::getTravelTimeStatic, svc.first, myWeightPeriod, false));
+                                             myEdges, myIgnoreErrors, this->myOperation, svc.first, myWeightPeriod, false));
 #ifdef HAVE_FOX
                 if (myThreadPool.size() > 0) {
                     myThreadPool.add(new ComputeHierarchyTask(myRouters[svc].back(), vehicle, myBegin + i * myWeightPeriod));
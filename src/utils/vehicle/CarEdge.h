@@ -133,15 +133,19 @@ private:
     struct Schedule {
         Schedule(const SUMOTime _begin, const SUMOTime _end, const SUMOTime _period, const double _travelTimeSec)
             : begin(_begin), end(_end), period(_period), travelTimeSec(_travelTimeSec) {}
-        const SUMOTime begin;
-        const SUMOTime end;
-        const SUMOTime period;
-        const double travelTimeSec;
-    private:
-        /// @brief Invalidated assignment operator
-        Schedule& operator=(const Schedule& src);
+        // the members are mutable copies so that the schedules can live in a
+        //  sorted vector
+        SUMOTime begin;
+        SUMOTime end;
+        SUMOTime period;
+        double travelTimeSec;
     };
 
+    /// @brief Sorting criterion for the timetable (by first departure)
+    static bool scheduleEarlier(const Schedule& s1, const Schedule& s2) {
+        return s1.begin < s2.begin;
+    }
+
 public:
     PublicTransportEdge(const std::string id, int numericalID, const IntermodalEdge<E, L, N, V>* entryStop, const E* endEdge, const std::string& line) :
         IntermodalEdge<E, L, N, V>(line + ":" + (id != "" ? id : endEdge->getID()), numericalID, endEdge, line), myEntryStop(entryStop) { }
@@ -158,20 +162,22 @@ public:
         //std::cout << " edge=" << myEntryStop->getID() << "->" << this->getID() << " beg=" << STEPS2TIME(begin) << " end=" << STEPS2TIME(end)
         //    << " period=" << STEPS2TIME(period)
         //    << " travelTime=" << travelTimeSec << "\n";
-        mySchedules.insert(std::make_pair(STEPS2TIME(begin), Schedule(begin, end, period, travelTimeSec)));
+        const Schedule schedule(begin, end, period, travelTimeSec);
+        mySchedules.insert(std::upper_bound(mySchedules.begin(), mySchedules.end(), schedule, &scheduleEarlier), schedule);
     }
 
     double getTravelTime(const IntermodalTrip<E, N, V>* const /* trip */, double time) const {
         double minArrivalSec = std::numeric_limits<double>::max();
-        for (typename std::multimap<double, Schedule>::const_iterator it = mySchedules.begin(); it != mySchedules.end(); ++it) {
-            if (it->first > minArrivalSec) {
+        for (typename std::vector<Schedule>::const_iterator it = mySchedules.begin(); it != mySchedules.end(); ++it) {
+            if (STEPS2TIME(it->begin) > minArrivalSec) {
+                // no later schedule can depart before the best arrival found
                 break;
             }
-            if (time < STEPS2TIME(it->second.end)) {
-                const int running = MAX2(0, (int)ceil((time - STEPS2TIME(it->second.begin)) / STEPS2TIME(it->second.period)));
-                const SUMOTime nextDepart = it->second.begin + running * it->second.period;
-                minArrivalSec = MIN2(STEPS2TIME(nextDepart) + it->second.travelTimeSec, minArrivalSec);
-                //std::cout << " edge=" << myEntryStop->getID() << "->" << this->getID() << " beg=" << STEPS2TIME(it->second.begin) << " end=" << STEPS2TIME(it->second.end)
+            if (time < STEPS2TIME(it->end)) {
+                const int running = MAX2(0, (int)ceil((time - STEPS2TIME(it->begin)) / STEPS2TIME(it->period)));
+                const SUMOTime nextDepart = it->begin + running * it->period;
+                minArrivalSec = MIN2(STEPS2TIME(nextDepart) + it->travelTimeSec, minArrivalSec);
+                //std::cout << " edge=" << myEntryStop->getID() << "->" << this->getID() << " beg=" << STEPS2TIME(it->begin) << " end=" << STEPS2TIME(it->end)
                 //    << " atTime=" << time
                 //    << " running=" << running << " nextDepart=" << nextDepart
                 //    << " minASec=" << minArrivalSec << " travelTime=" << minArrivalSec - time << "\n";
@@ -181,7 +187,8 @@ public:
     }
 
 private:
-    std::multimap<double, Schedule> mySchedules;
+    /// @brief the departure intervals of this line sorted by begin time
+    std::vector<Schedule> mySchedules;
     const IntermodalEdge<E, L, N, V>* const myEntryStop;
 
 };
@@ -33,6 +33,7 @@
 
 #include <string>
 #include <vector>
+#include <unordered_map>
 #include <algorithm>
 #include <assert.h>
 #include <utils/common/SUMOTime.h>
@@ -219,7 +220,7 @@ public:
 
     /// @brief Returns the pair of forward and backward edge
     const EdgePair& getBothDirections(const E* e) const {
-        typename std::map<const E*, EdgePair>::const_iterator it = myBidiLookup.find(e);
+        typename std::unordered_map<const E*, EdgePair>::const_iterator it = myBidiLookup.find(e);
         if (it == myBidiLookup.end()) {
             assert(false);
             throw ProcessError("Edge '" + e->getID() + "' not found in intermodal network '");
@@ -229,7 +230,7 @@ public:
 
     /// @brief Returns the departing intermodal edge
     _IntermodalEdge* getDepartEdge(const E* e, const double pos) const {
-        typename std::map<const E*, std::vector<_IntermodalEdge*> >::const_iterator it = myDepartLookup.find(e);
+        typename std::unordered_map<const E*, std::vector<_IntermodalEdge*> >::const_iterator it = myDepartLookup.find(e);
         if (it == myDepartLookup.end()) {
             throw ProcessError("Depart edge '" + e->getID() + "' not found in intermodal network.");
         }
@@ -250,7 +251,7 @@ public:
 
     /// @brief Returns the arriving intermodal edge
     _IntermodalEdge* getArrivalEdge(const E* e, const double pos) const {
-        typename std::map<const E*, std::vector<_IntermodalEdge*> >::const_iterator it = myArrivalLookup.find(e);
+        typename std::unordered_map<const E*, std::vector<_IntermodalEdge*> >::const_iterator it = myArrivalLookup.find(e);
         if (it == myArrivalLookup.end()) {
             throw ProcessError("Arrival edge '" + e->getID() + "' not found in intermodal network.");
         }
@@ -271,7 +272,7 @@ public:
 
     /// @brief Returns the outgoing pedestrian edge, which is either a walking area or a walking connector
     _IntermodalEdge* getWalkingConnector(const E* e) const {
-        typename std::map<const N*, _IntermodalEdge*>::const_iterator it = myWalkingConnectorLookup.find(e->getToJunction());
+        typename std::unordered_map<const N*, _IntermodalEdge*>::const_iterator it = myWalkingConnectorLookup.find(e->getToJunction());
         if (it == myWalkingConnectorLookup.end()) {
             const L* const sidewalk = getSidewalk<E, L>(e);
             if (e->isInternal() || sidewalk == 0) {
@@ -293,16 +294,16 @@ private:
     std::vector<_IntermodalEdge*> myEdges;
 
     /// @brief retrieve the forward and backward edge for the given input edge E
-    std::map<const E*, EdgePair> myBidiLookup;
+    std::unordered_map<const E*, EdgePair> myBidiLookup;
 
     /// @brief retrieve the depart edges for the given input edge E
-    std::map<const E*, std::vector<_IntermodalEdge*> > myDepartLookup;
+    std::unordered_map<const E*, std::vector<_IntermodalEdge*> > myDepartLookup;
 
     /// @brief retrieve the arrival edges for the given input edge E
-    std::map<const E*, std::vector<_IntermodalEdge*> > myArrivalLookup;
+    std::unordered_map<const E*, std::vector<_IntermodalEdge*> > myArrivalLookup;
 
     /// @brief the walking connector edge (fake walking area)
-    std::map<const N*, _IntermodalEdge*> myWalkingConnectorLookup;
+    std::unordered_map<const N*, _IntermodalEdge*> myWalkingConnectorLookup;
 
 };
 
@@ -32,6 +32,7 @@
 
 #include <string>
 #include <vector>
+#include <unordered_map>
 #include <algorithm>
 #include <assert.h>
 #include <utils/common/MsgHandler.h>
@@ -266,11 +267,34 @@ public:
     }
 
     /** @brief Builds the route between the given edges using the minimum effort at the given time
-        The definition of the effort depends on the wished routing scheme */
+        The definition of the effort depends on the wished routing scheme
+
+        Results for trips without a vehicle depend on the query alone and are cached,
+         so that persons sharing origin, destination and departure (as typically
+         produced by generated public transport demand) are only routed once. */
     bool compute(const E* from, const E* to, double departPos, double arrivalPos, double speed,
                  const V* const vehicle, const SVCPermissions modeSet, SUMOTime msTime,
                  std::vector<TripItem>& into) {
         createNet();
+        if (vehicle == 0) {
+            const CacheKey key(from, to, departPos, arrivalPos, speed, modeSet, msTime);
+            typename std::map<CacheKey, CacheEntry>::const_iterator it = myComputeCache.find(key);
+            if (it == myComputeCache.end()) {
+                CacheEntry entry;
+                entry.success = computeIntermodal(from, to, departPos, arrivalPos, speed, vehicle, modeSet, msTime, entry.items);
+                it = myComputeCache.insert(std::make_pair(key, entry)).first;
+            }
+            into.insert(into.end(), (*it).second.items.begin(), (*it).second.items.end());
+            return (*it).second.success;
+        }
+        return computeIntermodal(from, to, departPos, arrivalPos, speed, vehicle, modeSet, msTime, into);
+    }
+
+private:
+    /// @brief Builds the route between the given edges without consulting the cache
+    bool computeIntermodal(const E* from, const E* to, double departPos, double arrivalPos, double speed,
+                           const V* const vehicle, const SVCPermissions modeSet, SUMOTime msTime,
+                           std::vector<TripItem>& into) {
         _IntermodalTrip trip(from, to, departPos, arrivalPos, speed, msTime, 0, vehicle, modeSet);
         std::vector<const _IntermodalEdge*> intoEdges;
         const bool success = myInternalRouter->compute(myIntermodalNet->getDepartEdge(from, trip.departPos),
@@ -327,6 +351,7 @@ public:
         return success;
     }
 
+public:
     /** @brief Builds the route between the given edges using the minimum effort at the given time
         The definition of the effort depends on the wished routing scheme */
     bool compute(const E*, const E*, const _IntermodalTrip* const,
@@ -347,6 +372,7 @@ public:
             toProhibitPE.push_back(getCarEdge(*it));
         }
         myInternalRouter->prohibit(toProhibitPE);
+        myComputeCache.clear();
     }
 
     void writeNetwork(OutputDevice& dev) {
@@ -376,8 +402,51 @@ public:
     }
 
 private:
+    /// @brief all query parameters which determine the result of a trip without a vehicle
+    struct CacheKey {
+        CacheKey(const E* _from, const E* _to, double _departPos, double _arrivalPos,
+                 double _speed, SVCPermissions _modeSet, SUMOTime _time)
+            : from(_from), to(_to), departPos(_departPos), arrivalPos(_arrivalPos),
+              speed(_speed), modeSet(_modeSet), time(_time) {}
+        bool operator<(const CacheKey& o) const {
+            if (from != o.from) {
+                return from < o.from;
+            }
+            if (to != o.to) {
+                return to < o.to;
+            }
+            if (departPos != o.departPos) {
+                return departPos < o.departPos;
+            }
+            if (arrivalPos != o.arrivalPos) {
+                return arrivalPos < o.arrivalPos;
+            }
+            if (speed != o.speed) {
+                return speed < o.speed;
+            }
+            if (modeSet != o.modeSet) {
+                return modeSet < o.modeSet;
+            }
+            return time < o.time;
+        }
+        const E* from;
+        const E* to;
+        double departPos;
+        double arrivalPos;
+        double speed;
+        SVCPermissions modeSet;
+        SUMOTime time;
+    };
+
+    /// @brief the routing result for a cached query
+    struct CacheEntry {
+        CacheEntry() : success(false) {}
+        bool success;
+        std::vector<TripItem> items;
+    };
+
     IntermodalRouter(_IntermodalNetwork* net):
-        SUMOAbstractRouter<E, _IntermodalTrip>(0, "PedestrianRouter"), myAmClone(true),
+        SUMOAbstractRouter<E, _IntermodalTrip>(0, "IntermodalRouter"), myAmClone(true),
         myInternalRouter(new INTERNALROUTER(net->getAllEdges(), true, &_IntermodalEdge::getTravelTimeStatic)),
         myIntermodalNet(net), myNumericalID((int)net->getAllEdges().size()), myCarWalkTransfer(0) {}
 
@@ -515,13 +584,16 @@ private:
     std::map<const E*, _IntermodalEdge*> myCarLookup;
 
     /// @brief retrieve the public transport edges for the given line
-    std::map<std::string, std::vector<_PTEdge*> > myPTLines;
+    std::unordered_map<std::string, std::vector<_PTEdge*> > myPTLines;
 
     /// @brief retrieve the connecting edges for the given "bus" stop
-    std::map<std::string, _IntermodalEdge*> myStopConnections;
+    std::unordered_map<std::string, _IntermodalEdge*> myStopConnections;
 
     /// @brief retrieve the splitted edges for the given "original"
-    std::map<_IntermodalEdge*, std::vector<_IntermodalEdge*> > myAccessSplits;
+    std::unordered_map<_IntermodalEdge*, std::vector<_IntermodalEdge*> > myAccessSplits;
+
+    /// @brief results of earlier queries without a vehicle (local to this instance, clones are per thread)
+    std::map<CacheKey, CacheEntry> myComputeCache;
 
 
 private:
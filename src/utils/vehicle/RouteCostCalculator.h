@@ -73,6 +73,16 @@ public:
         return mySkipRouteCalculation;
     }
 
+    /// @brief the relative cost change on the current route below which no new route is calculated (0 means always calculate)
+    double skipNewRoutesThreshold() const {
+        return mySkipNewRoutesThreshold;
+    }
+
+    /// @brief the number of alternatives to generate eagerly per vehicle (0 means one new route per iteration)
+    int getPrefillAlternatives() const {
+        return myPrefillAlternatives;
+    }
+
 protected:
     /// @brief Constructor
     RouteCostCalculator() {
@@ -80,6 +90,8 @@ protected:
         myMaxRouteNumber = oc.getInt("max-alternatives");
         myKeepRoutes = oc.getBool("keep-all-routes");
         mySkipRouteCalculation = oc.getBool("skip-new-routes");
+        mySkipNewRoutesThreshold = oc.exists("skip-new-routes.threshold") ? oc.getFloat("skip-new-routes.threshold") : 0.;
+        myPrefillAlternatives = oc.exists("alternatives.prefill") ? MIN2(oc.getInt("alternatives.prefill"), myMaxRouteNumber) : 0;
     }
 
     /// @brief Destructor
@@ -97,6 +109,12 @@ private:
     /// @brief Information whether new routes should be calculated
     bool mySkipRouteCalculation;
 
+    /// @brief The relative cost change below which route calculation is skipped
+    double mySkipNewRoutesThreshold;
+
+    /// @brief The number of alternatives to generate eagerly per vehicle
+    int myPrefillAlternatives;
+
 };
 
 
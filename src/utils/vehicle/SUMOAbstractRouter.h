@@ -101,6 +101,26 @@ public:
         myBulkMode = mode;
     }
 
+    /// @brief Returns the type of this router
+    inline const std::string& getType() const {
+        return myType;
+    }
+
+    /// @brief Returns the number of queries answered so far
+    inline long long int getNumQueries() const {
+        return myNumQueries;
+    }
+
+    /// @brief Returns the total number of edges settled over all queries
+    inline long long int getQueryVisits() const {
+        return myQueryVisits;
+    }
+
+    /// @brief Returns the total time spent answering queries in milliseconds
+    inline long long int getQueryTimeSum() const {
+        return myQueryTimeSum;
+    }
+
 protected:
     /// @brief The object's operation to perform.
     Operation myOperation;
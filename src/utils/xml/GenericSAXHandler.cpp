@@ -56,7 +56,11 @@ GenericSAXHandler::GenericSAXHandler(
     }
     i = 0;
     while (attrs[i].key != terminatorAttr) {
-        assert(myPredefinedTags.find(attrs[i].key) == myPredefinedTags.end());
+        assert(attrs[i].key >= 0);
+        if (attrs[i].key >= (int)myPredefinedTags.size()) {
+            myPredefinedTags.resize(attrs[i].key + 1, 0);
+        }
+        assert(myPredefinedTags[attrs[i].key] == 0);
         myPredefinedTags[attrs[i].key] = convert(attrs[i].str);
         myPredefinedTagsMML[attrs[i].key] = attrs[i].str;
         i++;
@@ -66,7 +70,7 @@ GenericSAXHandler::GenericSAXHandler(
 
 GenericSAXHandler::~GenericSAXHandler() {
     for (AttrMap::iterator i1 = myPredefinedTags.begin(); i1 != myPredefinedTags.end(); i1++) {
-        delete[](*i1).second;
+        delete[] * i1;
     }
 }
 
@@ -101,8 +105,11 @@ GenericSAXHandler::startElement(const XMLCh* const /*uri*/,
                                 const XMLCh* const /*localname*/,
                                 const XMLCh* const qname,
                                 const XERCES_CPP_NAMESPACE::Attributes& attrs) {
-    std::string name = TplConvert::_2str(qname);
-    int element = convertTag(name);
+    const TagCacheEntry& tag = convertTag(qname);
+    // copy before any callback runs: an included file reenters this handler
+    //  and may grow the cache, invalidating the reference
+    const std::string name = tag.name;
+    const int element = tag.element;
     myCharactersVector.clear();
     SUMOSAXAttributesImpl_Xerces na(attrs, myPredefinedTags, myPredefinedTagsMML, name);
     if (element == SUMO_TAG_INCLUDE) {
@@ -121,8 +128,7 @@ void
 GenericSAXHandler::endElement(const XMLCh* const /*uri*/,
                               const XMLCh* const /*localname*/,
                               const XMLCh* const qname) {
-    std::string name = TplConvert::_2str(qname);
-    int element = convertTag(name);
+    const int element = convertTag(qname).element;
     // collect characters
     if (myCharactersVector.size() != 0) {
         int len = 0;
@@ -183,6 +189,24 @@ GenericSAXHandler::convertTag(const std::string& tag) const {
 }
 
 
+const GenericSAXHandler::TagCacheEntry&
+GenericSAXHandler::convertTag(const XMLCh* const qname) {
+    for (std::vector<TagCacheEntry>::const_iterator i = myTagCache.begin(); i != myTagCache.end(); ++i) {
+        if (XERCES_CPP_NAMESPACE::XMLString::equals(qname, &(*i).qname[0])) {
+            return *i;
+        }
+    }
+    // first occurrence of this tag; transcode and resolve it once
+    TagCacheEntry entry;
+    const int len = (int)XERCES_CPP_NAMESPACE::XMLString::stringLen(qname);
+    entry.qname.assign(qname, qname + len + 1);
+    entry.name = TplConvert::_2str(qname);
+    entry.element = convertTag(entry.name);
+    myTagCache.push_back(entry);
+    return myTagCache.back();
+}
+
+
 std::string
 GenericSAXHandler::buildErrorMessage(const XERCES_CPP_NAMESPACE::SAXParseException& exception) {
     std::ostringstream buf;
@@ -209,6 +209,8 @@ public:
 
     // Reader needs access to myStartElement, myEndElement
     friend class SUMOSAXReader;
+    // the pipelined route loader replays buffered elements into the handler
+    friend class SUMORouteLoader;
 
 
 protected:
@@ -279,14 +281,39 @@ private:
     int convertTag(const std::string& tag) const;
 
 
+private:
+    /// @brief A cached tag conversion
+    struct TagCacheEntry {
+        /// @brief The tag name as delivered by the parser (zero-terminated)
+        std::vector<XMLCh> qname;
+        /// @brief The tag name converted to a string
+        std::string name;
+        /// @brief The numerical representation of the tag
+        int element;
+    };
+
+    /** @brief Converts a tag as delivered by the parser, caching the conversion
+     *
+     * A file contains only a handful of distinct tags but each of them may
+     *  occur millions of times; the transcoding and map lookup are done once
+     *  per distinct tag only.
+     * @param[in] qname The tag name as delivered by the parser
+     * @return The cached conversion (name and numerical representation)
+     */
+    const TagCacheEntry& convertTag(const XMLCh* const qname);
+
+    /// @brief The tags converted so far
+    std::vector<TagCacheEntry> myTagCache;
+
 private:
     /// @name attributes parsing
     //@{
 
-    // the type of the map from ids to their unicode-string representation
-    typedef std::map<int, XMLCh*> AttrMap;
+    // the type of the container from ids to their unicode-string representation
+    // (the id is the index, unknown ids are 0; allows direct access in contrast to a map)
+    typedef std::vector<XMLCh*> AttrMap;
 
-    // the map from ids to their unicode-string representation
+    // the container from ids to their unicode-string representation
     AttrMap myPredefinedTags;
 
     /// the map from ids to their string representation
@@ -27,17 +27,153 @@
 #include <config.h>
 #endif
 
+#include <utils/common/FileHelpers.h>
+#include <utils/common/StdDefs.h>
 #include <utils/xml/SUMORouteHandler.h>
 #include <utils/xml/SUMOSAXReader.h>
+#ifdef HAVE_FOX
+#include <utils/xml/SUMOSAXAttributesImpl_Cached.h>
+#endif
 #include <utils/xml/XMLSubSys.h>
 #include "SUMORouteLoader.h"
 
 
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+#ifdef HAVE_FOX
+const int SUMORouteLoader::EventBuffer::BUFFER_CAPACITY = 4096;
+#endif
+
+
 // ===========================================================================
 // method definitions
 // ===========================================================================
-SUMORouteLoader::SUMORouteLoader(SUMORouteHandler* handler)
-    : myParser(0), myMoreAvailable(true), myHandler(handler) {
+// ---------------------------------------------------------------------------
+// SUMORouteLoader::EventBuffer - methods
+// ---------------------------------------------------------------------------
+#ifdef HAVE_FOX
+SUMORouteLoader::EventBuffer::EventBuffer(const std::string& file)
+    : SUMOSAXHandler(file), myDone(false), myAborted(false) {}
+
+
+void
+SUMORouteLoader::EventBuffer::myStartElement(int element, const SUMOSAXAttributes& attrs) {
+    XMLEvent event;
+    event.start = true;
+    event.element = element;
+    event.tag = attrs.getObjectType();
+    const std::vector<std::pair<std::string, std::string> > all = attrs.getAllAttributes();
+    for (std::vector<std::pair<std::string, std::string> >::const_iterator it = all.begin(); it != all.end(); ++it) {
+        event.attributes[it->first] = it->second;
+    }
+    push(event);
+}
+
+
+void
+SUMORouteLoader::EventBuffer::myEndElement(int element) {
+    XMLEvent event;
+    event.start = false;
+    event.element = element;
+    push(event);
+}
+
+
+void
+SUMORouteLoader::EventBuffer::push(const XMLEvent& event) {
+    myMutex.lock();
+    while (!myAborted && (int)myEvents.size() >= BUFFER_CAPACITY) {
+        myNotFull.wait(myMutex);
+    }
+    if (myAborted) {
+        myMutex.unlock();
+        // unwind the parse on the reader thread
+        throw ProcessError("Route loading was aborted.");
+    }
+    myEvents.push_back(event);
+    myNotEmpty.signal();
+    myMutex.unlock();
+}
+
+
+bool
+SUMORouteLoader::EventBuffer::getNext(XMLEvent& into) {
+    myMutex.lock();
+    while (myEvents.empty() && !myDone) {
+        myNotEmpty.wait(myMutex);
+    }
+    if (myEvents.empty()) {
+        myMutex.unlock();
+        return false;
+    }
+    into = myEvents.front();
+    myEvents.pop_front();
+    myNotFull.signal();
+    myMutex.unlock();
+    return true;
+}
+
+
+void
+SUMORouteLoader::EventBuffer::markDone(const std::string& error) {
+    myMutex.lock();
+    myDone = true;
+    myError = error;
+    myNotEmpty.signal();
+    myMutex.unlock();
+}
+
+
+void
+SUMORouteLoader::EventBuffer::abort() {
+    myMutex.lock();
+    myAborted = true;
+    myNotFull.signal();
+    myMutex.unlock();
+}
+
+
+// ---------------------------------------------------------------------------
+// SUMORouteLoader::ParseTask - methods
+// ---------------------------------------------------------------------------
+void
+SUMORouteLoader::ParseTask::run(FXWorkerThread* /* context */) {
+    std::string error;
+    try {
+        myParser->parse(myFile);
+    } catch (ProcessError& e) {
+        error = e.what();
+    }
+    myBuffer.markDone(error);
+}
+#endif
+
+
+// ---------------------------------------------------------------------------
+// SUMORouteLoader - methods
+// ---------------------------------------------------------------------------
+SUMORouteLoader::SUMORouteLoader(SUMORouteHandler* handler, const bool pipelined)
+    : myParser(0), myMoreAvailable(true), myHandler(handler)
+#ifdef HAVE_FOX
+    , myBuffer(0)
+#endif
+{
+    UNUSED_PARAMETER(pipelined);
+#ifdef HAVE_FOX
+    if (pipelined) {
+        if (!FileHelpers::isReadable(myHandler->getFileName())) {
+            throw ProcessError("Can not read XML-file '" + myHandler->getFileName() + "'.");
+        }
+        // the raw parse runs on the reader thread and fills the buffer,
+        //  loadUntil replays the buffered elements into the handler
+        myBuffer = new EventBuffer(myHandler->getFileName());
+        myParser = XMLSubSys::getSAXReader(*myBuffer);
+        new FXWorkerThread(myReaderPool);
+        myReaderPool.add(new ParseTask(myParser, *myBuffer, myHandler->getFileName()));
+        return;
+    }
+#endif
     myParser = XMLSubSys::getSAXReader(*myHandler);
     if (!myParser->parseFirst(myHandler->getFileName())) {
         throw ProcessError("Can not read XML-file '" + myHandler->getFileName() + "'.");
@@ -46,6 +182,14 @@ SUMORouteLoader::SUMORouteLoader(SUMORouteHandler* handler)
 
 
 SUMORouteLoader::~SUMORouteLoader() {
+#ifdef HAVE_FOX
+    if (myBuffer != 0) {
+        // make sure the reader thread terminates before tearing down the parser
+        myBuffer->abort();
+        myReaderPool.waitAll();
+        delete myBuffer;
+    }
+#endif
     delete myParser;
     delete myHandler;
 }
@@ -59,6 +203,29 @@ SUMORouteLoader::loadUntil(SUMOTime time) {
     if (!myMoreAvailable) {
         return SUMOTime_MAX;
     }
+#ifdef HAVE_FOX
+    if (myBuffer != 0) {
+        // replay buffered elements from the reader thread
+        while (myHandler->getLastDepart() <= time) {
+            EventBuffer::XMLEvent event;
+            if (!myBuffer->getNext(event)) {
+                // no data available anymore
+                if (myBuffer->getError() != "") {
+                    throw ProcessError(myBuffer->getError());
+                }
+                myMoreAvailable = false;
+                return SUMOTime_MAX;
+            }
+            if (event.start) {
+                SUMOSAXAttributesImpl_Cached attrs(event.attributes, myHandler->myPredefinedTagsMML, event.tag);
+                myHandler->myStartElement(event.element, attrs);
+            } else {
+                myHandler->myEndElement(event.element);
+            }
+        }
+        return myHandler->getLastDepart();
+    }
+#endif
     // read vehicles until specified time or the period to read vehicles
     //  until is reached
     while (myHandler->getLastDepart() <= time) {
@@ -31,6 +31,13 @@
 #endif
 
 #include <utils/common/SUMOTime.h>
+#ifdef HAVE_FOX
+#include <deque>
+#include <map>
+#include <string>
+#include <utils/foxtools/FXWorkerThread.h>
+#include "SUMOSAXHandler.h"
+#endif
 
 
 // ===========================================================================
@@ -48,8 +55,13 @@ class SUMOSAXReader;
  */
 class SUMORouteLoader {
 public:
-    /// constructor
-    SUMORouteLoader(SUMORouteHandler* handler);
+    /** @brief constructor
+     *
+     * If pipelined loading is requested (and FOX is available), the raw XML
+     *  parsing runs on a background thread while the handler consumes the
+     *  parsed elements on the calling thread in loadUntil.
+     */
+    SUMORouteLoader(SUMORouteHandler* handler, const bool pipelined = false);
 
     /// destructor
     ~SUMORouteLoader();
@@ -64,6 +76,115 @@ public:
     /// returns the first departure time that was ever read
     SUMOTime getFirstDepart() const;
 
+private:
+#ifdef HAVE_FOX
+    /**
+     * @class EventBuffer
+     * @brief A handler buffering parsed elements for replay on another thread
+     *
+     * The buffer is filled by the reader thread (as SAX handler of the
+     *  background parse) and drained by the consuming thread; it blocks the
+     *  producer when the configured capacity is reached.
+     */
+    class EventBuffer : public SUMOSAXHandler {
+    public:
+        /// @brief a single buffered parsing event
+        struct XMLEvent {
+            /// @brief whether this is an element start (or an element end)
+            bool start;
+            /// @brief the numerical id of the element
+            int element;
+            /// @brief the name of the element
+            std::string tag;
+            /// @brief the attributes of the element (as plain strings)
+            std::map<std::string, std::string> attributes;
+        };
+
+        /// @brief Constructor
+        EventBuffer(const std::string& file);
+
+        /** @brief Retrieves the next buffered event, waiting for the producer
+         *
+         * @param[out] into The structure to fill with the next event
+         * @return whether an event was retrieved (false if parsing finished)
+         */
+        bool getNext(XMLEvent& into);
+
+        /// @brief signals the end of the parse (optionally with an error)
+        void markDone(const std::string& error);
+
+        /// @brief unblocks and stops the producer (called before destruction)
+        void abort();
+
+        /// @brief returns the error message of a failed parse (or "")
+        const std::string& getError() const {
+            return myError;
+        }
+
+    protected:
+        /// @brief buffers the start of an element (called by the reader thread)
+        void myStartElement(int element, const SUMOSAXAttributes& attrs);
+
+        /// @brief buffers the end of an element (called by the reader thread)
+        void myEndElement(int element);
+
+    private:
+        /// @brief appends the given event, blocking while the buffer is full
+        void push(const XMLEvent& event);
+
+    private:
+        /// @brief the maximum number of events to buffer
+        static const int BUFFER_CAPACITY;
+
+        /// @brief the buffered events
+        std::deque<XMLEvent> myEvents;
+
+        /// @brief the mutex guarding the event buffer
+        FXMutex myMutex;
+
+        /// @brief the condition the consumer waits on
+        FXCondition myNotEmpty;
+
+        /// @brief the condition the producer waits on
+        FXCondition myNotFull;
+
+        /// @brief whether the background parse has finished
+        bool myDone;
+
+        /// @brief whether the consumer gave up on the buffer
+        bool myAborted;
+
+        /// @brief the error message of a failed parse
+        std::string myError;
+    };
+
+    /**
+     * @class ParseTask
+     * @brief The worker thread task running the background parse
+     */
+    class ParseTask : public FXWorkerThread::Task {
+    public:
+        /// @brief Constructor
+        ParseTask(SUMOSAXReader* parser, EventBuffer& buffer, const std::string& file)
+            : myParser(parser), myBuffer(buffer), myFile(file) {}
+
+        /// @brief parses the whole file into the buffer
+        void run(FXWorkerThread* context);
+
+    private:
+        /// @brief the parser to use
+        SUMOSAXReader* const myParser;
+        /// @brief the buffer to fill
+        EventBuffer& myBuffer;
+        /// @brief the file to parse
+        const std::string myFile;
+
+    private:
+        /// @brief invalidated assignment operator
+        ParseTask& operator=(const ParseTask&);
+    };
+#endif
+
 private:
     /// the used SAXReader
     SUMOSAXReader* myParser;
@@ -74,10 +195,17 @@ private:
     /// the used Handler
     SUMORouteHandler* myHandler;
 
+#ifdef HAVE_FOX
+    /// @brief the event buffer if pipelined loading is used, 0 otherwise
+    EventBuffer* myBuffer;
+
+    /// @brief the pool holding the single reader thread
+    FXWorkerThread::Pool myReaderPool;
+#endif
+
 };
 
 
 #endif
 
 /****************************************************************************/
-
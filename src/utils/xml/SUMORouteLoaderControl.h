@@ -77,6 +77,11 @@ public:
         return myAllLoaded;
     }
 
+    /// returns the departure time of the first vehicle which was not loaded yet
+    SUMOTime getNextLoadTime() const {
+        return myCurrentLoadTime;
+    }
+
 private:
     /// the first time step for which vehicles were loaded
     SUMOTime myFirstLoadTime;
@@ -369,6 +369,14 @@ public:
     virtual void serialize(std::ostream& os) const = 0;
 
 
+    /** @brief Retrieves all attribute names and (string) values
+     *
+     * Used for copying / transcoding elements without interpreting them.
+     * @return The attributes as a list of (name, value) pairs
+     */
+    virtual std::vector<std::pair<std::string, std::string> > getAllAttributes() const = 0;
+
+
     /// @brief return the objecttype to which these attributes belong
     const std::string& getObjectType() const {
         return myObjectType;
@@ -226,14 +226,17 @@ SUMOSAXAttributesImpl_Binary::getFloat(int id) const {
 
 
 double
-SUMOSAXAttributesImpl_Binary::getFloat(const std::string& /* id */) const {
-    throw ProcessError("not implemented for binary data");
+SUMOSAXAttributesImpl_Binary::getFloat(const std::string& id) const {
+    if (!SUMOXMLDefinitions::Attrs.hasString(id)) {
+        throw EmptyData();
+    }
+    return getFloat(SUMOXMLDefinitions::Attrs.get(id));
 }
 
 
 bool
-SUMOSAXAttributesImpl_Binary::hasAttribute(const std::string& /* id */) const {
-    throw ProcessError("not implemented for binary data");
+SUMOSAXAttributesImpl_Binary::hasAttribute(const std::string& id) const {
+    return SUMOXMLDefinitions::Attrs.hasString(id) && hasAttribute(SUMOXMLDefinitions::Attrs.get(id));
 }
 
 
@@ -333,6 +336,16 @@ SUMOSAXAttributesImpl_Binary::serialize(std::ostream& os) const {
 }
 
 
+std::vector<std::pair<std::string, std::string> >
+SUMOSAXAttributesImpl_Binary::getAllAttributes() const {
+    std::vector<std::pair<std::string, std::string> > result;
+    for (std::set<int>::const_iterator i = myAttrs.begin(); i != myAttrs.end(); ++i) {
+        result.push_back(std::make_pair(getName(*i), getStringSecure(*i, "")));
+    }
+    return result;
+}
+
+
 SUMOSAXAttributes*
 SUMOSAXAttributesImpl_Binary::clone() const {
     std::map<std::string, std::string> attrs;
@@ -235,6 +235,12 @@ SUMOSAXAttributesImpl_Cached::serialize(std::ostream& os) const {
 }
 
 
+std::vector<std::pair<std::string, std::string> >
+SUMOSAXAttributesImpl_Cached::getAllAttributes() const {
+    return std::vector<std::pair<std::string, std::string> >(myAttrs.begin(), myAttrs.end());
+}
+
+
 SUMOSAXAttributes*
 SUMOSAXAttributesImpl_Cached::clone() const {
     return new SUMOSAXAttributesImpl_Cached(myAttrs, myPredefinedTagsMML, getObjectType());
@@ -282,6 +282,9 @@ public:
      */
     void serialize(std::ostream& os) const;
 
+    /// @brief retrieves all attribute names and (string) values
+    std::vector<std::pair<std::string, std::string> > getAllAttributes() const;
+
     /// @brief return a new deep-copy attributes object
     SUMOSAXAttributes* clone() const;
 
@@ -48,7 +48,7 @@
 // class definitions
 // ===========================================================================
 SUMOSAXAttributesImpl_Xerces::SUMOSAXAttributesImpl_Xerces(const XERCES_CPP_NAMESPACE::Attributes& attrs,
-        const std::map<int, XMLCh*>& predefinedTags,
+        const std::vector<XMLCh*>& predefinedTags,
         const std::map<int, std::string>& predefinedTagsMML,
         const std::string& objectType) :
     SUMOSAXAttributes(objectType),
@@ -63,11 +63,10 @@ SUMOSAXAttributesImpl_Xerces::~SUMOSAXAttributesImpl_Xerces() {
 
 bool
 SUMOSAXAttributesImpl_Xerces::hasAttribute(int id) const {
-    AttrMap::const_iterator i = myPredefinedTags.find(id);
-    if (i == myPredefinedTags.end()) {
+    if (id < 0 || id >= (int)myPredefinedTags.size() || myPredefinedTags[id] == 0) {
         return false;
     }
-    return myAttrs.getIndex((*i).second) >= 0;
+    return myAttrs.getIndex(myPredefinedTags[id]) >= 0;
 }
 
 
@@ -146,9 +145,8 @@ SUMOSAXAttributesImpl_Xerces::getFloat(int id) const {
 
 const XMLCh*
 SUMOSAXAttributesImpl_Xerces::getAttributeValueSecure(int id) const {
-    AttrMap::const_iterator i = myPredefinedTags.find(id);
-    assert(i != myPredefinedTags.end());
-    return myAttrs.getValue((*i).second);
+    assert(id >= 0 && id < (int)myPredefinedTags.size() && myPredefinedTags[id] != 0);
+    return myAttrs.getValue(myPredefinedTags[id]);
 }
 
 
@@ -276,6 +274,17 @@ SUMOSAXAttributesImpl_Xerces::serialize(std::ostream& os) const {
 }
 
 
+std::vector<std::pair<std::string, std::string> >
+SUMOSAXAttributesImpl_Xerces::getAllAttributes() const {
+    std::vector<std::pair<std::string, std::string> > result;
+    for (int i = 0; i < (int)myAttrs.getLength(); ++i) {
+        result.push_back(std::make_pair(TplConvert::_2str(myAttrs.getLocalName(i)),
+                                        TplConvert::_2str(myAttrs.getValue(i))));
+    }
+    return result;
+}
+
+
 SUMOSAXAttributes*
 SUMOSAXAttributesImpl_Xerces::clone() const {
     std::map<std::string, std::string> attrs;
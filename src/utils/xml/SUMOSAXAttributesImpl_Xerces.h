@@ -33,6 +33,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <iostream>
 #include <xercesc/sax2/Attributes.hpp>
 #include <utils/common/SUMOTime.h>
@@ -54,11 +55,11 @@ public:
     /** @brief Constructor
      *
      * @param[in] attrs The encapsulated xerces-attributes
-     * @param[in] predefinedTags Map of attribute ids to their xerces-representation
+     * @param[in] predefinedTags Vector of attribute ids to their xerces-representation
      * @param[in] predefinedTagsMML Map of attribute ids to their (readable) string-representation
      */
     SUMOSAXAttributesImpl_Xerces(const XERCES_CPP_NAMESPACE::Attributes& attrs,
-                                 const std::map<int, XMLCh*>& predefinedTags,
+                                 const std::vector<XMLCh*>& predefinedTags,
                                  const std::map<int, std::string>& predefinedTagsMML,
                                  const std::string& objectType);
 
@@ -285,6 +286,9 @@ public:
      */
     void serialize(std::ostream& os) const;
 
+    /// @brief retrieves all attribute names and (string) values
+    std::vector<std::pair<std::string, std::string> > getAllAttributes() const;
+
     /// @brief return a new deep-copy attributes object
     SUMOSAXAttributes* clone() const;
 
@@ -302,9 +306,10 @@ private:
     /// @brief The encapsulated attributes
     const XERCES_CPP_NAMESPACE::Attributes& myAttrs;
 
-    /// @brief Definition of a map of attribute ids to their xerces-representation
-    typedef std::map<int, XMLCh*> AttrMap;
-    /// @brief Map of attribute ids to their xerces-representation
+    /// @brief Definition of a container of attribute ids to their xerces-representation
+    /// (the id is the index, unknown ids are 0; allows direct access in contrast to a map)
+    typedef std::vector<XMLCh*> AttrMap;
+    /// @brief Vector of attribute ids to their xerces-representation
     const AttrMap& myPredefinedTags;
 
     /// @brief Map of attribute ids to their (readable) string-representation
@@ -0,0 +1,83 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2002-2017 German Aerospace Center (DLR) and others.
+/****************************************************************************/
+//
+//   This program and the accompanying materials
+//   are made available under the terms of the Eclipse Public License v2.0
+//   which accompanies this distribution, and is available at
+//   http://www.eclipse.org/legal/epl-v20.html
+//
+/****************************************************************************/
+/// @file    SUMOSAXCopyHandler.cpp
+/// @date    2017
+/// @version $Id$
+///
+// SAX-handler which copies all parsed elements into an output device
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+#include <utils/iodevices/OutputDevice.h>
+#include "SUMOXMLDefinitions.h"
+#include "SUMOSAXCopyHandler.h"
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+SUMOSAXCopyHandler::SUMOSAXCopyHandler(OutputDevice& into, const std::string& file)
+    : SUMOSAXHandler(file), myDevice(into), myWroteRoot(false), mySkipDepth(0) {}
+
+
+SUMOSAXCopyHandler::~SUMOSAXCopyHandler() {}
+
+
+void
+SUMOSAXCopyHandler::myStartElement(int /* element */, const SUMOSAXAttributes& attrs) {
+    const std::string& name = attrs.getObjectType();
+    if (mySkipDepth > 0 || !SUMOXMLDefinitions::Tags.hasString(name)) {
+        mySkipDepth++;
+        return;
+    }
+    const std::vector<std::pair<std::string, std::string> > attributes = attrs.getAllAttributes();
+    std::vector<std::pair<std::string, std::string> >::const_iterator it;
+    if (!myWroteRoot) {
+        // the root element is written together with the device header
+        std::map<SumoXMLAttr, std::string> rootAttrs;
+        for (it = attributes.begin(); it != attributes.end(); ++it) {
+            if (SUMOXMLDefinitions::Attrs.hasString(it->first)) {
+                rootAttrs[(SumoXMLAttr)SUMOXMLDefinitions::Attrs.get(it->first)] = it->second;
+            }
+        }
+        myDevice.writeXMLHeader(name, "", rootAttrs);
+        myWroteRoot = true;
+        return;
+    }
+    myDevice.openTag(name);
+    for (it = attributes.begin(); it != attributes.end(); ++it) {
+        myDevice.writeAttr(it->first, it->second);
+    }
+}
+
+
+void
+SUMOSAXCopyHandler::myEndElement(int /* element */) {
+    if (mySkipDepth > 0) {
+        mySkipDepth--;
+        return;
+    }
+    myDevice.closeTag();
+}
+
+
+/****************************************************************************/
@@ -0,0 +1,109 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2002-2017 German Aerospace Center (DLR) and others.
+/****************************************************************************/
+//
+//   This program and the accompanying materials
+//   are made available under the terms of the Eclipse Public License v2.0
+//   which accompanies this distribution, and is available at
+//   http://www.eclipse.org/legal/epl-v20.html
+//
+/****************************************************************************/
+/// @file    SUMOSAXCopyHandler.h
+/// @date    2017
+/// @version $Id$
+///
+// SAX-handler which copies all parsed elements into an output device
+/****************************************************************************/
+#ifndef SUMOSAXCopyHandler_h
+#define SUMOSAXCopyHandler_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+#include "SUMOSAXHandler.h"
+
+
+// ===========================================================================
+// class declarations
+// ===========================================================================
+class OutputDevice;
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class SUMOSAXCopyHandler
+ * @brief A SAX-handler which mirrors all parsed elements into an OutputDevice
+ *
+ * This handler does not interpret the parsed content; it re-emits every
+ *  element and attribute through the given device. Since the device decides
+ *  about the encoding, this allows transcoding an XML input into another
+ *  representation (notably the binary .sbx format). Elements with names
+ *  outside the known SUMO tag set are skipped together with their subtree.
+ */
+class SUMOSAXCopyHandler : public SUMOSAXHandler {
+public:
+    /** @brief Constructor
+     *
+     * @param[in] into The device to write the parsed elements to
+     * @param[in] file The name of the processed file
+     */
+    SUMOSAXCopyHandler(OutputDevice& into, const std::string& file = "");
+
+    /// @brief Destructor
+    virtual ~SUMOSAXCopyHandler();
+
+protected:
+    /// @name inherited from GenericSAXHandler
+    //@{
+
+    /** @brief Re-emits the opening of the given element into the device
+     *
+     * The first element writes the XML header of the device (passing its
+     *  attributes as root attributes).
+     *
+     * @param[in] element The (unused) numerical id of the element
+     * @param[in] attrs The attributes of the element
+     */
+    virtual void myStartElement(int element, const SUMOSAXAttributes& attrs);
+
+    /** @brief Re-emits the closing of the current element into the device
+     *
+     * @param[in] element The (unused) numerical id of the element
+     */
+    virtual void myEndElement(int element);
+    //@}
+
+private:
+    /// @brief The device to write to
+    OutputDevice& myDevice;
+
+    /// @brief Whether the root element (and the device header) was written
+    bool myWroteRoot;
+
+    /// @brief The depth within currently skipped (unknown) elements
+    int mySkipDepth;
+
+private:
+    /// @brief invalidated copy constructor
+    SUMOSAXCopyHandler(const SUMOSAXCopyHandler& s);
+
+    /// @brief invalidated assignment operator
+    const SUMOSAXCopyHandler& operator=(const SUMOSAXCopyHandler& s);
+
+};
+
+
+#endif
+
+/****************************************************************************/
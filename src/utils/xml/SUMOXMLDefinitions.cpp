@@ -425,6 +425,8 @@ StringBijection<int>::Entry SUMOXMLDefinitions::attrs[] = {
     { "timeThreshold",          SUMO_ATTR_HALTING_TIME_THRESHOLD },
     { "speedThreshold",         SUMO_ATTR_HALTING_SPEED_THRESHOLD },
     { "jamThreshold",           SUMO_ATTR_JAM_DIST_THRESHOLD },
+    { "countOnly",              SUMO_ATTR_COUNT_ONLY },
+    { "maxRoutes",              SUMO_ATTR_MAX_ROUTES },
 
     { "wautID",                 SUMO_ATTR_WAUT_ID },
     { "junctionID",             SUMO_ATTR_JUNCTION_ID },
@@ -475,6 +477,7 @@ StringBijection<int>::Entry SUMOXMLDefinitions::attrs[] = {
     { "trackVehicles",          SUMO_ATTR_TRACK_VEHICLES },
     { "maxTraveltime",          SUMO_ATTR_MAX_TRAVELTIME },
     { "minSamples",             SUMO_ATTR_MIN_SAMPLES },
+    { "traveltime",             SUMO_ATTR_TRAVELTIME },
 
     { "lon",                    SUMO_ATTR_LON },
     { "lat",                    SUMO_ATTR_LAT },
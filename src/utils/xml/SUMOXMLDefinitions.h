@@ -651,6 +651,10 @@ enum SumoXMLAttr {
     SUMO_ATTR_HALTING_TIME_THRESHOLD,
     SUMO_ATTR_HALTING_SPEED_THRESHOLD,
     SUMO_ATTR_JAM_DIST_THRESHOLD,
+    /// @brief Whether an e1 detector shall collect passage counts only
+    SUMO_ATTR_COUNT_ONLY,
+    /// @brief The maximum number of routes a route probe keeps track of
+    SUMO_ATTR_MAX_ROUTES,
     /// @}
 
     SUMO_ATTR_WAUT_ID,
@@ -703,6 +707,7 @@ enum SumoXMLAttr {
     SUMO_ATTR_TRACK_VEHICLES,
     SUMO_ATTR_MAX_TRAVELTIME,
     SUMO_ATTR_MIN_SAMPLES,
+    SUMO_ATTR_TRAVELTIME,
 
     SUMO_ATTR_LON,
     SUMO_ATTR_LAT,
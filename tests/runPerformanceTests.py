@@ -0,0 +1,121 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2017 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+
+# @file    runPerformanceTests.py
+# @date    2017-11-20
+# @version $Id$
+
+"""
+Runs a set of scenarios under a timing harness and records duration,
+vehicle updates per second and peak RSS into a machine-readable JSON log.
+The scenarios are given as a JSON file of the form
+
+    [{"name": "grid-micro", "args": ["-c", "grid/grid.sumocfg"]},
+     {"name": "metro-meso", "args": ["-c", "metro/meso.sumocfg", "--mesosim"]}]
+
+with paths relative to the scenario file. Results can be compared against
+a recorded baseline (written with --update-baseline); the script exits
+with status 1 if any scenario falls below the baseline throughput by more
+than the given threshold.
+"""
+from __future__ import print_function
+from __future__ import absolute_import
+import os
+import sys
+import json
+import time
+import argparse
+import resource
+import subprocess
+
+
+def parseLog(output):
+    """extracts duration and UPS from the verbose simulation summary"""
+    result = {}
+    for line in output.splitlines():
+        line = line.strip()
+        if line.startswith("Duration:") and line.endswith("ms"):
+            result["duration_ms"] = float(line[len("Duration:"):-2])
+        elif line.startswith("UPS:"):
+            result["ups"] = float(line[len("UPS:"):])
+    return result
+
+
+def runScenario(sumoBinary, scenario, baseDir):
+    args = [sumoBinary, "--no-step-log", "-v"] + scenario["args"]
+    rssBefore = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+    started = time.time()
+    process = subprocess.Popen(args, cwd=baseDir, stdout=subprocess.PIPE,
+                               stderr=subprocess.STDOUT)
+    output = process.communicate()[0].decode("utf8", "replace")
+    wall = time.time() - started
+    if process.returncode != 0:
+        print(output, file=sys.stderr)
+        raise RuntimeError("scenario '%s' failed with exit code %s" % (
+            scenario["name"], process.returncode))
+    result = parseLog(output)
+    result["name"] = scenario["name"]
+    result["wall_s"] = wall
+    # high-water mark over all children; only meaningful if this scenario
+    # is the largest run so far, so the scenarios should be ordered by size
+    result["max_rss_kb"] = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+    if result["max_rss_kb"] == rssBefore:
+        result["max_rss_kb"] = None
+    return result
+
+
+def main(args):
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("scenarios", help="JSON file listing the scenarios to run")
+    parser.add_argument("--sumo-binary", default=os.environ.get("SUMO_BINARY", "sumo"),
+                        help="the binary to time (default: $SUMO_BINARY or 'sumo')")
+    parser.add_argument("--output", default="performance.json",
+                        help="file to write the results to")
+    parser.add_argument("--baseline", default=None,
+                        help="baseline JSON to compare against")
+    parser.add_argument("--update-baseline", action="store_true", default=False,
+                        help="write the results to the baseline file instead of comparing")
+    parser.add_argument("--threshold", type=float, default=20.,
+                        help="tolerated throughput loss against the baseline in percent")
+    options = parser.parse_args(args)
+
+    with open(options.scenarios) as f:
+        scenarios = json.load(f)
+    baseDir = os.path.dirname(os.path.abspath(options.scenarios))
+    results = [runScenario(options.sumo_binary, s, baseDir) for s in scenarios]
+    with open(options.output, "w") as f:
+        json.dump(results, f, indent=1, sort_keys=True)
+    for r in results:
+        print("%-30s %10.1fms %12s UPS  rss %s kB" % (
+            r["name"], r.get("duration_ms", -1),
+            "%.0f" % r["ups"] if "ups" in r else "n/a",
+            r["max_rss_kb"] if r["max_rss_kb"] else "n/a"))
+
+    if options.update_baseline and options.baseline:
+        with open(options.baseline, "w") as f:
+            json.dump(results, f, indent=1, sort_keys=True)
+        return 0
+    if options.baseline and os.path.exists(options.baseline):
+        with open(options.baseline) as f:
+            baseline = dict([(r["name"], r) for r in json.load(f)])
+        failed = False
+        for r in results:
+            base = baseline.get(r["name"])
+            if base is None or "ups" not in base or "ups" not in r:
+                continue
+            loss = 100. * (base["ups"] - r["ups"]) / base["ups"]
+            if loss > options.threshold:
+                print("regression: '%s' throughput fell by %.1f%% (%.0f -> %.0f UPS)" % (
+                    r["name"], loss, base["ups"], r["ups"]), file=sys.stderr)
+                failed = True
+        return 1 if failed else 0
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
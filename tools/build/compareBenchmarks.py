@@ -0,0 +1,55 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2017 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+
+# @file    compareBenchmarks.py
+# @date    2017-11-20
+# @version $Id$
+
+"""
+Compares two google-benchmark JSON result files (produced by running the
+benchmarks target with --benchmark_format=json) and reports the relative
+change per benchmark. Exits with status 1 if any benchmark slowed down by
+more than the given threshold (default 10 percent).
+"""
+from __future__ import print_function
+from __future__ import absolute_import
+import json
+import sys
+
+
+def load(fname):
+    with open(fname) as f:
+        data = json.load(f)
+    return dict([(b["name"], float(b["cpu_time"])) for b in data["benchmarks"]])
+
+
+def main(args):
+    if len(args) < 2:
+        print("usage: compareBenchmarks.py <baseline.json> <current.json> [<threshold%>]", file=sys.stderr)
+        return 2
+    threshold = float(args[2]) if len(args) > 2 else 10.
+    baseline = load(args[0])
+    current = load(args[1])
+    regressed = False
+    print("%-45s %12s %12s %8s" % ("benchmark", "baseline", "current", "change"))
+    for name in sorted(baseline.keys()):
+        if name not in current:
+            print("%-45s %12.0f %12s" % (name, baseline[name], "missing"))
+            continue
+        change = 100. * (current[name] - baseline[name]) / baseline[name]
+        print("%-45s %12.0f %12.0f %+7.1f%%" % (name, baseline[name], current[name], change))
+        if change > threshold:
+            regressed = True
+    for name in sorted(current.keys()):
+        if name not in baseline:
+            print("%-45s %12s %12.0f" % (name, "missing", current[name]))
+    return 1 if regressed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
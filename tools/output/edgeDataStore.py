@@ -0,0 +1,208 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2017 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+
+# @file    edgeDataStore.py
+# @author  Michael Behrisch
+# @date    2017-09-01
+# @version $Id$
+
+"""
+Converts meandata (edgedata) XML output into an indexed binary store
+holding one interval x edge matrix of doubles per attribute and performs
+fast comparisons on such stores. The XML file is parsed only once (on
+'convert'); 'diff' and 'mean' read the stores via mmap so that comparing
+many scenario variants does not touch the XML parser at all.
+
+USAGE:
+  edgeDataStore.py convert <edgedata.xml> <store>
+  edgeDataStore.py diff <origStore> <newStore> <diff.xml>
+  edgeDataStore.py mean <mean.xml> <store> [<store> ...]
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+import os
+import sys
+import json
+import mmap
+import struct
+from array import array
+from collections import defaultdict
+sys.path.append(os.path.join(os.path.dirname(sys.argv[0]), '..'))
+from sumolib.output import parse  # noqa
+from sumolib.miscutils import Statistics  # noqa
+
+MAGIC = b'SEDS\x01'
+NAN = float('nan')
+
+
+def convert(xmlfile, storefile):
+    """parses the given meandata XML file and writes the binary store"""
+    begins = []
+    ends = []
+    edgeIndex = {}
+    edgeIDs = []
+    attrIndex = {}
+    attrIDs = []
+    intervals = []  # per interval a map attrIdx -> (edgeIdx -> value)
+    for interval in parse(xmlfile, 'interval'):
+        begins.append(float(interval.begin))
+        ends.append(float(interval.end))
+        values = defaultdict(dict)
+        intervals.append(values)
+        if interval.edge is None:
+            continue
+        for edge in interval.edge:
+            e = edgeIndex.get(edge.id)
+            if e is None:
+                e = edgeIndex[edge.id] = len(edgeIDs)
+                edgeIDs.append(edge.id)
+            for attr in edge._fields:
+                if attr == 'id':
+                    continue
+                val = getattr(edge, attr)
+                if val is None:
+                    continue
+                try:
+                    val = float(val)
+                except ValueError:
+                    continue
+                a = attrIndex.get(attr)
+                if a is None:
+                    a = attrIndex[attr] = len(attrIDs)
+                    attrIDs.append(attr)
+                values[a][e] = val
+    meta = json.dumps({'attrs': attrIDs, 'edges': edgeIDs,
+                       'begins': begins, 'ends': ends}).encode('utf8')
+    with open(storefile, 'wb') as f:
+        f.write(MAGIC)
+        f.write(struct.pack('<I', len(meta)))
+        f.write(meta)
+        for a in range(len(attrIDs)):
+            for values in intervals:
+                row = array('d', [NAN] * len(edgeIDs))
+                for e, val in values[a].items():
+                    row[e] = val
+                if sys.byteorder == 'big':
+                    row.byteswap()
+                f.write(row.tobytes() if hasattr(row, 'tobytes') else row.tostring())
+
+
+class EdgeDataStore:
+
+    """read-only view of a binary edge-data store; the matrices are read
+    via mmap so only the pages of the queried attributes are loaded"""
+
+    def __init__(self, storefile):
+        self._file = open(storefile, 'rb')
+        if self._file.read(len(MAGIC)) != MAGIC:
+            sys.exit("'%s' is not an edge-data store." % storefile)
+        metaSize = struct.unpack('<I', self._file.read(4))[0]
+        meta = json.loads(self._file.read(metaSize).decode('utf8'))
+        self.attrs = meta['attrs']
+        self.edges = meta['edges']
+        self.begins = meta['begins']
+        self.ends = meta['ends']
+        self._dataStart = len(MAGIC) + 4 + metaSize
+        self._rowSize = 8 * len(self.edges)
+        self._map = mmap.mmap(self._file.fileno(), 0, access=mmap.ACCESS_READ)
+
+    def sameShape(self, other):
+        return self.edges == other.edges and self.begins == other.begins
+
+    def row(self, attr, interval):
+        """returns the values of the given attribute for all edges of the
+        given interval (in the order of self.edges, NaN for missing)"""
+        offset = self._dataStart + \
+            (self.attrs.index(attr) * len(self.begins) + interval) * self._rowSize
+        row = array('d')
+        data = self._map[offset:offset + self._rowSize]
+        if hasattr(row, 'frombytes'):
+            row.frombytes(data)
+        else:
+            row.fromstring(data)
+        if sys.byteorder == 'big':
+            row.byteswap()
+        return row
+
+    def close(self):
+        self._map.close()
+        self._file.close()
+
+
+def diff(origFile, newFile, out):
+    orig = EdgeDataStore(origFile)
+    new = EdgeDataStore(newFile)
+    if not orig.sameShape(new):
+        sys.exit("Stores '%s' and '%s' do not describe the same edges and intervals." % (
+            origFile, newFile))
+    attrs = [a for a in orig.attrs if a in new.attrs]
+    diffStats = defaultdict(Statistics)
+    with open(out, 'w') as f:
+        f.write("<meandata>\n")
+        for i in range(len(orig.begins)):
+            f.write('    <interval begin="%s" end="%s">\n' %
+                    (orig.begins[i], orig.ends[i]))
+            origRows = [orig.row(a, i) for a in attrs]
+            newRows = [new.row(a, i) for a in attrs]
+            for e, edge in enumerate(orig.edges):
+                line = ''
+                for a, attr in enumerate(attrs):
+                    origVal = origRows[a][e]
+                    newVal = newRows[a][e]
+                    if origVal == origVal and newVal == newVal:  # not NaN
+                        delta = newVal - origVal
+                        diffStats[attr].add(delta, edge)
+                        line += ' %s="%s"' % (attr, delta)
+                if line:
+                    f.write('    <edge id="%s"%s/>\n' % (edge, line))
+            f.write("    </interval>\n")
+        f.write("</meandata>\n")
+    for attr, stats in diffStats.items():
+        stats.label = attr
+        print(stats)
+
+
+def mean(out, storefiles):
+    stores = [EdgeDataStore(s) for s in storefiles]
+    first = stores[0]
+    attrs = first.attrs
+    for other in stores[1:]:
+        if not first.sameShape(other):
+            sys.exit("The given stores do not describe the same edges and intervals.")
+        attrs = [a for a in attrs if a in other.attrs]
+    with open(out, 'w') as f:
+        f.write("<meandata>\n")
+        for i in range(len(first.begins)):
+            f.write('    <interval begin="%s" end="%s">\n' %
+                    (first.begins[i], first.ends[i]))
+            rows = [[s.row(a, i) for s in stores] for a in attrs]
+            for e, edge in enumerate(first.edges):
+                line = ''
+                for a, attr in enumerate(attrs):
+                    values = [r[e] for r in rows[a] if r[e] == r[e]]
+                    if values:
+                        line += ' %s="%s"' % (attr, sum(values) / len(values))
+                if line:
+                    f.write('    <edge id="%s"%s/>\n' % (edge, line))
+            f.write("    </interval>\n")
+        f.write("</meandata>\n")
+
+
+def main(args):
+    if len(args) == 3 and args[0] == 'convert':
+        convert(args[1], args[2])
+    elif len(args) == 4 and args[0] == 'diff':
+        diff(args[1], args[2], args[3])
+    elif len(args) >= 3 and args[0] == 'mean':
+        mean(args[1], args[2:])
+    else:
+        sys.exit(__doc__)
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
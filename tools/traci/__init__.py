@@ -91,7 +91,7 @@ def isEmbedded():
 
 def load(args):
     """load([optionOrParam, ...])
-    Let sumo load a simulation using the given command line like options 
+    Let sumo load a simulation using the given command line like options
     Example:
       load(['-c', 'run.sumocfg'])
       load(['-n', 'net.net.xml', '-r', 'routes.rou.xml'])
@@ -99,6 +99,23 @@ def load(args):
     return _connections[""].load(args)
 
 
+def beginBatch():
+    """beginBatch()
+    Start collecting value changing commands into a single message instead of
+    sending each one on its own. This avoids one socket round trip per
+    command. Commands which return a result flush the collected commands
+    within the same message; endBatch sends any remaining ones.
+    """
+    return _connections[""].beginBatch()
+
+
+def endBatch():
+    """endBatch()
+    Send all collected commands in one message and check their results.
+    """
+    return _connections[""].endBatch()
+
+
 def simulationStep(step=0):
     """
     Make a simulation step and simulate up to the given millisecond in sim time.
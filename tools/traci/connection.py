@@ -53,6 +53,7 @@ class Connection:
             self._process = process
         self._string = bytes()
         self._queue = []
+        self._batching = False
         self._subscriptionMapping = {}
         for domain in _defaultDomains:
             domain._register(self, self._subscriptionMapping)
@@ -112,6 +113,29 @@ class Connection:
         self._queue = []
         return result
 
+    def _sendPending(self):
+        """While batching, value changing commands are only appended to the
+        outgoing message; they are sent (and their results checked) together
+        with the next command which needs an answer or with endBatch."""
+        if not self._batching:
+            self._sendExact()
+
+    def beginBatch(self):
+        """Starts collecting value changing commands into a single message
+        instead of sending each one on its own. Commands which return a
+        result (all value retrievals, subscriptions and simulationStep)
+        flush the collected commands in the same message and wait for the
+        combined answer; batching stays active until endBatch. Errors of
+        batched commands are only reported when the batch is flushed."""
+        self._batching = True
+
+    def endBatch(self):
+        """Sends all collected commands in one message and checks their
+        results."""
+        self._batching = False
+        if self._queue:
+            self._sendExact()
+
     def _beginMessage(self, cmdID, varID, objID, length=0):
         self._queue.append(cmdID)
         length += 1 + 1 + 1 + 4 + len(objID)
@@ -128,27 +152,27 @@ class Connection:
     def _sendIntCmd(self, cmdID, varID, objID, value):
         self._beginMessage(cmdID, varID, objID, 1 + 4)
         self._string += struct.pack("!Bi", tc.TYPE_INTEGER, value)
-        self._sendExact()
+        self._sendPending()
 
     def _sendDoubleCmd(self, cmdID, varID, objID, value):
         self._beginMessage(cmdID, varID, objID, 1 + 8)
         self._string += struct.pack("!Bd", tc.TYPE_DOUBLE, value)
-        self._sendExact()
+        self._sendPending()
         
     def _sendByteCmd(self, cmdID, varID, objID, value):
         self._beginMessage(cmdID, varID, objID, 1 + 1)
         self._string += struct.pack("!BB", tc.TYPE_BYTE, value)
-        self._sendExact()
+        self._sendPending()
 
     def _sendUByteCmd(self, cmdID, varID, objID, value):
         self._beginMessage(cmdID, varID, objID, 1 + 1)
         self._string += struct.pack("!BB", tc.TYPE_UBYTE, value)
-        self._sendExact()
+        self._sendPending()
 
     def _sendStringCmd(self, cmdID, varID, objID, value):
         self._beginMessage(cmdID, varID, objID, 1 + 4 + len(value))
         self._packString(value)
-        self._sendExact()
+        self._sendPending()
 
     def _checkResult(self, cmdID, varID, objID):
         result = self._sendExact()
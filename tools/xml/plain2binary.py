@@ -0,0 +1,177 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2017 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+
+# @file    plain2binary.py
+# @author  Michael Behrisch
+# @date    2017-09-01
+# @version $Id$
+
+"""
+Converts a plain SUMO XML file (e.g. a weight / meandata file) into the
+binary sbx format which all SUMO applications read transparently whenever
+an input file name ends with '.sbx'. Parsing sbx skips the XML parser
+completely which speeds up loading of large inputs such as historical
+weight profiles considerably.
+
+The sbx tag and attribute indices have to match the enums of the SUMO
+version reading the file, so this script parses them from the source tree
+(it needs SUMO_HOME to point to a source checkout).
+
+Usage: plain2binary.py <input.xml> <output.sbx>
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+import os
+import re
+import struct
+import sys
+from xml.sax import parse, handler
+
+BYTE = 0
+INTEGER = 1
+FLOAT = 2
+STRING = 3
+LIST = 4
+XML_TAG_START = 5
+XML_TAG_END = 6
+XML_ATTRIBUTE = 7
+
+
+def parseEnum(headerFile, enumName):
+    """returns the mapping of enumerator name to numerical value for a
+       sequential enum (no explicit values) in the given header"""
+    values = {}
+    index = 0
+    inEnum = False
+    inComment = False
+    for line in open(headerFile):
+        if not inEnum:
+            if line.startswith("enum %s {" % enumName):
+                inEnum = True
+            continue
+        if line.startswith("};"):
+            break
+        if inComment:
+            if "*/" in line:
+                line = line.split("*/", 1)[1]
+                inComment = False
+            else:
+                continue
+        line = line.split("//")[0]
+        if "/*" in line:
+            line = line.split("/*")[0]
+            inComment = True
+        for part in line.split(","):
+            part = part.strip()
+            if re.match(r"^[A-Za-z_][A-Za-z0-9_]*$", part):
+                values[part] = index
+                index += 1
+    return values
+
+
+def parseStringTable(sourceFile, tableName, enumValues):
+    """returns the mapping of XML name to numerical enum value as defined
+       by the given StringBijection initializer table"""
+    values = {}
+    inTable = False
+    for line in open(sourceFile):
+        if not inTable:
+            if tableName in line:
+                inTable = True
+            continue
+        if line.startswith("};"):
+            break
+        m = re.search(r'\{\s*"([^"]*)",\s*([A-Za-z0-9_]+)', line)
+        if m and m.group(2) in enumValues:
+            values[m.group(1)] = enumValues[m.group(2)]
+    return values
+
+
+def writeTypedString(out, s):
+    out.write(struct.pack("=Bi", STRING, len(s)))
+    out.write(s.encode("latin1"))
+
+
+def writeStringList(out, strings):
+    out.write(struct.pack("=Bi", LIST, len(strings)))
+    for s in strings:
+        writeTypedString(out, s)
+
+
+def indexedNames(nameToIndex):
+    """returns the list of names ordered by index as stored in the header
+       dictionaries (gaps are filled with empty strings)"""
+    result = [""] * (max(nameToIndex.values()) + 1) if nameToIndex else []
+    for name, index in nameToIndex.items():
+        result[index] = name
+    return result
+
+
+class BinaryWriter(handler.ContentHandler):
+
+    def __init__(self, out, tagMap, attrMap):
+        self._out = out
+        self._tagMap = tagMap
+        self._attrMap = attrMap
+        self._warned = set()
+
+    def startElement(self, name, attrs):
+        if name not in self._tagMap:
+            # unknown elements are dropped just as the binary output device
+            # does it; their children are still written
+            self._warn(name)
+            return
+        tag = self._tagMap[name]
+        self._out.write(struct.pack("BBB", XML_TAG_START, tag % 256, tag // 256))
+        for attrName in attrs.getNames():
+            if attrName not in self._attrMap:
+                self._warn("%s@%s" % (attrName, name))
+                continue
+            attr = self._attrMap[attrName]
+            self._out.write(struct.pack("BBB", XML_ATTRIBUTE, attr % 256, attr // 256))
+            writeTypedString(self._out, attrs[attrName])
+
+    def endElement(self, name):
+        if name in self._tagMap:
+            self._out.write(struct.pack("B", XML_TAG_END))
+
+    def _warn(self, what):
+        if what not in self._warned:
+            print("Warning: skipping unknown '%s'." % what, file=sys.stderr)
+            self._warned.add(what)
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("Usage: plain2binary.py <input.xml> <output.sbx>", file=sys.stderr)
+        sys.exit(1)
+    sumoHome = os.environ.get("SUMO_HOME",
+                              os.path.join(os.path.dirname(__file__), "..", ".."))
+    defs = os.path.join(sumoHome, "src", "utils", "xml", "SUMOXMLDefinitions")
+    if not os.path.exists(defs + ".h"):
+        print("Cannot find SUMOXMLDefinitions.h, please set SUMO_HOME to a source checkout.", file=sys.stderr)
+        sys.exit(1)
+    tagEnum = parseEnum(defs + ".h", "SumoXMLTag")
+    attrEnum = parseEnum(defs + ".h", "SumoXMLAttr")
+    tagMap = parseStringTable(defs + ".cpp", "SUMOXMLDefinitions::tags[]", tagEnum)
+    attrMap = parseStringTable(defs + ".cpp", "SUMOXMLDefinitions::attrs[]", attrEnum)
+    with open(sys.argv[2], 'wb') as out:
+        # sbx version 2 header
+        out.write(struct.pack("BB", BYTE, 2))
+        writeTypedString(out, "plain2binary.py")
+        writeStringList(out, indexedNames(tagMap))
+        writeStringList(out, indexedNames(attrMap))
+        writeStringList(out, [])  # node types (only used for networks)
+        writeStringList(out, [])  # edge functions (only used for networks)
+        writeStringList(out, [])  # edges (only used for route compression)
+        out.write(struct.pack("=Bi", LIST, 0))  # followers (dito)
+        parse(sys.argv[1], BinaryWriter(out, tagMap, attrMap))
+
+
+if __name__ == "__main__":
+    main()
@@ -98,6 +98,7 @@ TEST_F(MSCFModelTest, test_method_static_freeSpeed) {
 #ifdef HAVE_SUBSECOND_TIMESTEPS
 TEST_F(MSCFModelTest, test_method_static_freeSpeed_half) {
     DELTA_T = 500;
+    TS = STEPS2TIME(DELTA_T);
     const double b = 4;
     const double v = 0;
     const double g = 4;
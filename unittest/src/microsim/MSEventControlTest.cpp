@@ -27,13 +27,32 @@
 /* Test the method 'execute'. Tests if the execute method from the Command Class is called.*/
 
 TEST(MSEventControl, test_method_execute) {
-    
+
     MSEventControl eventControl;
-    CommandMock *mock = new CommandMock(); 
+    CommandMock *mock = new CommandMock();
     eventControl.setCurrentTimeStep(4);
     eventControl.addEvent(mock);
-    
+
     EXPECT_FALSE(mock->isExecuteCalled());
     eventControl.execute(5);
     EXPECT_TRUE(mock->isExecuteCalled());
 }
+
+/* Tests that events stay scheduled until their execution time is reached
+   and that events returning a positive offset are reinserted.*/
+
+TEST(MSEventControl, test_future_and_recurring_events) {
+
+    MSEventControl eventControl;
+    CommandMock *mock = new CommandMock();
+    eventControl.addEvent(mock, 7000);
+
+    eventControl.execute(5000);
+    EXPECT_FALSE(mock->isExecuteCalled());
+    eventControl.execute(6000);
+    EXPECT_FALSE(mock->isExecuteCalled());
+    eventControl.execute(7000);
+    EXPECT_TRUE(mock->isExecuteCalled());
+    // the mock returns a positive offset and is hence rescheduled
+    EXPECT_FALSE(eventControl.isEmpty());
+}
@@ -130,3 +130,22 @@ TEST(RandHelper, test_sequence) {
         EXPECT_EQ(expect[i], RandHelper::rand(100));
     }
 }
+
+/* Test whether named streams are reproducible and independent of each other.*/
+TEST(RandHelper, test_named_streams) {
+    RandHelper::initRand();
+    std::vector<int> first;
+    for (int i = 0; i < 10; i++) {
+        first.push_back(RandHelper::rand(100, RandHelper::getNamedRNG("laneA")));
+    }
+    // reinitialising with the same seed restarts all named streams
+    RandHelper::initRand();
+    // drawing from another stream first must not influence laneA's sequence
+    RandHelper::rand(100, RandHelper::getNamedRNG("laneB"));
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(first[i], RandHelper::rand(100, RandHelper::getNamedRNG("laneA")));
+    }
+    // repeated queries return the same generator, different names another one
+    EXPECT_EQ(RandHelper::getNamedRNG("laneA"), RandHelper::getNamedRNG("laneA"));
+    EXPECT_NE(RandHelper::getNamedRNG("laneA"), RandHelper::getNamedRNG("laneB"));
+}
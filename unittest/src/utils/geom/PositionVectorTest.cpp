@@ -148,6 +148,29 @@ TEST_F(PositionVectorTest, test_method_getPolygonCenter) {
 }
 
 
+/* Test the method 'simplified' with a maximum error (Douglas-Peucker)*/
+TEST_F(PositionVectorTest, test_method_simplified_maxError) {
+    PositionVector vec;
+    vec.push_back(Position(0, 0));
+    vec.push_back(Position(1, 0.1));
+    vec.push_back(Position(2, -0.1));
+    vec.push_back(Position(3, 5));
+    vec.push_back(Position(4, 6));
+    vec.push_back(Position(5, 7));
+    vec.push_back(Position(6, 8.1));
+    vec.push_back(Position(7, 9));
+    vec.push_back(Position(8, 9));
+    PositionVector result = vec.simplified(1.);
+    EXPECT_EQ(4, (int)result.size());
+    EXPECT_EQ(Position(0, 0), result[0]);
+    EXPECT_EQ(Position(2, -0.1), result[1]);
+    EXPECT_EQ(Position(3, 5), result[2]);
+    EXPECT_EQ(Position(8, 9), result[3]);
+    // nothing may be removed when no error is allowed
+    EXPECT_EQ(vec.size(), vec.simplified(0.).size());
+}
+
+
 /* Test the method 'getBoxBoundary'*/
 TEST_F(PositionVectorTest, test_method_getBoxBoundary) {	
 	Boundary bound = vectorPolygon->getBoxBoundary();